@@ -0,0 +1,40 @@
+/*
+  The endgame bitbase (see bitbase.h).  The bits themselves, and where
+  each slice starts among them, are in bitbase_data.h, written by
+  host/tbgen.cpp.
+*/
+
+#include "progmem.h"
+#include "rules.h"
+#include "endgame.h"
+#include "bitbase.h"
+#include "bitbase_data.h"
+
+uint8_t probe_bitbase(const Board* board, int8_t turn)
+{
+  /*
+    looks up whether the player to move wins, where:
+
+    board: the position
+    turn: the player to move, TURN_RED or TURN_BLUE
+   */
+  Board position = *board;
+  Material material;
+
+  if (turn == TURN_BLUE){
+    flip_board(&position); // the bitbase only has red to move
+  }
+  uint8_t total = board_material(&position, &material);
+  if (total > BITBASE_KING_PIECES || !position.red || !position.blue){
+    return BITBASE_UNKNOWN;
+  }
+
+  uint32_t start =
+    pgm_read_dword(&BITBASE_SLICE_STARTS[slice_number(&material)]);
+  if (start == BITBASE_ABSENT){
+    return BITBASE_UNKNOWN;
+  }
+  uint32_t bit = start + bitbase_index(&position, &material);
+  return (pgm_read_byte_far(pgm_get_far_address(BITBASE_BITS) + (bit / 8)) >>
+	  (bit % 8)) & 1;
+}
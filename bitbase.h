@@ -0,0 +1,53 @@
+#ifndef _BITBASE_H
+#define _BITBASE_H
+
+/*
+  The endgame bitbase: whether the player to move wins, one bit a
+  position, for the endings small enough to keep in the Mega's flash.  The
+  bits are worked out by host/tbgen.cpp (`make -C host bitbase`) and
+  compiled in from bitbase_data.h, so a probe is a few lookups in
+  PROGMEM, with no SD card and no search.
+
+  It covers every ending of up to BITBASE_PIECES checkers, and every
+  ending of kings alone up to BITBASE_KING_PIECES, the ones that drag on
+  longest.  Only positions with red to move are kept, and endings of kings
+  alone are halved by turning the board around (see endgame.h), which
+  brings it to 54 KB; every ending of four checkers would take 800 KB,
+  more than the whole flash.  The bits alone would crowd the sketch's
+  other PROGMEM tables and strings out of the first 64 KB of flash, the
+  most pgm_read_byte reaches, so they are kept after the code instead
+  (PROGMEM_FAR, see progmem.h) and read by their far address.
+
+  Like the rules, the bitbase knows nothing of repetitions or of the
+  DRAW_PLIES rule: a position it calls won may still be drawn by them.
+*/
+
+#include <stdint.h>
+#include "rules.h"
+#include "endgame.h"
+
+#define BITBASE_PIECES 3 // every ending with this many checkers or fewer
+#define BITBASE_KING_PIECES 4 // and every ending of kings alone up to this
+
+// whether a slice is in the bitbase
+#define BITBASE_COVERS(material, total) ((total) <= BITBASE_PIECES || \
+    ((total) <= BITBASE_KING_PIECES && !(material)->red_men && \
+     !(material)->blue_men))
+
+// probe results
+#define BITBASE_NO_WIN 0  // drawn or lost for the player to move
+#define BITBASE_WIN 1     // won for the player to move
+#define BITBASE_UNKNOWN 2 // not in the bitbase
+
+/*
+  looks up whether the player to move wins, where:
+
+  board: the position
+  turn: the player to move, TURN_RED or TURN_BLUE
+
+  returns BITBASE_WIN, BITBASE_NO_WIN, or BITBASE_UNKNOWN if the position
+  has too many checkers, or a side has none
+*/
+uint8_t probe_bitbase(const Board* board, int8_t turn);
+
+#endif
@@ -0,0 +1,79 @@
+/*
+  The opening book (see book.h).  The entries are in book_data.h, written
+  by host/bookgen.cpp.
+*/
+
+#include "progmem.h"
+#include "rules.h"
+#include "ttable.h"
+#include "book.h"
+#include "book_data.h"
+
+#define BOOK_ENTRIES (sizeof(BOOK) / sizeof(BOOK[0]))
+
+static uint32_t entry_hash(uint16_t entry)
+{
+  return pgm_read_dword(&BOOK[entry].hash);
+}
+
+uint8_t book_move(const Board* board, int8_t turn, uint16_t choice,
+		  Move* move)
+{
+  /*
+    looks up a position in the book, where:
+
+    board: the position
+    turn: the player to move, TURN_RED or TURN_BLUE
+    choice: a random number, which picks among the position's moves by
+      their weights
+    move: set to the move chosen
+   */
+  uint32_t hash = BOOK_HASH(position_key(board, turn));
+  uint16_t low = 0;
+  uint16_t high = BOOK_ENTRIES;
+
+  // the first entry at or after the hash, by binary search
+  while (low < high){
+    uint16_t middle = low + ((high - low) / 2);
+    if (entry_hash(middle) < hash){
+      low = middle + 1;
+    }
+    else {
+      high = middle;
+    }
+  }
+
+  // the position's moves follow each other; pick one by weight
+  uint32_t total = 0;
+  uint16_t end = low;
+  while (end < BOOK_ENTRIES && entry_hash(end) == hash){
+    total += pgm_read_word(&BOOK[end].weight);
+    end++;
+  }
+  if (!total){
+    return 0;
+  }
+  uint32_t pick = choice % total;
+  uint16_t entry = low;
+  while (pick >= pgm_read_word(&BOOK[entry].weight)){
+    pick -= pgm_read_word(&BOOK[entry].weight);
+    entry++;
+  }
+
+  // a move that is not legal here means another position shares the hash
+  MoveList list;
+  uint16_t packed = pgm_read_word(&BOOK[entry].move);
+  generate_moves(board, turn, &list);
+  for (uint8_t i = 0; i < list.count; i++){
+    if (PACK_MOVE(list.moves[i]) == packed){
+      *move = list.moves[i];
+      return 1;
+    }
+  }
+  return 0;
+}
+
+uint16_t book_size()
+{
+  return BOOK_ENTRIES;
+}
@@ -0,0 +1,57 @@
+#ifndef _BOOK_H
+#define _BOOK_H
+
+/*
+  The opening book: moves worked out ahead of time for the positions the
+  games start with, so that the computer answers them at once and keeps
+  its thinking time for later.  Every game starts from the position
+  SETUP_MODE sets up, so the same positions come up game after game.
+
+  The book is built on the host by host/bookgen.cpp, from games the search
+  plays against itself or from games read in, and compiled in from
+  book_data.h: an array of BookEntry in PROGMEM, sorted by position hash,
+  with every move of a position next to each other.  A lookup is a binary
+  search of it.  The array shares the 64 KB of flash that pgm_read_dword
+  reaches with the bitbase (see bitbase.h), so it is kept to a few KB.
+*/
+
+#include <stdint.h>
+#include "rules.h"
+
+#define BOOK_HASH(key) ((uint32_t) ((key) >> 32)) // of position_key
+
+/*
+  Struct for a move of the book, 8 bytes, where:
+
+  hash:   the top 32 bits of the position's position_key
+  move:   the move, packed by PACK_MOVE (see ttable.h)
+  weight: how often it was played, which is how often it is chosen
+*/
+typedef struct {
+  uint32_t hash;
+  uint16_t move;
+  uint16_t weight;
+} BookEntry;
+
+
+/*
+  looks up a position in the book, where:
+
+  board: the position
+  turn: the player to move, TURN_RED or TURN_BLUE
+  choice: a random number, which picks among the position's moves by their
+    weights
+  move: set to the move chosen
+
+  returns 0 if the position is not in the book
+*/
+uint8_t book_move(const Board* board, int8_t turn, uint16_t choice,
+		  Move* move);
+
+
+/*
+  the number of entries in the book, for reporting
+*/
+uint16_t book_size();
+
+#endif
@@ -0,0 +1,520 @@
+/*
+  The opening book's moves (see book.h), written by
+  host/bookgen.cpp: do not edit.
+*/
+
+#ifndef _BOOK_DATA_H
+#define _BOOK_DATA_H
+
+// hash, move, weight; sorted by hash
+static const BookEntry BOOK[507] PROGMEM = {
+  {0x0273BEDDUL, 0x023A, 2},
+  {0x0273BEDDUL, 0x0259, 8},
+  {0x036B9244UL, 0x0104, 2},
+  {0x036B9244UL, 0x0105, 1},
+  {0x036B9244UL, 0x01C9, 1},
+  {0x036B9244UL, 0x01CA, 1},
+  {0x036B9244UL, 0x01EA, 7},
+  {0x13049986UL, 0x01C7, 14},
+  {0x13049986UL, 0x01E6, 11},
+  {0x19941887UL, 0x0147, 4},
+  {0x19941887UL, 0x0188, 3},
+  {0x19941887UL, 0x01A8, 1},
+  {0x19941887UL, 0x01EB, 1},
+  {0x19EF7939UL, 0x0190, 3},
+  {0x19EF7939UL, 0x01B0, 4},
+  {0x19EF7939UL, 0x0236, 1},
+  {0x19EF7939UL, 0x0257, 4},
+  {0x19EF7939UL, 0x0277, 1},
+  {0x19EF7939UL, 0x02B8, 1},
+  {0x19EF7939UL, 0x02B9, 3},
+  {0x1A2A6E0AUL, 0x0146, 3},
+  {0x1A2A6E0AUL, 0x0188, 3},
+  {0x1A2A6E0AUL, 0x01A8, 1},
+  {0x1A2A6E0AUL, 0x01A9, 2},
+  {0x1E97B44CUL, 0x0214, 3},
+  {0x1E97B44CUL, 0x0215, 2},
+  {0x1E97B44CUL, 0x0235, 2},
+  {0x1E97B44CUL, 0x0257, 1},
+  {0x1E97B44CUL, 0x0277, 1},
+  {0x1E97B44CUL, 0x02D9, 2},
+  {0x1E97B44CUL, 0x02DA, 3},
+  {0x20E32D4BUL, 0x0256, 5},
+  {0x20E32D4BUL, 0x0257, 6},
+  {0x20E32D4BUL, 0x0277, 2},
+  {0x20E32D4BUL, 0x02B8, 3},
+  {0x20E32D4BUL, 0x02B9, 5},
+  {0x27D20E63UL, 0x0190, 2},
+  {0x27D20E63UL, 0x01B0, 4},
+  {0x27D20E63UL, 0x0235, 1},
+  {0x27D20E63UL, 0x0236, 2},
+  {0x27D20E63UL, 0x0257, 4},
+  {0x27D20E63UL, 0x0298, 5},
+  {0x296C8C90UL, 0x0214, 151},
+  {0x296C8C90UL, 0x0215, 145},
+  {0x296C8C90UL, 0x0235, 154},
+  {0x296C8C90UL, 0x0236, 133},
+  {0x296C8C90UL, 0x0256, 156},
+  {0x296C8C90UL, 0x0257, 137},
+  {0x296C8C90UL, 0x0277, 148},
+  {0x2DB10996UL, 0x01B0, 6},
+  {0x2DB10996UL, 0x0235, 6},
+  {0x2DB10996UL, 0x0236, 2},
+  {0x2DB10996UL, 0x0277, 2},
+  {0x2DB10996UL, 0x0298, 5},
+  {0x35BB1E07UL, 0x0188, 26},
+  {0x35BB1E07UL, 0x01A8, 23},
+  {0x35BB1E07UL, 0x01A9, 18},
+  {0x35BB1E07UL, 0x01C9, 21},
+  {0x35BB1E07UL, 0x01CA, 17},
+  {0x35BB1E07UL, 0x01EA, 18},
+  {0x35BB1E07UL, 0x01EB, 22},
+  {0x377AD002UL, 0x01C7, 6},
+  {0x377AD002UL, 0x01E6, 8},
+  {0x3F18F03EUL, 0x0190, 4},
+  {0x3F18F03EUL, 0x01B0, 5},
+  {0x3F18F03EUL, 0x0256, 6},
+  {0x3F18F03EUL, 0x0298, 8},
+  {0x3FD9F9F1UL, 0x0105, 3},
+  {0x3FD9F9F1UL, 0x01C9, 1},
+  {0x3FD9F9F1UL, 0x01CA, 1},
+  {0x3FD9F9F1UL, 0x01EA, 2},
+  {0x3FD9F9F1UL, 0x01EB, 1},
+  {0x3FD9F9F1UL, 0x020C, 3},
+  {0x404641FEUL, 0x01F3, 5},
+  {0x404641FEUL, 0x0214, 6},
+  {0x404641FEUL, 0x0215, 1},
+  {0x404641FEUL, 0x0235, 3},
+  {0x404641FEUL, 0x0236, 2},
+  {0x404641FEUL, 0x0256, 3},
+  {0x404641FEUL, 0x02FA, 4},
+  {0x40A69EB3UL, 0x01D2, 4},
+  {0x40A69EB3UL, 0x0215, 1},
+  {0x40A69EB3UL, 0x0235, 2},
+  {0x40A69EB3UL, 0x0277, 1},
+  {0x40A69EB3UL, 0x02D9, 2},
+  {0x40A69EB3UL, 0x02DA, 2},
+  {0x461C9548UL, 0x0146, 2},
+  {0x461C9548UL, 0x0147, 1},
+  {0x461C9548UL, 0x0188, 1},
+  {0x461C9548UL, 0x01A8, 1},
+  {0x461C9548UL, 0x01A9, 1},
+  {0x461C9548UL, 0x024F, 2},
+  {0x461C9548UL, 0x026F, 2},
+  {0x46CF28FAUL, 0x0188, 3},
+  {0x46CF28FAUL, 0x01A8, 7},
+  {0x46CF28FAUL, 0x01A9, 5},
+  {0x46CF28FAUL, 0x01C9, 3},
+  {0x46CF28FAUL, 0x01CA, 4},
+  {0x46CF28FAUL, 0x01EA, 4},
+  {0x4C4D6097UL, 0x0146, 2},
+  {0x4C4D6097UL, 0x0147, 1},
+  {0x4C4D6097UL, 0x01A8, 2},
+  {0x4C4D6097UL, 0x01C9, 4},
+  {0x4E1AD2C0UL, 0x0185, 12},
+  {0x4E1AD2C0UL, 0x01A4, 10},
+  {0x4F2FFF61UL, 0x0236, 1},
+  {0x4F2FFF61UL, 0x0256, 5},
+  {0x4F2FFF61UL, 0x0257, 2},
+  {0x4F2FFF61UL, 0x0277, 1},
+  {0x4F2FFF61UL, 0x02B8, 1},
+  {0x4F2FFF61UL, 0x02B9, 1},
+  {0x53626629UL, 0x01F2, 4},
+  {0x53626629UL, 0x0214, 2},
+  {0x53626629UL, 0x0215, 4},
+  {0x53626629UL, 0x0277, 6},
+  {0x53626629UL, 0x02D9, 4},
+  {0x53626629UL, 0x02DA, 4},
+  {0x5382B964UL, 0x0215, 3},
+  {0x5382B964UL, 0x0235, 1},
+  {0x5382B964UL, 0x0236, 1},
+  {0x5382B964UL, 0x0256, 4},
+  {0x5382B964UL, 0x02FA, 1},
+  {0x5382B964UL, 0x02FB, 3},
+  {0x538F715DUL, 0x0214, 2},
+  {0x538F715DUL, 0x0256, 3},
+  {0x538F715DUL, 0x0257, 2},
+  {0x538F715DUL, 0x0277, 3},
+  {0x538F715DUL, 0x02B8, 3},
+  {0x538F715DUL, 0x02B9, 3},
+  {0x58EB2B88UL, 0x01A6, 16},
+  {0x58EB2B88UL, 0x01C5, 2},
+  {0x5966EFDFUL, 0x0215, 5},
+  {0x5966EFDFUL, 0x0235, 2},
+  {0x5966EFDFUL, 0x0257, 1},
+  {0x5966EFDFUL, 0x02D9, 2},
+  {0x5B484893UL, 0x0188, 21},
+  {0x5B484893UL, 0x01A8, 16},
+  {0x5B484893UL, 0x01A9, 19},
+  {0x5B484893UL, 0x01C9, 18},
+  {0x5B484893UL, 0x01CA, 18},
+  {0x5B484893UL, 0x01EA, 19},
+  {0x5B484893UL, 0x01EB, 26},
+  {0x5ED66B15UL, 0x0125, 1},
+  {0x5ED66B15UL, 0x0126, 3},
+  {0x5ED66B15UL, 0x01EA, 2},
+  {0x5ED66B15UL, 0x022E, 2},
+  {0x5ED66B15UL, 0x024E, 2},
+  {0x607ABC62UL, 0x01D1, 1},
+  {0x607ABC62UL, 0x0214, 5},
+  {0x607ABC62UL, 0x0256, 2},
+  {0x607ABC62UL, 0x0257, 5},
+  {0x607ABC62UL, 0x0277, 2},
+  {0x607ABC62UL, 0x02B8, 2},
+  {0x607ABC62UL, 0x02B9, 4},
+  {0x62B1617EUL, 0x0188, 3},
+  {0x62B1617EUL, 0x01A8, 2},
+  {0x62B1617EUL, 0x01A9, 6},
+  {0x62B1617EUL, 0x01C9, 3},
+  {0x62B1617EUL, 0x01CA, 5},
+  {0x62B1617EUL, 0x01EA, 4},
+  {0x680EAA09UL, 0x01B1, 2},
+  {0x680EAA09UL, 0x01D1, 2},
+  {0x680EAA09UL, 0x0256, 4},
+  {0x680EAA09UL, 0x0257, 5},
+  {0x680EAA09UL, 0x0277, 2},
+  {0x680EAA09UL, 0x02B8, 2},
+  {0x6C1226C0UL, 0x0188, 26},
+  {0x6C1226C0UL, 0x01A8, 11},
+  {0x6C1226C0UL, 0x01A9, 19},
+  {0x6C1226C0UL, 0x01C9, 28},
+  {0x6C1226C0UL, 0x01CA, 24},
+  {0x6C1226C0UL, 0x01EA, 14},
+  {0x6C1226C0UL, 0x01EB, 26},
+  {0x70C45454UL, 0x01B1, 2},
+  {0x70C45454UL, 0x0214, 5},
+  {0x70C45454UL, 0x0256, 4},
+  {0x70C45454UL, 0x0257, 2},
+  {0x70C45454UL, 0x0277, 4},
+  {0x70C45454UL, 0x02B8, 4},
+  {0x70C45454UL, 0x02B9, 3},
+  {0x771C2FADUL, 0x01F2, 1},
+  {0x771C2FADUL, 0x0214, 3},
+  {0x771C2FADUL, 0x0215, 1},
+  {0x771C2FADUL, 0x0235, 4},
+  {0x771C2FADUL, 0x0236, 1},
+  {0x771C2FADUL, 0x02FA, 5},
+  {0x771C2FADUL, 0x02FB, 3},
+  {0x77F5777CUL, 0x0190, 2},
+  {0x77F5777CUL, 0x01B0, 3},
+  {0x77F5777CUL, 0x0256, 3},
+  {0x77F5777CUL, 0x0257, 5},
+  {0x77F5777CUL, 0x0277, 4},
+  {0x7A6FF732UL, 0x0190, 2},
+  {0x7A6FF732UL, 0x0235, 3},
+  {0x7A6FF732UL, 0x0256, 10},
+  {0x7A6FF732UL, 0x0257, 2},
+  {0x7A6FF732UL, 0x0277, 10},
+  {0x7A6FF732UL, 0x0298, 7},
+  {0x7AA753A1UL, 0x01B1, 2},
+  {0x7AA753A1UL, 0x01D1, 6},
+  {0x7AA753A1UL, 0x0214, 3},
+  {0x7AA753A1UL, 0x0256, 1},
+  {0x7AA753A1UL, 0x0257, 2},
+  {0x7AA753A1UL, 0x0277, 6},
+  {0x7AA753A1UL, 0x02B8, 4},
+  {0x7AA753A1UL, 0x02B9, 3},
+  {0x7B4F1EBFUL, 0x0219, 5},
+  {0x7B4F1EBFUL, 0x0238, 9},
+  {0x7EBA8232UL, 0x0188, 21},
+  {0x7EBA8232UL, 0x01A8, 22},
+  {0x7EBA8232UL, 0x01A9, 17},
+  {0x7EBA8232UL, 0x01C9, 17},
+  {0x7EBA8232UL, 0x01CA, 25},
+  {0x7EBA8232UL, 0x01EA, 15},
+  {0x7EBA8232UL, 0x01EB, 16},
+  {0x7F360117UL, 0x0188, 24},
+  {0x7F360117UL, 0x01A8, 23},
+  {0x7F360117UL, 0x01A9, 16},
+  {0x7F360117UL, 0x01C9, 26},
+  {0x7F360117UL, 0x01CA, 24},
+  {0x7F360117UL, 0x01EA, 20},
+  {0x7F360117UL, 0x01EB, 23},
+  {0x81C73D5DUL, 0x0190, 3},
+  {0x81C73D5DUL, 0x0236, 4},
+  {0x81C73D5DUL, 0x0256, 1},
+  {0x81C73D5DUL, 0x0257, 1},
+  {0x81C73D5DUL, 0x0277, 5},
+  {0x81C73D5DUL, 0x02B8, 5},
+  {0x81C73D5DUL, 0x02B9, 4},
+  {0x85D3FCCBUL, 0x0214, 4},
+  {0x85D3FCCBUL, 0x0215, 3},
+  {0x85D3FCCBUL, 0x0235, 4},
+  {0x85D3FCCBUL, 0x0236, 4},
+  {0x85D3FCCBUL, 0x0256, 4},
+  {0x85D3FCCBUL, 0x02FA, 6},
+  {0x85D3FCCBUL, 0x02FB, 3},
+  {0x8649332AUL, 0x01D2, 2},
+  {0x8649332AUL, 0x0214, 1},
+  {0x8649332AUL, 0x0215, 2},
+  {0x8649332AUL, 0x0277, 4},
+  {0x8649332AUL, 0x02D9, 1},
+  {0x8649332AUL, 0x02DA, 6},
+  {0x87C5B00FUL, 0x01D1, 3},
+  {0x87C5B00FUL, 0x0215, 1},
+  {0x87C5B00FUL, 0x0257, 4},
+  {0x87C5B00FUL, 0x0277, 2},
+  {0x87C5B00FUL, 0x02D9, 3},
+  {0x87C5B00FUL, 0x02DA, 4},
+  {0x87F7AACCUL, 0x01A9, 3},
+  {0x87F7AACCUL, 0x01C9, 2},
+  {0x87F7AACCUL, 0x01CA, 2},
+  {0x87F7AACCUL, 0x01EB, 2},
+  {0x8C5DBD13UL, 0x0190, 4},
+  {0x8C5DBD13UL, 0x0236, 2},
+  {0x8C5DBD13UL, 0x0256, 4},
+  {0x8C5DBD13UL, 0x0257, 4},
+  {0x8C5DBD13UL, 0x0277, 4},
+  {0x8C5DBD13UL, 0x02B8, 1},
+  {0x8C5DBD13UL, 0x02B9, 3},
+  {0x8E3D2541UL, 0x01D2, 4},
+  {0x8E3D2541UL, 0x0214, 2},
+  {0x8E3D2541UL, 0x0215, 3},
+  {0x8E3D2541UL, 0x0235, 2},
+  {0x8E3D2541UL, 0x0277, 2},
+  {0x8E3D2541UL, 0x02D9, 1},
+  {0x8E3D2541UL, 0x02DA, 6},
+  {0x8FB0FB3EUL, 0x0214, 1},
+  {0x8FB0FB3EUL, 0x0215, 6},
+  {0x8FB0FB3EUL, 0x0235, 5},
+  {0x8FB0FB3EUL, 0x0236, 2},
+  {0x8FB0FB3EUL, 0x0256, 7},
+  {0x8FB0FB3EUL, 0x02FA, 2},
+  {0x8FB0FB3EUL, 0x02FB, 3},
+  {0x8FB1A664UL, 0x01B1, 1},
+  {0x8FB1A664UL, 0x0215, 1},
+  {0x8FB1A664UL, 0x0257, 3},
+  {0x8FB1A664UL, 0x0277, 1},
+  {0x8FB1A664UL, 0x02D9, 4},
+  {0x8FB1A664UL, 0x02DA, 5},
+  {0x904E34B4UL, 0x0214, 3},
+  {0x904E34B4UL, 0x0215, 2},
+  {0x904E34B4UL, 0x0235, 1},
+  {0x904E34B4UL, 0x0236, 3},
+  {0x904E34B4UL, 0x02FA, 1},
+  {0x904E34B4UL, 0x02FB, 1},
+  {0x956D14FDUL, 0x0214, 3},
+  {0x956D14FDUL, 0x0215, 3},
+  {0x956D14FDUL, 0x0235, 3},
+  {0x956D14FDUL, 0x0236, 5},
+  {0x956D14FDUL, 0x0256, 1},
+  {0x956D14FDUL, 0x02FA, 2},
+  {0x956D14FDUL, 0x02FB, 2},
+  {0x977B5839UL, 0x01B1, 2},
+  {0x977B5839UL, 0x0214, 6},
+  {0x977B5839UL, 0x0215, 1},
+  {0x977B5839UL, 0x0257, 3},
+  {0x977B5839UL, 0x0277, 2},
+  {0x977B5839UL, 0x02DA, 3},
+  {0x983A22DFUL, 0x0214, 1},
+  {0x983A22DFUL, 0x0235, 2},
+  {0x983A22DFUL, 0x0236, 1},
+  {0x983A22DFUL, 0x0256, 3},
+  {0x983A22DFUL, 0x02FB, 1},
+  {0x99058E5FUL, 0x0188, 27},
+  {0x99058E5FUL, 0x01A8, 22},
+  {0x99058E5FUL, 0x01A9, 21},
+  {0x99058E5FUL, 0x01C9, 24},
+  {0x99058E5FUL, 0x01CA, 22},
+  {0x99058E5FUL, 0x01EA, 17},
+  {0x99058E5FUL, 0x01EB, 21},
+  {0x9B2A6E61UL, 0x01A6, 11},
+  {0x9B2A6E61UL, 0x01C5, 7},
+  {0x9C94DCE9UL, 0x01D2, 4},
+  {0x9C94DCE9UL, 0x0215, 7},
+  {0x9C94DCE9UL, 0x0235, 4},
+  {0x9C94DCE9UL, 0x0277, 4},
+  {0x9C94DCE9UL, 0x02D9, 2},
+  {0x9C94DCE9UL, 0x02DA, 3},
+  {0x9D185FCCUL, 0x01B1, 5},
+  {0x9D185FCCUL, 0x01D1, 4},
+  {0x9D185FCCUL, 0x0215, 4},
+  {0x9D185FCCUL, 0x0277, 4},
+  {0x9D185FCCUL, 0x02D9, 3},
+  {0x9D185FCCUL, 0x02DA, 1},
+  {0xA2377AAEUL, 0x01D2, 2},
+  {0xA2377AAEUL, 0x0214, 4},
+  {0xA2377AAEUL, 0x0215, 2},
+  {0xA2377AAEUL, 0x0235, 2},
+  {0xA2377AAEUL, 0x0236, 3},
+  {0xA2377AAEUL, 0x02FA, 2},
+  {0xA2377AAEUL, 0x02FB, 4},
+  {0xA2F3F4F9UL, 0x0214, 3},
+  {0xA2F3F4F9UL, 0x0215, 1},
+  {0xA2F3F4F9UL, 0x0257, 2},
+  {0xA2F3F4F9UL, 0x0277, 3},
+  {0xA2F3F4F9UL, 0x02D9, 3},
+  {0xA2F3F4F9UL, 0x02DA, 4},
+  {0xA343E1E7UL, 0x01A6, 7},
+  {0xA343E1E7UL, 0x01C5, 14},
+  {0xA7391906UL, 0x0146, 2},
+  {0xA7391906UL, 0x0147, 2},
+  {0xA7391906UL, 0x01A9, 3},
+  {0xA7391906UL, 0x022E, 1},
+  {0xA7391906UL, 0x024E, 1},
+  {0xA890F30CUL, 0x0215, 1},
+  {0xA890F30CUL, 0x0235, 2},
+  {0xA890F30CUL, 0x0257, 1},
+  {0xA890F30CUL, 0x0277, 3},
+  {0xA890F30CUL, 0x02D9, 1},
+  {0xA890F30CUL, 0x02DA, 4},
+  {0xA9616A33UL, 0x0214, 4},
+  {0xA9616A33UL, 0x0235, 4},
+  {0xA9A5DEADUL, 0x0185, 11},
+  {0xA9A5DEADUL, 0x01A4, 11},
+  {0xAA436CC5UL, 0x01D2, 2},
+  {0xAA436CC5UL, 0x0215, 1},
+  {0xAA436CC5UL, 0x0235, 4},
+  {0xAA436CC5UL, 0x0236, 5},
+  {0xAA436CC5UL, 0x02FA, 4},
+  {0xAA436CC5UL, 0x02FB, 3},
+  {0xB4307D30UL, 0x0214, 1},
+  {0xB4307D30UL, 0x0215, 1},
+  {0xB4307D30UL, 0x0235, 1},
+  {0xB4307D30UL, 0x0257, 2},
+  {0xB4307D30UL, 0x0277, 1},
+  {0xB4307D30UL, 0x02D9, 1},
+  {0xB4307D30UL, 0x02DA, 3},
+  {0xB8EA956DUL, 0x0215, 5},
+  {0xB8EA956DUL, 0x0235, 6},
+  {0xB8EA956DUL, 0x0236, 2},
+  {0xB8EA956DUL, 0x02FA, 6},
+  {0xB8EA956DUL, 0x02FB, 2},
+  {0xBC446B5BUL, 0x0214, 4},
+  {0xBC446B5BUL, 0x0215, 2},
+  {0xBC446B5BUL, 0x0235, 1},
+  {0xBC446B5BUL, 0x0277, 2},
+  {0xBC446B5BUL, 0x02D9, 1},
+  {0xBC446B5BUL, 0x02DA, 1},
+  {0xBED9E3B2UL, 0x0214, 4},
+  {0xBED9E3B2UL, 0x0236, 1},
+  {0xBED9E3B2UL, 0x0256, 1},
+  {0xBED9E3B2UL, 0x0257, 3},
+  {0xBED9E3B2UL, 0x02B8, 2},
+  {0xBEE432FBUL, 0x0215, 1},
+  {0xBEE432FBUL, 0x0235, 2},
+  {0xBEE432FBUL, 0x0236, 2},
+  {0xBEE432FBUL, 0x0256, 3},
+  {0xBEE432FBUL, 0x0277, 4},
+  {0xBEE432FBUL, 0x0298, 2},
+  {0xBF5427E5UL, 0x01A6, 10},
+  {0xBF5427E5UL, 0x01C5, 16},
+  {0xC4B03A51UL, 0x0190, 3},
+  {0xC4B03A51UL, 0x01B0, 1},
+  {0xC4B03A51UL, 0x0236, 2},
+  {0xC4B03A51UL, 0x0256, 4},
+  {0xC4B03A51UL, 0x0257, 3},
+  {0xC4B03A51UL, 0x0277, 1},
+  {0xC4B03A51UL, 0x02B8, 2},
+  {0xC4B03A51UL, 0x02B9, 2},
+  {0xC4CB5BEFUL, 0x0146, 1},
+  {0xC4CB5BEFUL, 0x0147, 1},
+  {0xC4CB5BEFUL, 0x0188, 3},
+  {0xC4CB5BEFUL, 0x01A8, 1},
+  {0xC4CB5BEFUL, 0x01A9, 1},
+  {0xC4CB5BEFUL, 0x01C9, 1},
+  {0xC4CB5BEFUL, 0x026F, 2},
+  {0xC5CB7152UL, 0x0104, 2},
+  {0xC5CB7152UL, 0x0105, 2},
+  {0xC5CB7152UL, 0x0126, 1},
+  {0xC5CB7152UL, 0x01EB, 3},
+  {0xC75C2126UL, 0x01D1, 5},
+  {0xC75C2126UL, 0x0215, 6},
+  {0xC75C2126UL, 0x0257, 1},
+  {0xC75C2126UL, 0x0277, 3},
+  {0xC75C2126UL, 0x02DA, 1},
+  {0xCB4A224DUL, 0x01D2, 4},
+  {0xCB4A224DUL, 0x0214, 2},
+  {0xCB4A224DUL, 0x0215, 4},
+  {0xCB4A224DUL, 0x0235, 4},
+  {0xCB4A224DUL, 0x0277, 1},
+  {0xCB4A224DUL, 0x02D9, 5},
+  {0xCB4A224DUL, 0x02DA, 3},
+  {0xCCBF4D84UL, 0x0125, 3},
+  {0xCCBF4D84UL, 0x0126, 1},
+  {0xCCBF4D84UL, 0x0188, 2},
+  {0xCCBF4D84UL, 0x01EB, 1},
+  {0xCCBF4D84UL, 0x020D, 1},
+  {0xCE13D468UL, 0x0188, 21},
+  {0xCE13D468UL, 0x01A8, 34},
+  {0xCE13D468UL, 0x01A9, 21},
+  {0xCE13D468UL, 0x01C9, 18},
+  {0xCE13D468UL, 0x01CA, 17},
+  {0xCE13D468UL, 0x01EA, 23},
+  {0xCE13D468UL, 0x01EB, 17},
+  {0xD5F485D4UL, 0x0214, 4},
+  {0xD5F485D4UL, 0x0215, 3},
+  {0xD5F485D4UL, 0x0235, 2},
+  {0xD5F485D4UL, 0x0236, 1},
+  {0xD5F485D4UL, 0x0256, 10},
+  {0xD5F485D4UL, 0x02FA, 2},
+  {0xD5F485D4UL, 0x02FB, 4},
+  {0xD619C3F9UL, 0x01B0, 1},
+  {0xD619C3F9UL, 0x0236, 4},
+  {0xD619C3F9UL, 0x0256, 7},
+  {0xD619C3F9UL, 0x0257, 3},
+  {0xD619C3F9UL, 0x0277, 2},
+  {0xD619C3F9UL, 0x02B8, 3},
+  {0xD619C3F9UL, 0x02B9, 6},
+  {0xD662A247UL, 0x0104, 2},
+  {0xD662A247UL, 0x0105, 1},
+  {0xD662A247UL, 0x01A9, 1},
+  {0xD662A247UL, 0x01C9, 2},
+  {0xD662A247UL, 0x01EA, 1},
+  {0xD662A247UL, 0x01EB, 2},
+  {0xD86E059AUL, 0x0214, 3},
+  {0xD86E059AUL, 0x0215, 1},
+  {0xD86E059AUL, 0x0235, 3},
+  {0xD86E059AUL, 0x0256, 1},
+  {0xD86E059AUL, 0x02FA, 2},
+  {0xD86E059AUL, 0x02FB, 1},
+  {0xD9EA76B9UL, 0x0104, 2},
+  {0xD9EA76B9UL, 0x0105, 1},
+  {0xD9EA76B9UL, 0x01A9, 2},
+  {0xD9EA76B9UL, 0x01CA, 2},
+  {0xD9EA76B9UL, 0x01EA, 2},
+  {0xD9EA76B9UL, 0x01EB, 2},
+  {0xDB8BB3B1UL, 0x0167, 2},
+  {0xDB8BB3B1UL, 0x0188, 4},
+  {0xDB8BB3B1UL, 0x01A9, 2},
+  {0xDC7AC40CUL, 0x0190, 2},
+  {0xDC7AC40CUL, 0x01B0, 2},
+  {0xDC7AC40CUL, 0x0236, 2},
+  {0xDC7AC40CUL, 0x0256, 3},
+  {0xDC7AC40CUL, 0x0257, 1},
+  {0xDC7AC40CUL, 0x0277, 2},
+  {0xDC7AC40CUL, 0x02B8, 5},
+  {0xDC7AC40CUL, 0x02B9, 4},
+  {0xE247B356UL, 0x0190, 1},
+  {0xE247B356UL, 0x01B0, 3},
+  {0xE247B356UL, 0x0235, 6},
+  {0xE247B356UL, 0x0256, 1},
+  {0xE247B356UL, 0x0257, 1},
+  {0xE247B356UL, 0x0277, 3},
+  {0xE247B356UL, 0x0298, 2},
+  {0xE89FCB37UL, 0x023A, 6},
+  {0xE89FCB37UL, 0x0259, 2},
+  {0xEE9FADBCUL, 0x0236, 5},
+  {0xEE9FADBCUL, 0x0257, 4},
+  {0xEF346BC9UL, 0x0214, 3},
+  {0xEF346BC9UL, 0x0215, 4},
+  {0xEF346BC9UL, 0x0235, 4},
+  {0xEF346BC9UL, 0x0236, 3},
+  {0xEF346BC9UL, 0x02FB, 2},
+  {0xF260B612UL, 0x0235, 2},
+  {0xF260B612UL, 0x0236, 2},
+  {0xF260B612UL, 0x0257, 2},
+  {0xF260B612UL, 0x031D, 2},
+  {0xF2886BBEUL, 0x0257, 8},
+  {0xF4BB95EBUL, 0x01C7, 15},
+  {0xF4BB95EBUL, 0x01E6, 7},
+  {0xF928B821UL, 0x0214, 1},
+  {0xF928B821UL, 0x0236, 1},
+  {0xF928B821UL, 0x0256, 4},
+  {0xF928B821UL, 0x0257, 2},
+  {0xF928B821UL, 0x0277, 3},
+  {0xF928B821UL, 0x02B8, 1},
+  {0xF928B821UL, 0x02B9, 3},
+};
+
+#endif
@@ -0,0 +1,487 @@
+/*
+  Endgame databases: the indexing of positions within their slices, and
+  the decoding of a database file's blocks (see endgame.h).
+*/
+
+#include <stddef.h>
+#include "progmem.h"
+#include "rules.h"
+#include "endgame.h"
+
+// the squares below row 1, which a blue man cannot stand on
+#define BLUE_MAN_SKIPPED 0x0000000FUL
+
+// binomial coefficients, n choose k, for the ranking of sets of squares,
+// worked out by the compiler
+
+static constexpr uint32_t binomial(int n, int k)
+{
+  return (k == 0) ? 1 : (n < k) ? 0 : (binomial(n - 1, k - 1) * n) / k;
+}
+
+#define BINOMIAL_ROW(n) {binomial(n, 0), binomial(n, 1), binomial(n, 2), \
+      binomial(n, 3), binomial(n, 4), binomial(n, 5), binomial(n, 6)}
+
+static const uint32_t BINOMIALS[NUM_SQUARES + 1][MAX_ENDGAME_PIECES + 1]
+PROGMEM = {
+  BINOMIAL_ROW(0), BINOMIAL_ROW(1), BINOMIAL_ROW(2), BINOMIAL_ROW(3),
+  BINOMIAL_ROW(4), BINOMIAL_ROW(5), BINOMIAL_ROW(6), BINOMIAL_ROW(7),
+  BINOMIAL_ROW(8), BINOMIAL_ROW(9), BINOMIAL_ROW(10), BINOMIAL_ROW(11),
+  BINOMIAL_ROW(12), BINOMIAL_ROW(13), BINOMIAL_ROW(14), BINOMIAL_ROW(15),
+  BINOMIAL_ROW(16), BINOMIAL_ROW(17), BINOMIAL_ROW(18), BINOMIAL_ROW(19),
+  BINOMIAL_ROW(20), BINOMIAL_ROW(21), BINOMIAL_ROW(22), BINOMIAL_ROW(23),
+  BINOMIAL_ROW(24), BINOMIAL_ROW(25), BINOMIAL_ROW(26), BINOMIAL_ROW(27),
+  BINOMIAL_ROW(28), BINOMIAL_ROW(29), BINOMIAL_ROW(30), BINOMIAL_ROW(31),
+  BINOMIAL_ROW(32)
+};
+
+static uint32_t choose(uint8_t n, uint8_t k)
+{
+  return pgm_read_dword(&BINOMIALS[n][k]);
+}
+
+
+// turning the board around
+
+static uint32_t turn_around(uint32_t squares)
+{
+  // the set of squares seen from the other side of the board, which takes
+  // square s to square 31 - s: the bits reversed
+  squares = ((squares >> 1) & 0x55555555UL) | ((squares & 0x55555555UL) << 1);
+  squares = ((squares >> 2) & 0x33333333UL) | ((squares & 0x33333333UL) << 2);
+  squares = ((squares >> 4) & 0x0F0F0F0FUL) | ((squares & 0x0F0F0F0FUL) << 4);
+  squares = ((squares >> 8) & 0x00FF00FFUL) | ((squares & 0x00FF00FFUL) << 8);
+  return (squares >> 16) | (squares << 16);
+}
+
+void flip_board(Board* board)
+{
+  // turns a board around and swaps the colors of the checkers
+  uint32_t red = board->red;
+
+  board->red = turn_around(board->blue);
+  board->blue = turn_around(red);
+  board->kings = turn_around(board->kings);
+  board->key = compute_key(board);
+}
+
+
+// slices
+
+uint8_t board_material(const Board* board, Material* material)
+{
+  /*
+    counts the checkers on a board, where:
+
+    board: the checker board
+    material: set to the material on the board
+   */
+  material->red_men = __builtin_popcountl(board->red & ~board->kings);
+  material->red_kings = __builtin_popcountl(board->red & board->kings);
+  material->blue_men = __builtin_popcountl(board->blue & ~board->kings);
+  material->blue_kings = __builtin_popcountl(board->blue & board->kings);
+  return material->red_men + material->red_kings + material->blue_men +
+    material->blue_kings;
+}
+
+uint32_t slice_positions(const Material* material)
+{
+  // the number of indices in a slice (see endgame_index)
+  uint8_t free_squares = NUM_SQUARES - material->red_men -
+    material->blue_men;
+
+  return choose(MAN_SQUARES, material->red_men) *
+    choose(MAN_SQUARES, material->blue_men) *
+    choose(free_squares, material->red_kings) *
+    choose(free_squares - material->red_kings, material->blue_kings);
+}
+
+uint16_t count_slices(uint8_t pieces)
+{
+  // the number of slices with at most the given number of checkers
+  uint16_t count = 0;
+
+  for (uint8_t total = 2; total <= pieces; total++){
+    for (uint8_t red_men = 0; red_men <= total; red_men++){
+      for (uint8_t red_kings = 0; red_men + red_kings <= total; red_kings++){
+	uint8_t blue = total - red_men - red_kings;
+	if (red_men + red_kings && blue){
+	  count += blue + 1; // the ways to split the blue checkers
+	}
+      }
+    }
+  }
+  return count;
+}
+
+uint16_t slice_number(const Material* material)
+{
+  // the number of a slice in the directory of a database file, counting
+  // the slices before it in the order of endgame.h
+  uint8_t total = material->red_men + material->red_kings +
+    material->blue_men + material->blue_kings;
+  uint16_t number = count_slices(total - 1);
+
+  for (uint8_t red_men = 0; red_men < material->red_men; red_men++){
+    for (uint8_t red_kings = 0; red_men + red_kings <= total; red_kings++){
+      uint8_t blue = total - red_men - red_kings;
+      if (red_men + red_kings && blue){
+	number += blue + 1;
+      }
+    }
+  }
+  for (uint8_t red_kings = 0; red_kings < material->red_kings; red_kings++){
+    uint8_t blue = total - material->red_men - red_kings;
+    if (material->red_men + red_kings && blue){
+      number += blue + 1;
+    }
+  }
+  return number + material->blue_men;
+}
+
+
+// indexing
+
+static uint32_t rank_squares(uint32_t squares, uint32_t skipped)
+{
+  /*
+    ranks a set of squares among all the sets of as many squares (in the
+    combinatorial number system), where:
+
+    squares: the set to rank
+    skipped: squares the set cannot hold, which are left out of the
+      numbering of the rest
+   */
+  uint32_t rank = 0;
+
+  for (uint8_t i = 1; squares; i++){
+    uint8_t square = FIRST_SQUARE(squares);
+    uint8_t place = square -
+      __builtin_popcountl(skipped & (SQUARE_BIT(square) - 1));
+    rank += choose(place, i);
+    squares &= squares - 1;
+  }
+  return rank;
+}
+
+static uint32_t unrank_squares(uint32_t rank, uint8_t count,
+			       uint32_t skipped)
+{
+  // the set of count squares with the given rank, the reverse of
+  // rank_squares
+  uint32_t squares = 0;
+
+  for (uint8_t i = count; i > 0; i--){
+    uint8_t place = i - 1;
+    while (choose(place + 1, i) <= rank){
+      place++;
+    }
+    rank -= choose(place, i);
+
+    // the place-th square, counting from 0, that is not skipped
+    uint8_t square = 0;
+    while (place || (skipped & SQUARE_BIT(square))){
+      if (!(skipped & SQUARE_BIT(square))){
+	place--;
+      }
+      square++;
+    }
+    squares |= SQUARE_BIT(square);
+  }
+  return squares;
+}
+
+uint32_t endgame_index(const Board* board, const Material* material)
+{
+  /*
+    numbers a position with red to move within its slice, where:
+
+    board: the position
+    material: the material on the board (see board_material)
+   */
+  uint32_t red_men = board->red & ~board->kings;
+  uint32_t blue_men = board->blue & ~board->kings;
+  uint32_t men = red_men | blue_men;
+  uint8_t free_squares = NUM_SQUARES - material->red_men -
+    material->blue_men;
+
+  uint32_t index = rank_squares(red_men, 0);
+  index = (index * choose(MAN_SQUARES, material->blue_men)) +
+    rank_squares(blue_men, BLUE_MAN_SKIPPED);
+  index = (index * choose(free_squares, material->red_kings)) +
+    rank_squares(board->red & board->kings, men);
+  index = (index * choose(free_squares - material->red_kings,
+			  material->blue_kings)) +
+    rank_squares(board->blue & board->kings, men | board->red);
+  return index;
+}
+
+uint8_t endgame_position(const Material* material, uint32_t index,
+			 Board* board)
+{
+  /*
+    sets up the position with the given index in a slice, the reverse of
+    endgame_index, where:
+
+    material: the material of the slice
+    index: the index, less than slice_positions
+    board: set to the position
+   */
+  uint8_t free_squares = NUM_SQUARES - material->red_men -
+    material->blue_men;
+  uint32_t radix;
+
+  radix = choose(free_squares - material->red_kings, material->blue_kings);
+  uint32_t blue_kings_rank = index % radix;
+  index /= radix;
+  radix = choose(free_squares, material->red_kings);
+  uint32_t red_kings_rank = index % radix;
+  index /= radix;
+  radix = choose(MAN_SQUARES, material->blue_men);
+  uint32_t blue_men = unrank_squares(index % radix, material->blue_men,
+				     BLUE_MAN_SKIPPED);
+  uint32_t red_men = unrank_squares(index / radix, material->red_men, 0);
+  if (red_men & blue_men){
+    return 0;
+  }
+
+  uint32_t red_kings = unrank_squares(red_kings_rank, material->red_kings,
+				      red_men | blue_men);
+  uint32_t blue_kings = unrank_squares(blue_kings_rank, material->blue_kings,
+				       red_men | blue_men | red_kings);
+  board->red = red_men | red_kings;
+  board->blue = blue_men | blue_kings;
+  board->kings = red_kings | blue_kings;
+  board->key = compute_key(board);
+  return 1;
+}
+
+
+// blocks
+
+uint32_t index_entry(const uint8_t* index, uint8_t entry)
+{
+  // a number from a block of a block index, read little-endian whatever
+  // the host
+  const uint8_t* bytes = &index[4 * entry];
+
+  return bytes[0] | ((uint32_t) bytes[1] << 8) |
+    ((uint32_t) bytes[2] << 16) | ((uint32_t) bytes[3] << 24);
+}
+
+uint8_t find_block(const uint8_t* index, uint32_t position)
+{
+  /*
+    finds the data block holding a position among those of the block of a
+    slice's block index that covers it, where:
+
+    index: the block of the index
+    position: the position's index
+   */
+  uint8_t low = 1;
+  uint8_t high = ENDGAME_INDEX_ENTRIES;
+
+  // the last entry at or before the position, by bisection; the padding
+  // after the last data block is after every position
+  while (low < high){
+    uint8_t middle = low + ((high - low + 1) / 2);
+    if (index_entry(index, middle) <= position){
+      low = middle;
+    }
+    else {
+      high = middle - 1;
+    }
+  }
+  return low;
+}
+
+uint8_t block_value(const uint8_t* block, uint32_t offset)
+{
+  /*
+    the value of a position in a block of a database file, where:
+
+    block: the block, ENDGAME_BLOCK bytes of literals and runs
+    offset: the position's index less the index of the first position in
+      the block
+   */
+  uint16_t i = 0;
+
+  while (i < ENDGAME_BLOCK){
+    uint8_t control = block[i++];
+
+    if (!(control & ENDGAME_RUN)){
+      // a literal of control + 1 values
+      if (offset <= control){
+	return (i + offset < ENDGAME_BLOCK) ? block[i + offset] :
+	  ENDGAME_DRAW;
+      }
+      offset -= control + 1;
+      i += control + 1;
+      continue;
+    }
+
+    uint32_t run = control & ~(ENDGAME_RUN | ENDGAME_RUN_MORE);
+    uint8_t shift = 6;
+    uint8_t more = control & ENDGAME_RUN_MORE;
+    while (more && i < ENDGAME_BLOCK){
+      uint8_t byte = block[i++];
+      run |= ((uint32_t) (byte & 0x7F)) << shift;
+      shift += 7;
+      more = byte & 0x80;
+    }
+    if (i >= ENDGAME_BLOCK){
+      break;
+    }
+    uint8_t value = block[i++];
+    run += ENDGAME_MIN_RUN;
+    if (offset < run){
+      return value;
+    }
+    offset -= run;
+  }
+  return ENDGAME_DRAW; // past the end of the block: a corrupt file
+}
+
+
+// the bitbase's symmetry
+
+// an ending of kings alone looks the same with the board turned around, the
+// only symmetry the board has: reflected, the king rows that end a capture
+// sequence would become columns
+#define MAX_ANCHOR_KINGS 2 // the most kings in an anchor (see endgame.h)
+#define SQUARE_ORBIT_COUNT 16 // the orbits of one square, its first half
+#define PAIR_ORBIT_COUNT 256 // the orbits of two squares
+
+// a pair of squares is the first of its orbit when its rank is no higher
+// than that of the pair turned around; orbits are numbered in the order of
+// their first pairs
+
+static constexpr uint16_t pair_rank(uint8_t low, uint8_t high)
+{
+  return (low < high) ? low + ((high * (high - 1)) / 2) :
+    high + ((low * (low - 1)) / 2);
+}
+
+static constexpr uint8_t first_pair(uint8_t low, uint8_t high)
+{
+  return pair_rank(low, high) <=
+    pair_rank(NUM_SQUARES - 1 - low, NUM_SQUARES - 1 - high);
+}
+
+static constexpr uint8_t pair_high(uint16_t rank, uint8_t high)
+{
+  // the higher square of the pair with the given rank, counting up from a
+  // guess that is not too high
+  return ((high * (high + 1)) / 2 <= rank) ? pair_high(rank, high + 1) :
+    high;
+}
+
+static constexpr uint8_t row_orbits(uint8_t low, uint8_t high)
+{
+  // the orbits first reached by the pairs of high and a square below low
+  return low ? row_orbits(low - 1, high) + first_pair(low - 1, high) : 0;
+}
+
+static constexpr uint16_t rows_orbits(uint8_t high)
+{
+  // the orbits first reached by the pairs of squares below high
+  return (high > 1) ? rows_orbits(high - 1) +
+    row_orbits(high - 1, high - 1) : 0;
+}
+
+static constexpr uint8_t pair_orbit(uint16_t rank)
+{
+  // the number of the orbit of a pair, if it is the first of it; counted
+  // a row at a time to keep the compiler's recursion shallow
+  return rows_orbits(pair_high(rank, 1)) +
+    row_orbits(rank - ((pair_high(rank, 1) * (pair_high(rank, 1) - 1)) / 2),
+	       pair_high(rank, 1));
+}
+
+static_assert(rows_orbits(NUM_SQUARES) == PAIR_ORBIT_COUNT,
+	      "orbits of two squares");
+
+#define PAIR_ORBITS4(rank) pair_orbit(rank), pair_orbit((rank) + 1), \
+    pair_orbit((rank) + 2), pair_orbit((rank) + 3)
+#define PAIR_ORBITS16(rank) PAIR_ORBITS4(rank), PAIR_ORBITS4((rank) + 4), \
+    PAIR_ORBITS4((rank) + 8), PAIR_ORBITS4((rank) + 12)
+
+static const uint8_t PAIR_ORBITS[(NUM_SQUARES * (NUM_SQUARES - 1)) / 2]
+PROGMEM = {
+  PAIR_ORBITS16(0), PAIR_ORBITS16(16), PAIR_ORBITS16(32), PAIR_ORBITS16(48),
+  PAIR_ORBITS16(64), PAIR_ORBITS16(80), PAIR_ORBITS16(96),
+  PAIR_ORBITS16(112), PAIR_ORBITS16(128), PAIR_ORBITS16(144),
+  PAIR_ORBITS16(160), PAIR_ORBITS16(176), PAIR_ORBITS16(192),
+  PAIR_ORBITS16(208), PAIR_ORBITS16(224), PAIR_ORBITS16(240),
+  PAIR_ORBITS16(256), PAIR_ORBITS16(272), PAIR_ORBITS16(288),
+  PAIR_ORBITS16(304), PAIR_ORBITS16(320), PAIR_ORBITS16(336),
+  PAIR_ORBITS16(352), PAIR_ORBITS16(368), PAIR_ORBITS16(384),
+  PAIR_ORBITS16(400), PAIR_ORBITS16(416), PAIR_ORBITS16(432),
+  PAIR_ORBITS16(448), PAIR_ORBITS16(464), PAIR_ORBITS16(480)
+};
+
+static const uint16_t KING_ORBITS[MAX_ANCHOR_KINGS + 1] = {
+  1, SQUARE_ORBIT_COUNT, PAIR_ORBIT_COUNT
+};
+
+static uint8_t anchor_kings(const Material* material)
+{
+  // the kings of the side with fewer (red, if neither), whose orbit
+  // numbers a bitbase position, or 0 if the slice is not reduced
+  uint8_t anchor = (material->red_kings <= material->blue_kings) ?
+    material->red_kings : material->blue_kings;
+
+  return (!material->red_men && !material->blue_men &&
+	  anchor <= MAX_ANCHOR_KINGS) ? anchor : 0;
+}
+
+uint32_t bitbase_positions(const Material* material)
+{
+  // the number of indices in a slice of the bitbase (see bitbase_index)
+  uint8_t anchor = anchor_kings(material);
+
+  if (!anchor){
+    return slice_positions(material);
+  }
+  return KING_ORBITS[anchor] * choose(NUM_SQUARES - anchor,
+				      material->red_kings +
+				      material->blue_kings - anchor);
+}
+
+uint32_t bitbase_index(const Board* board, const Material* material)
+{
+  /*
+    numbers a position with red to move within its slice of the bitbase,
+    where:
+
+    board: the position
+    material: the material on the board (see board_material)
+   */
+  uint8_t anchor_count = anchor_kings(material);
+
+  if (!anchor_count){
+    return endgame_index(board, material);
+  }
+  uint32_t anchor = (material->red_kings <= material->blue_kings) ?
+    board->red : board->blue;
+  uint32_t others = (board->red | board->blue) & ~anchor;
+
+  // turn the board around if that takes the anchor to the first set of its
+  // orbit
+  uint32_t rank = rank_squares(anchor, 0);
+  uint32_t turned_rank = rank_squares(turn_around(anchor), 0);
+  if (turned_rank < rank){
+    rank = turned_rank;
+    anchor = turn_around(anchor);
+    others = turn_around(others);
+  }
+
+  // the first square of an orbit of one is in the first half of the board,
+  // and numbers the orbit itself
+  uint32_t orbit = (anchor_count == 1) ? rank :
+    pgm_read_byte(&PAIR_ORBITS[rank]);
+  uint8_t other_count = material->red_kings + material->blue_kings -
+    anchor_count;
+  return (orbit * choose(NUM_SQUARES - anchor_count, other_count)) +
+    rank_squares(others, anchor);
+}
@@ -0,0 +1,271 @@
+#ifndef _ENDGAME_H
+#define _ENDGAME_H
+
+/*
+  Endgame databases: the exact result of every position with a few checkers
+  left, worked out once on the host by host/tbgen.cpp and looked up during
+  play.  Like the rules, this is kept free of the TFT, the SD card and
+  Serial.
+
+  Positions are grouped into slices by their material: the red men, red
+  kings, blue men and blue kings on the board.  Only positions with red to
+  move are stored.  A position with blue to move is turned around first by
+  flip_board, which gives the same game with the colors swapped.  Within a
+  slice, endgame_index numbers the positions:
+    - the red men are ranked among the 28 squares a red man can stand on
+      (rows 0 to 6; on row 7 it would be a king);
+    - the blue men are ranked among rows 1 to 7 in the same way;
+    - the red kings are ranked among the squares the men leave free;
+    - the blue kings are ranked among the squares left after that.
+  So every position has its own index, and the only indices with no
+  position are the few where a red and a blue man would share a square.
+
+  The value of a position is one byte: ENDGAME_DRAW, or the number of
+  plies to the end of the game plus one.  The number of plies is even for a
+  loss for the player to move and odd for a win, so the byte is odd for a
+  loss and even for a win.
+
+  The database file is made of blocks of ENDGAME_BLOCK bytes, one SD card
+  sector each.  It starts with a directory: an EndgameHeader, then an
+  EndgameSlice for every slice up to the header's number of pieces, in the
+  order of slice_number, padded to a whole block.  Then come the slices,
+  in the same order, each with:
+    - its block index: one block for every index_positions positions,
+      starting with the number of the data block that holds the first of
+      them, then the first position in that data block and in each one
+      after it that starts among them, 32 bits each, padded with
+      ENDGAME_NO_POSITION;
+    - its data blocks: the values of consecutive positions, coded as runs
+      and literals (see block_value), as many as fit in each block.
+  The directory is read once, when the file is opened (see tablebase.h).
+  After that a probe looks up the slice, reads the one index block that
+  covers the position, finds its data block there (see find_block), and
+  decodes that one block: two blocks read, whatever the size of the
+  file.  All numbers in the file are little-endian, as on both the Mega
+  and the host.
+
+  The bitbase compiled into the sketch (see bitbase.h) keeps one bit a
+  position, and numbers its positions by bitbase_index.  That is
+  endgame_index, except in endings of kings alone, which look the same
+  with the board turned around (but not reflected, since capture
+  sequences end on the king rows).  There the side with fewer kings (red,
+  if neither) is the anchor: the board is turned around if that takes the
+  anchor's squares to the first set of their orbit, the orbit is
+  numbered, and the other side's kings are ranked among the remaining
+  squares.  Only anchors of one or two kings are reduced this way, which
+  is every such ending of up to four kings.
+*/
+
+#include <stdint.h>
+#include "rules.h"
+
+#define MAX_ENDGAME_PIECES 6 // the most checkers the indexing can handle
+#define MAN_SQUARES 28 // the squares a man of either color can stand on
+
+// values
+#define ENDGAME_DRAW 0
+#define ENDGAME_VALUE(plies) ((uint8_t) ((plies) + 1))
+#define ENDGAME_PLIES(value) ((value) - 1)
+#define ENDGAME_WON(value) ((value) && !((value) & 1))
+#define ENDGAME_LOST(value) ((value) & 1)
+#define MAX_ENDGAME_PLIES 253 // so that a value never reaches 0xFF
+
+// the database file
+#define ENDGAME_MAGIC 0x42544B43UL // "CKTB"
+#define ENDGAME_VERSION 3
+#define ENDGAME_BLOCK 512
+#define ENDGAME_INDEX_ENTRIES ((ENDGAME_BLOCK / 4) - 1) // after the number
+#define ENDGAME_NO_POSITION 0xFFFFFFFFUL // pads a block of the index
+
+// the coding of a data block (see block_value)
+#define ENDGAME_RUN 0x80      // a control byte starting a run, not a literal
+#define ENDGAME_RUN_MORE 0x40 // more bytes of the run's length follow
+#define ENDGAME_MIN_RUN 3     // the shortest run coded as one
+#define ENDGAME_MAX_LITERAL 128 // the most values in a literal
+
+/*
+  Struct for the material of a slice, where:
+
+  red_men, red_kings, blue_men, blue_kings: the number of each on the board
+*/
+typedef struct {
+  uint8_t red_men;
+  uint8_t red_kings;
+  uint8_t blue_men;
+  uint8_t blue_kings;
+} Material;
+
+/*
+  Struct for the start of a database file, 12 bytes, where:
+
+  magic:   ENDGAME_MAGIC
+  version: ENDGAME_VERSION
+  pieces:  the most checkers in any slice of the file
+  slices:  the number of EndgameSlice entries that follow
+*/
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t pieces;
+  uint8_t reserved;
+  uint32_t slices;
+} EndgameHeader;
+
+/*
+  Struct for a slice's entry in the directory of a database file, 24 bytes,
+  where:
+
+  material:        the material of the slice
+  positions:       the number of indices in the slice (see endgame_index)
+  index_block:     the block of the file its block index starts in,
+                   counting from the start of the file
+  first_block:     the block its values start in, likewise
+  blocks:          the number of blocks its values take
+  index_positions: the positions each block of its index covers
+*/
+typedef struct {
+  Material material;
+  uint32_t positions;
+  uint32_t index_block;
+  uint32_t first_block;
+  uint32_t blocks;
+  uint32_t index_positions;
+} EndgameSlice;
+
+
+/*
+  turns a board around and swaps the colors of the checkers, so that a
+  position with blue to move becomes the same position with red to move,
+  where:
+
+  board: the board, changed in place, with its key recomputed
+*/
+void flip_board(Board* board);
+
+
+/*
+  counts the checkers on a board, where:
+
+  board: the checker board
+  material: set to the material on the board
+
+  returns the number of checkers
+*/
+uint8_t board_material(const Board* board, Material* material);
+
+
+/*
+  the number of indices in a slice, where:
+
+  material: the material of the slice, at most MAX_ENDGAME_PIECES checkers
+*/
+uint32_t slice_positions(const Material* material);
+
+
+/*
+  the number of a slice in a database file's directory, where:
+
+  material: the material of the slice, with checkers on both sides
+
+  slices are ordered by their number of checkers, then by red men, red
+  kings, blue men and blue kings
+*/
+uint16_t slice_number(const Material* material);
+
+
+/*
+  the number of slices with at most the given number of checkers, which
+  is the size of a database file's directory
+*/
+uint16_t count_slices(uint8_t pieces);
+
+
+/*
+  numbers a position with red to move within its slice, where:
+
+  board: the position
+  material: the material on the board (see board_material)
+*/
+uint32_t endgame_index(const Board* board, const Material* material);
+
+
+/*
+  sets up the position with the given index in a slice, the reverse of
+  endgame_index, where:
+
+  material: the material of the slice
+  index: the index, less than slice_positions
+  board: set to the position
+
+  returns 0 if no position has the index, because a red and a blue man
+  would share a square
+*/
+uint8_t endgame_position(const Material* material, uint32_t index,
+			 Board* board);
+
+
+/*
+  a number from a block of a slice's block index, where:
+
+  index: the block of the index
+  entry: 0 for the number of its first data block, or 1 to
+    ENDGAME_INDEX_ENTRIES for the first position in that data block and
+    those after it
+
+  returns the number, or ENDGAME_NO_POSITION past the last data block
+*/
+uint32_t index_entry(const uint8_t* index, uint8_t entry);
+
+
+/*
+  finds the data block holding a position among those of the block of a
+  slice's block index that covers it, where:
+
+  index: the block of the index
+  position: the position's index
+
+  returns the entry of the last data block starting at or before the
+  position, from 1 (see index_entry)
+*/
+uint8_t find_block(const uint8_t* index, uint32_t position);
+
+
+/*
+  the number of indices in a slice of the bitbase, where:
+
+  material: the material of the slice
+*/
+uint32_t bitbase_positions(const Material* material);
+
+
+/*
+  numbers a position with red to move within its slice of the bitbase,
+  where:
+
+  board: the position
+  material: the material on the board (see board_material)
+
+  in endings of kings alone, a position and the same position turned
+  around share an index
+*/
+uint32_t bitbase_index(const Board* board, const Material* material);
+
+
+/*
+  the value of a position in a block of a database file, where:
+
+  block: the block; a sequence of
+    - literals: a control byte below ENDGAME_RUN holding the number of
+      values less one, then the values, a byte each;
+    - runs of at least ENDGAME_MIN_RUN equal values: a control byte with
+      ENDGAME_RUN set and the low 6 bits of the length less
+      ENDGAME_MIN_RUN, then, if ENDGAME_RUN_MORE is set, the rest of it 7
+      bits to a byte with the high bit set on all but the last byte, then
+      the value
+    so that short runs, which are most of them, cost a byte a value
+  offset: the position's index less the index of the first position in the
+    block
+*/
+uint8_t block_value(const uint8_t* block, uint32_t offset);
+
+#endif
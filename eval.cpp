@@ -0,0 +1,64 @@
+/*
+  The evaluation (see eval.h).  The weights are in eval_weights.h, written
+  by host/tune.cpp.
+*/
+
+#include "rules.h"
+#include "eval.h"
+#include "eval_weights.h"
+
+// each player's first row
+#define RED_BACK_RANK 0x0000000FUL
+#define BLUE_BACK_RANK 0xF0000000UL
+
+// rows 3 and 4, less squares 12 and 19 on the edges
+#define CENTER_SQUARES 0x0007E000UL
+
+void eval_features(const Board* board, int8_t turn, int8_t* features)
+{
+  /*
+    counts the terms of the evaluation in a position, where:
+
+    board: the checker board
+    turn: the player to move, TURN_RED or TURN_BLUE
+    features: set to each term, for the player to move less the other
+   */
+  uint32_t own = (turn == TURN_RED) ? board->red : board->blue;
+  uint32_t opp = (turn == TURN_RED) ? board->blue : board->red;
+  uint32_t own_back = (turn == TURN_RED) ? RED_BACK_RANK : BLUE_BACK_RANK;
+  uint32_t opp_back = (turn == TURN_RED) ? BLUE_BACK_RANK : RED_BACK_RANK;
+  uint32_t own_movers, opp_movers, jumpers;
+
+  compute_moves(board, turn, &own_movers, &jumpers);
+  compute_moves(board, -turn, &opp_movers, &jumpers);
+
+  features[EVAL_MEN] = __builtin_popcountl(own & ~board->kings) -
+    __builtin_popcountl(opp & ~board->kings);
+  features[EVAL_KINGS] = __builtin_popcountl(own & board->kings) -
+    __builtin_popcountl(opp & board->kings);
+  features[EVAL_BACK_RANK] =
+    __builtin_popcountl(own & ~board->kings & own_back) -
+    __builtin_popcountl(opp & ~board->kings & opp_back);
+  features[EVAL_CENTER] = __builtin_popcountl(own & CENTER_SQUARES) -
+    __builtin_popcountl(opp & CENTER_SQUARES);
+  features[EVAL_MOBILITY] = __builtin_popcountl(own_movers) -
+    __builtin_popcountl(opp_movers);
+}
+
+int16_t evaluate(const Board* board, int8_t turn)
+{
+  /*
+    scores a position, from the point of view of the player to move, where:
+
+    board: the checker board
+    turn: the player to move, TURN_RED or TURN_BLUE
+   */
+  int8_t features[EVAL_TERMS];
+
+  eval_features(board, turn, features);
+  return (MAN_WEIGHT * features[EVAL_MEN]) +
+    (KINGS_WEIGHT * features[EVAL_KINGS]) +
+    (BACK_RANK_WEIGHT * features[EVAL_BACK_RANK]) +
+    (CENTER_WEIGHT * features[EVAL_CENTER]) +
+    (MOBILITY_WEIGHT * features[EVAL_MOBILITY]);
+}
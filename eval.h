@@ -0,0 +1,57 @@
+#ifndef _EVAL_H
+#define _EVAL_H
+
+/*
+  The evaluation: what the search thinks of a position it does not search
+  any further.  It is a sum of terms, each a count taken from the bitboards
+  (see eval_features) times a weight, all in hundredths of a man, so it
+  takes only integer arithmetic on the Mega, which has no FPU; the same
+  code scores positions in the sketch and on the host.
+
+  The weights are worked out on the host by host/tune.cpp, which fits them
+  to the results of games the search plays against itself, and compiled in
+  from eval_weights.h.  A man is always worth MAN_WEIGHT, so that scores
+  keep their scale from one tuning to the next.
+
+  The terms, each for the player to move less the same for the other:
+    - men: the men on the board;
+    - kings: the kings on the board;
+    - back rank: the men still on their own first row, which keeps the
+      other side's men from being kinged there;
+    - center: the checkers on the middle two rows, off the edges;
+    - mobility: the checkers with a simple move.
+*/
+
+#include <stdint.h>
+#include "rules.h"
+
+// the terms, in the order eval_features lists them
+#define EVAL_MEN 0
+#define EVAL_KINGS 1
+#define EVAL_BACK_RANK 2
+#define EVAL_CENTER 3
+#define EVAL_MOBILITY 4
+#define EVAL_TERMS 5
+
+#define MAN_WEIGHT 100 // a man, the unit of the scores
+
+
+/*
+  counts the terms of the evaluation in a position, where:
+
+  board: the checker board
+  turn: the player to move, TURN_RED or TURN_BLUE
+  features: set to each term, for the player to move less the other
+*/
+void eval_features(const Board* board, int8_t turn, int8_t* features);
+
+
+/*
+  scores a position, from the point of view of the player to move, where:
+
+  board: the checker board
+  turn: the player to move, TURN_RED or TURN_BLUE
+*/
+int16_t evaluate(const Board* board, int8_t turn);
+
+#endif
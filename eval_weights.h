@@ -0,0 +1,15 @@
+/*
+  The evaluation's weights (see eval.h), written by
+  host/tune.cpp: do not edit.
+*/
+
+#ifndef _EVAL_WEIGHTS_H
+#define _EVAL_WEIGHTS_H
+
+// in hundredths of a man, fitted with a scale of 0.01500 on 742822 positions
+#define KINGS_WEIGHT 129
+#define BACK_RANK_WEIGHT 10
+#define CENTER_WEIGHT -6
+#define MOBILITY_WEIGHT 4
+
+#endif
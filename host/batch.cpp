@@ -0,0 +1,238 @@
+/*
+  Move generation for a batch of boards (see batch.h).  The steps are
+  those of ../rules.cpp: a step down-left from square s lands on s+4 or
+  s+3, depending on the parity of its row, and so on, with the squares
+  that would leave the board masked off first.
+*/
+
+#include <string.h>
+#include "rules.h"
+#include "batch.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_AVX2 1
+#endif
+
+// the squares on the even (0, 2, 4, 6) and odd (1, 3, 5, 7) rows, and on
+// the leftmost and rightmost columns
+#define EVEN_ROWS 0x0F0F0F0FUL
+#define ODD_ROWS 0xF0F0F0F0UL
+#define LEFT_EDGE 0x10101010UL
+#define RIGHT_EDGE 0x08080808UL
+
+void clear_batch(BoardBatch* batch)
+{
+  batch->count = 0;
+}
+
+uint8_t add_to_batch(BoardBatch* batch, const Board* board, int8_t turn)
+{
+  /*
+    adds a position to a batch, where:
+
+    batch: the batch
+    board: the checker board
+    turn: the player to move, TURN_RED or TURN_BLUE
+   */
+  uint16_t i = batch->count;
+
+  if (i == BATCH_SIZE) {
+    return 0;
+  }
+  batch->red[i] = board->red;
+  batch->blue[i] = board->blue;
+  batch->kings[i] = board->kings;
+  batch->red_turn[i] = (turn == TURN_RED) ? ~0U : 0;
+  batch->count++;
+  return 1;
+}
+
+
+// one board at a time
+
+static uint32_t down_left(uint32_t set)
+{
+  return ((set & EVEN_ROWS) << 4) | ((set & ODD_ROWS & ~LEFT_EDGE) << 3);
+}
+
+static uint32_t down_right(uint32_t set)
+{
+  return ((set & EVEN_ROWS & ~RIGHT_EDGE) << 5) | ((set & ODD_ROWS) << 4);
+}
+
+static uint32_t up_left(uint32_t set)
+{
+  return ((set & EVEN_ROWS) >> 4) | ((set & ODD_ROWS & ~LEFT_EDGE) >> 5);
+}
+
+static uint32_t up_right(uint32_t set)
+{
+  return ((set & EVEN_ROWS & ~RIGHT_EDGE) >> 3) | ((set & ODD_ROWS) >> 4);
+}
+
+static void board_moves(const BoardBatch* batch, BatchMoves* moves,
+			uint16_t i)
+{
+  // the moves of one board of a batch; red's men step down the board and
+  // blue's up it, and kings step both ways
+  uint32_t red_turn = batch->red_turn[i];
+  uint32_t empty = ~(batch->red[i] | batch->blue[i]);
+  uint32_t own = (batch->red[i] & red_turn) | (batch->blue[i] & ~red_turn);
+  uint32_t opp = (batch->blue[i] & red_turn) | (batch->red[i] & ~red_turn);
+  uint32_t down = own & (red_turn | batch->kings[i]);
+  uint32_t up = own & (~red_turn | batch->kings[i]);
+
+  moves->steps[DOWN_LEFT][i] = down_left(down) & empty;
+  moves->steps[DOWN_RIGHT][i] = down_right(down) & empty;
+  moves->steps[UP_LEFT][i] = up_left(up) & empty;
+  moves->steps[UP_RIGHT][i] = up_right(up) & empty;
+  moves->jumps[DOWN_LEFT][i] = down_left(down_left(down) & opp) & empty;
+  moves->jumps[DOWN_RIGHT][i] = down_right(down_right(down) & opp) & empty;
+  moves->jumps[UP_LEFT][i] = up_left(up_left(up) & opp) & empty;
+  moves->jumps[UP_RIGHT][i] = up_right(up_right(up) & opp) & empty;
+}
+
+
+// BATCH_LANES boards at a time
+
+#ifdef HAVE_AVX2
+
+#define AVX2 __attribute__((target("avx2")))
+
+/*
+  Struct for the masks the vector steps use, where:
+
+  even, odd:             the squares on the even and odd rows
+  even_right, odd_left:  the same, less those on the right and left edges
+*/
+typedef struct {
+  __m256i even;
+  __m256i odd;
+  __m256i even_right;
+  __m256i odd_left;
+} StepMasks;
+
+AVX2 static inline __m256i shift_left(__m256i set, __m256i mask, int bits)
+{
+  return _mm256_slli_epi32(_mm256_and_si256(set, mask), bits);
+}
+
+AVX2 static inline __m256i shift_right(__m256i set, __m256i mask, int bits)
+{
+  return _mm256_srli_epi32(_mm256_and_si256(set, mask), bits);
+}
+
+AVX2 static inline __m256i vector_down_left(__m256i set, const StepMasks* m)
+{
+  return _mm256_or_si256(shift_left(set, m->even, 4),
+			 shift_left(set, m->odd_left, 3));
+}
+
+AVX2 static inline __m256i vector_down_right(__m256i set,
+					     const StepMasks* m)
+{
+  return _mm256_or_si256(shift_left(set, m->even_right, 5),
+			 shift_left(set, m->odd, 4));
+}
+
+AVX2 static inline __m256i vector_up_left(__m256i set, const StepMasks* m)
+{
+  return _mm256_or_si256(shift_right(set, m->even, 4),
+			 shift_right(set, m->odd_left, 5));
+}
+
+AVX2 static inline __m256i vector_up_right(__m256i set, const StepMasks* m)
+{
+  return _mm256_or_si256(shift_right(set, m->even_right, 3),
+			 shift_right(set, m->odd, 4));
+}
+
+AVX2 static inline void vector_moves(const BoardBatch* batch,
+				     BatchMoves* moves, uint16_t i,
+				     const StepMasks* m)
+{
+  // board_moves, for the BATCH_LANES boards from i on
+  __m256i red = _mm256_load_si256((const __m256i*) &batch->red[i]);
+  __m256i blue = _mm256_load_si256((const __m256i*) &batch->blue[i]);
+  __m256i kings = _mm256_load_si256((const __m256i*) &batch->kings[i]);
+  __m256i red_turn =
+    _mm256_load_si256((const __m256i*) &batch->red_turn[i]);
+  __m256i occupied = _mm256_or_si256(red, blue);
+  __m256i own = _mm256_blendv_epi8(blue, red, red_turn);
+  __m256i opp = _mm256_blendv_epi8(red, blue, red_turn);
+  __m256i down = _mm256_and_si256(own, _mm256_or_si256(red_turn, kings));
+  __m256i up = _mm256_and_si256(own, _mm256_or_si256(
+    _mm256_xor_si256(red_turn, _mm256_set1_epi32(-1)), kings));
+
+#define STORE(set, direction, value) _mm256_store_si256( \
+    (__m256i*) &moves->set[direction][i], \
+    _mm256_andnot_si256(occupied, value))
+
+  STORE(steps, DOWN_LEFT, vector_down_left(down, m));
+  STORE(steps, DOWN_RIGHT, vector_down_right(down, m));
+  STORE(steps, UP_LEFT, vector_up_left(up, m));
+  STORE(steps, UP_RIGHT, vector_up_right(up, m));
+  STORE(jumps, DOWN_LEFT, vector_down_left(
+    _mm256_and_si256(vector_down_left(down, m), opp), m));
+  STORE(jumps, DOWN_RIGHT, vector_down_right(
+    _mm256_and_si256(vector_down_right(down, m), opp), m));
+  STORE(jumps, UP_LEFT, vector_up_left(
+    _mm256_and_si256(vector_up_left(up, m), opp), m));
+  STORE(jumps, UP_RIGHT, vector_up_right(
+    _mm256_and_si256(vector_up_right(up, m), opp), m));
+
+#undef STORE
+}
+
+AVX2 static void vector_batch_moves(const BoardBatch* batch,
+				    BatchMoves* moves)
+{
+  // two vectors at a time, which keeps more of the CPU's vector units
+  // busy; the boards past count in the last two vectors are computed too,
+  // and ignored
+  StepMasks m;
+  m.even = _mm256_set1_epi32(EVEN_ROWS);
+  m.odd = _mm256_set1_epi32(ODD_ROWS);
+  m.even_right = _mm256_set1_epi32(EVEN_ROWS & ~RIGHT_EDGE);
+  m.odd_left = _mm256_set1_epi32(ODD_ROWS & ~LEFT_EDGE);
+
+  for (uint16_t i = 0; i < batch->count; i += 2 * BATCH_LANES) {
+    vector_moves(batch, moves, i, &m);
+    vector_moves(batch, moves, i + BATCH_LANES, &m);
+  }
+}
+
+#endif
+
+uint8_t batch_has_avx2()
+{
+#ifdef HAVE_AVX2
+  static const uint8_t has_avx2 = __builtin_cpu_supports("avx2") != 0;
+  return has_avx2;
+#else
+  return 0;
+#endif
+}
+
+void batch_moves(const BoardBatch* batch, BatchMoves* moves,
+		 uint8_t vector)
+{
+  /*
+    computes the moves of every board in a batch, where:
+
+    batch: the batch
+    moves: set to the moves of each board
+    vector: nonzero to use AVX2 if the CPU has it, 0 to go one board at a
+      time
+   */
+#ifdef HAVE_AVX2
+  if (vector && batch_has_avx2()) {
+    vector_batch_moves(batch, moves);
+    return;
+  }
+#endif
+  for (uint16_t i = 0; i < batch->count; i++) {
+    board_moves(batch, moves, i);
+  }
+}
@@ -0,0 +1,85 @@
+#ifndef _BATCH_H
+#define _BATCH_H
+
+/*
+  Move generation for many boards at once, for the host tools that work
+  through huge numbers of unrelated positions (self-play, tuning, perft
+  leaves).  A batch keeps its boards as a structure of arrays, one array
+  each of red, blue and kings, so that the shifts and masks that compute
+  the moves in ../rules.cpp can run on BATCH_LANES boards in one AVX2
+  instruction; batch_moves uses AVX2 where the CPU has it, two vectors
+  at a time, and otherwise the same steps one board at a time.
+
+  What comes out for each board is, for each direction, the squares its
+  checkers can step to and the squares they can land on with the first hop
+  of a jump, as list_moves starts from; the capture sequences themselves
+  are still followed one board at a time (see generate_captures).
+*/
+
+#include <stdint.h>
+#include "rules.h"
+
+// the most boards in a batch, a multiple of two vectors
+#define BATCH_SIZE 256
+#define BATCH_LANES 8 // the boards in one AVX2 vector, 32 bits each
+
+/*
+  Struct for a batch of boards, where:
+
+  red, blue, kings: the bitboards of each board, as in Board
+  red_turn:         all ones for a board with red to move, zero for blue
+  count:            the number of boards in the batch
+*/
+typedef struct {
+  alignas(32) uint32_t red[BATCH_SIZE];
+  alignas(32) uint32_t blue[BATCH_SIZE];
+  alignas(32) uint32_t kings[BATCH_SIZE];
+  alignas(32) uint32_t red_turn[BATCH_SIZE];
+  uint16_t count;
+} BoardBatch;
+
+/*
+  Struct for the moves of the boards of a batch, where:
+
+  steps: for each direction and board, the squares the player to move can
+         step to that way
+  jumps: likewise, the squares they can land on with a jump that way
+*/
+typedef struct {
+  alignas(32) uint32_t steps[NUM_DIRECTIONS][BATCH_SIZE];
+  alignas(32) uint32_t jumps[NUM_DIRECTIONS][BATCH_SIZE];
+} BatchMoves;
+
+
+// empties a batch
+void clear_batch(BoardBatch* batch);
+
+
+/*
+  adds a position to a batch, where:
+
+  batch: the batch
+  board: the checker board
+  turn: the player to move, TURN_RED or TURN_BLUE
+
+  returns 0 if the batch is full
+*/
+uint8_t add_to_batch(BoardBatch* batch, const Board* board, int8_t turn);
+
+
+/*
+  computes the moves of every board in a batch, where:
+
+  batch: the batch
+  moves: set to the moves of each board
+  vector: nonzero to use AVX2 if the CPU has it, 0 to go one board at a
+    time
+*/
+void batch_moves(const BoardBatch* batch, BatchMoves* moves,
+		 uint8_t vector);
+
+
+// whether batch_moves can use AVX2 on this CPU
+uint8_t batch_has_avx2();
+
+#endif
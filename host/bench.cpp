@@ -0,0 +1,547 @@
+/*
+  Throughput benchmarks for the rules core, run on the host with
+  `make bench`, so that regressions show up before anything is flashed.
+
+  usage: bench [seconds per benchmark] [random seed]
+
+  Nine numbers are reported:
+    movegen  - positions per second through compute_moves
+    batch    - positions per second through batch_moves (see batch.h),
+               with AVX2 if the CPU has it and one board at a time, and
+               the positions where it disagrees with list_moves
+    movelist - positions per second through generate_moves, which lists
+               every legal move, capture sequences included
+    apply    - moves per second through move_checker / jump_checker, from
+               a copy of the position
+    update   - moves per second applied and followed by update_move_state
+    unmake   - whole moves per second played with make_move and taken back
+               with unmake_move
+    games    - complete random games per second, double jumps included
+    search   - nodes per second thinking about the opening move, with the
+               depth reached in the time and the transposition table's
+               hit rate
+    ponder   - the depth a short think reaches on the position pondered
+               while the other player chose (in slices, as in the sketch),
+               against the depth it reaches cold
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "rules.h"
+#include "search.h"
+#include "batch.h"
+
+#define SAMPLE_POSITIONS 4096
+#define MAX_GAME_PLIES 300 // random kings can shuffle forever; call it a draw
+#define MAX_CANDIDATES (CHECKERS_PER_SIDE * 4)
+#define TABLE_BYTES (16UL << 20) // the search's transposition table
+#define PONDER_SLICE 2 // the milliseconds pondered between input polls
+#define REPLY_BUDGET 50 // the milliseconds the reply is thought about for
+
+typedef struct {
+  Board board;
+  int8_t turn;
+} Game;
+
+typedef struct {
+  uint8_t from;
+  uint8_t to;
+} Candidate;
+
+static uint64_t rng_state;
+
+static uint32_t rng_next()
+{
+  // xorshift64*, plenty for picking random moves
+  rng_state ^= rng_state >> 12;
+  rng_state ^= rng_state << 25;
+  rng_state ^= rng_state >> 27;
+  return (uint32_t) ((rng_state * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+static double now_seconds()
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t clock_ms()
+{
+  return (uint32_t) (now_seconds() * 1000);
+}
+
+static void new_game(Game* game)
+{
+  setup_board(&game->board);
+  game->turn = TURN_RED;
+}
+
+static uint8_t list_candidates(Game* game, Candidate* list, uint8_t* jumping)
+{
+  /*
+    lists the moves of the player to move, where:
+
+    game: the game in question
+    list: filled with the legal moves, at most MAX_CANDIDATES of them
+    jumping: set to 1 if the listed moves are (forced) jumps
+
+    returns the number of moves listed
+  */
+  uint32_t movers;
+  uint32_t jumpers;
+  *jumping = !compute_moves(&game->board, game->turn, &movers, &jumpers);
+
+  uint32_t checkers = *jumping ? jumpers : movers;
+  uint8_t count = 0;
+  while (checkers) {
+    uint8_t from = FIRST_SQUARE(checkers);
+    uint32_t destinations = *jumping ?
+      compute_checker_jumps(&game->board, from, 0) :
+      compute_checker_moves(&game->board, from);
+    checkers &= ~SQUARE_BIT(from);
+
+    while (destinations) {
+      list[count].from = from;
+      list[count].to = FIRST_SQUARE(destinations);
+      destinations &= ~SQUARE_BIT(list[count].to);
+      count++;
+    }
+  }
+  return count;
+}
+
+static void play_candidate(Game* game, Candidate* move, uint8_t jumping,
+			   MoveState* state)
+{
+  /*
+    plays a listed move, continuing double jumps at random, where:
+
+    game: the game in question
+    move: the move to play
+    jumping: whether the move is a jump
+    state: if not NULL, kept up to date with update_move_state
+  */
+  if (!jumping) {
+    move_checker(&game->board, move->from, move->to);
+    if (state) {
+      update_move_state(&game->board, state,
+			SQUARE_BIT(move->from) | SQUARE_BIT(move->to));
+    }
+    return;
+  }
+
+  uint8_t from = move->from;
+  uint8_t to = move->to;
+  while (1) {
+    uint8_t captured = jump_checker(&game->board, from, to);
+    if (state) {
+      update_move_state(&game->board, state, SQUARE_BIT(from) |
+			SQUARE_BIT(captured) | SQUARE_BIT(to));
+    }
+
+    // a checker landing on the first or last row ends its turn
+    if (to / 4 == 0 || to / 4 == 7) {
+      return;
+    }
+    uint32_t options = compute_checker_jumps(&game->board, to, 1);
+    if (!options) {
+      return;
+    }
+
+    uint8_t pick = rng_next() % __builtin_popcount(options);
+    while (pick--) {
+      options &= options - 1;
+    }
+    from = to;
+    to = FIRST_SQUARE(options);
+  }
+}
+
+static uint16_t play_random_game(Game* game, Game* samples,
+				 uint16_t* num_samples)
+{
+  /*
+    plays a random game from the starting position, where:
+
+    game: scratch space for the game
+    samples: if not NULL, positions are copied here as they are reached
+    num_samples: the number of positions in samples, up to SAMPLE_POSITIONS
+
+    returns the number of plies played
+  */
+  Candidate list[MAX_CANDIDATES];
+  uint8_t jumping;
+  uint16_t plies;
+
+  new_game(game);
+  for (plies = 0; plies < MAX_GAME_PLIES; plies++) {
+    if (samples && *num_samples < SAMPLE_POSITIONS) {
+      samples[(*num_samples)++] = *game;
+    }
+    uint8_t count = list_candidates(game, list, &jumping);
+    if (!count) {
+      break;
+    }
+    play_candidate(game, &list[rng_next() % count], jumping, NULL);
+    game->turn = -game->turn;
+  }
+  return plies;
+}
+
+static void bench_movegen(Game* samples, uint16_t num_samples,
+			  double seconds)
+{
+  uint64_t positions = 0;
+  uint32_t checksum = 0;
+  uint32_t movers;
+  uint32_t jumpers;
+  double start = now_seconds();
+  double elapsed;
+
+  do {
+    for (uint16_t i = 0; i < num_samples; i++) {
+      checksum += compute_moves(&samples[i].board, samples[i].turn,
+				&movers, &jumpers);
+      checksum += movers ^ jumpers;
+    }
+    positions += num_samples;
+    elapsed = now_seconds() - start;
+  } while (elapsed < seconds);
+
+  printf("movegen  %12.0f positions/s   (checksum %u)\n",
+	 positions / elapsed, (unsigned) checksum);
+}
+
+static double time_batches(const BoardBatch* batches, uint16_t num_batches,
+			   uint8_t vector, double seconds, uint32_t* checksum)
+{
+  // the positions per second through batch_moves
+  static BatchMoves moves;
+  uint64_t positions = 0;
+  double start = now_seconds();
+  double elapsed;
+
+  do {
+    for (uint16_t i = 0; i < num_batches; i++) {
+      batch_moves(&batches[i], &moves, vector);
+      *checksum += moves.steps[DOWN_LEFT][i] ^ moves.jumps[UP_RIGHT][i];
+    }
+    positions += (uint64_t) num_batches * BATCH_SIZE;
+    elapsed = now_seconds() - start;
+  } while (elapsed < seconds);
+  return positions / elapsed;
+}
+
+static void bench_batch(Game* samples, uint16_t num_samples, double seconds)
+{
+  /*
+    times batch_moves over the sample positions, with AVX2 and one board at
+    a time, after checking every position against list_moves: the steps
+    must be the simple moves when there is no capture, and there must be
+    first hops when there is, where:
+
+    samples: the sample positions, filling whole batches
+    num_samples: the number of positions
+    seconds: how long to time each way for
+   */
+  static BoardBatch batches[SAMPLE_POSITIONS / BATCH_SIZE];
+  static BatchMoves moves;
+  uint16_t num_batches = num_samples / BATCH_SIZE;
+  uint32_t mismatches = 0;
+
+  for (uint16_t i = 0; i < num_batches; i++) {
+    clear_batch(&batches[i]);
+    for (uint16_t j = 0; j < BATCH_SIZE; j++) {
+      Game* game = &samples[i * BATCH_SIZE + j];
+      add_to_batch(&batches[i], &game->board, game->turn);
+    }
+  }
+  for (uint8_t vector = 0; vector < 2; vector++) {
+    for (uint16_t i = 0; i < num_batches; i++) {
+      batch_moves(&batches[i], &moves, vector);
+      for (uint16_t j = 0; j < BATCH_SIZE; j++) {
+	Game* game = &samples[i * BATCH_SIZE + j];
+	Move list[MAX_MOVES];
+	uint8_t count;
+	uint8_t steps = 0;
+	uint32_t jumps = 0;
+	for (uint8_t direction = 0; direction < NUM_DIRECTIONS;
+	     direction++) {
+	  steps += __builtin_popcount(moves.steps[direction][j]);
+	  jumps |= moves.jumps[direction][j];
+	}
+	uint8_t simple = list_moves(&game->board, game->turn, list, &count);
+	mismatches += simple ? (jumps || steps != count) : !jumps;
+      }
+    }
+  }
+
+  uint32_t checksum = 0;
+  double vector = time_batches(batches, num_batches, 1, seconds, &checksum);
+  double single = time_batches(batches, num_batches, 0, seconds, &checksum);
+  printf("batch    %12.0f positions/s   (%s; one board at a time %.0f, "
+	 "%u mismatches, checksum %u)\n", vector,
+	 batch_has_avx2() ? "AVX2" : "no AVX2", single,
+	 (unsigned) mismatches, (unsigned) checksum);
+}
+
+static void bench_movelist(Game* samples, uint16_t num_samples,
+			   double seconds)
+{
+  MoveList list;
+  uint64_t positions = 0;
+  uint64_t moves = 0;
+  double start = now_seconds();
+  double elapsed;
+
+  do {
+    for (uint16_t i = 0; i < num_samples; i++) {
+      generate_moves(&samples[i].board, samples[i].turn, &list);
+      moves += list.count;
+    }
+    positions += num_samples;
+    elapsed = now_seconds() - start;
+  } while (elapsed < seconds);
+
+  printf("movelist %12.0f positions/s   (%.2f moves/position)\n",
+	 positions / elapsed, (double) moves / positions);
+}
+
+static void bench_apply(Game* samples, uint16_t num_samples, double seconds)
+{
+  static Candidate moves[SAMPLE_POSITIONS];
+  static uint8_t jumping[SAMPLE_POSITIONS];
+  Candidate list[MAX_CANDIDATES];
+  Game scratch;
+  uint16_t playable = 0;
+
+  // settle the move to play in each sample up front, so that only
+  // applying it is timed
+  for (uint16_t i = 0; i < num_samples; i++) {
+    uint8_t count = list_candidates(&samples[i], list, &jumping[playable]);
+    if (count) {
+      samples[playable] = samples[i];
+      moves[playable] = list[rng_next() % count];
+      playable++;
+    }
+  }
+
+  uint64_t applied = 0;
+  uint32_t checksum = 0;
+  double start = now_seconds();
+  double elapsed;
+
+  do {
+    for (uint16_t i = 0; i < playable; i++) {
+      scratch = samples[i];
+      play_candidate(&scratch, &moves[i], jumping[i], NULL);
+      checksum += scratch.board.red ^ scratch.board.kings;
+    }
+    applied += playable;
+    elapsed = now_seconds() - start;
+  } while (elapsed < seconds);
+
+  printf("apply    %12.0f moves/s       (checksum %u)\n",
+	 applied / elapsed, (unsigned) checksum);
+}
+
+static void bench_update(Game* samples, uint16_t num_samples,
+			 double seconds)
+{
+  static Candidate moves[SAMPLE_POSITIONS];
+  static uint8_t jumping[SAMPLE_POSITIONS];
+  static MoveState states[SAMPLE_POSITIONS];
+  Candidate list[MAX_CANDIDATES];
+  Game scratch;
+  MoveState state;
+  uint16_t playable = 0;
+
+  // settle the moves up front as in bench_apply
+  for (uint16_t i = 0; i < num_samples; i++) {
+    uint8_t count = list_candidates(&samples[i], list, &jumping[playable]);
+    if (!count) {
+      continue;
+    }
+    samples[playable] = samples[i];
+    moves[playable] = list[rng_next() % count];
+    init_move_state(&samples[playable].board, &states[playable]);
+    playable++;
+  }
+
+  uint64_t applied = 0;
+  uint32_t checksum = 0;
+  double start = now_seconds();
+  double elapsed;
+  do {
+    for (uint16_t i = 0; i < playable; i++) {
+      scratch = samples[i];
+      state = states[i];
+      play_candidate(&scratch, &moves[i], jumping[i], &state);
+      checksum += state.movers[0] ^ state.jumpers[1] ^ state.dirty;
+    }
+    applied += playable;
+    elapsed = now_seconds() - start;
+  } while (elapsed < seconds);
+
+  printf("update   %12.0f moves/s       (checksum %u)\n",
+	 applied / elapsed, (unsigned) checksum);
+}
+
+static void bench_unmake(Game* samples, uint16_t num_samples,
+			 double seconds)
+{
+  static Move moves[SAMPLE_POSITIONS];
+  Move list[MAX_MOVES];
+  MoveRecord record;
+  uint16_t playable = 0;
+
+  // one whole move per sample, capture sequences included
+  for (uint16_t i = 0; i < num_samples; i++) {
+    Board* board = &samples[i].board;
+    uint8_t count = generate_captures(board, samples[i].turn, list);
+    if (!count) {
+      uint32_t movers;
+      uint32_t jumpers;
+      compute_moves(board, samples[i].turn, &movers, &jumpers);
+      if (!movers) {
+	continue;
+      }
+      list[0].from = FIRST_SQUARE(movers);
+      list[0].to = FIRST_SQUARE(compute_checker_moves(board, list[0].from));
+      list[0].captured = 0;
+      count = 1;
+    }
+    samples[playable] = samples[i];
+    moves[playable] = list[rng_next() % count];
+    playable++;
+  }
+
+  uint64_t played = 0;
+  uint32_t checksum = 0;
+  double start = now_seconds();
+  double elapsed;
+
+  do {
+    for (uint16_t i = 0; i < playable; i++) {
+      Board board = samples[i].board;
+      make_move(&board, &moves[i], &record);
+      checksum += board.blue ^ board.kings;
+      unmake_move(&board, &record);
+      if (memcmp(&board, &samples[i].board, sizeof(Board))) {
+	printf("unmake_move did not restore the board\n");
+	exit(1);
+      }
+    }
+    played += playable;
+    elapsed = now_seconds() - start;
+  } while (elapsed < seconds);
+
+  printf("unmake   %12.0f moves/s       (checksum %u)\n",
+	 played / elapsed, (unsigned) checksum);
+}
+
+static void bench_games(double seconds)
+{
+  Game game;
+  uint64_t games = 0;
+  uint64_t plies = 0;
+  double start = now_seconds();
+  double elapsed;
+
+  do {
+    plies += play_random_game(&game, NULL, NULL);
+    games++;
+    elapsed = now_seconds() - start;
+  } while (elapsed < seconds);
+
+  printf("games    %12.0f games/s       (%.1f plies/game)\n",
+	 games / elapsed, (double) plies / games);
+}
+
+static void bench_search(double seconds)
+{
+  static Search search;
+  static TransTable table;
+  Board board;
+
+  init_table(&table, malloc(TABLE_BYTES), TABLE_BYTES);
+  init_search(&search, clock_ms, &table);
+  setup_board(&board);
+  think(&search, &board, TURN_BLUE, NULL, (uint32_t) (seconds * 1000),
+	MAX_PLY);
+
+  printf("search   %12.0f nodes/s       (depth %u, %u nodes, score %d, "
+	 "%.1f%% table hits)\n",
+	 search.nodes / (search.elapsed / 1000.0), search.depth,
+	 (unsigned) search.nodes, search.score,
+	 search.probes ? (100.0 * search.hits) / search.probes : 0.0);
+  free(table.buckets);
+}
+
+static void bench_ponder(double seconds)
+{
+  static Search search;
+  static TransTable table;
+  static KeyHistory keys;
+  Board board;
+  uint32_t slices = 0;
+
+  // the computer ponders its reply while the other player chooses their
+  // opening move (after the computer's own move, the reply can be forced)
+  init_table(&table, malloc(TABLE_BYTES), TABLE_BYTES);
+  init_search(&search, clock_ms, &table);
+  setup_board(&board);
+  clear_keys(&keys);
+  push_key(&keys, position_key(&board, TURN_BLUE), 1);
+  start_ponder(&search, &board, TURN_BLUE, &keys);
+  double start = now_seconds();
+  while (now_seconds() - start < seconds / 2) {
+    ponder(&search, PONDER_SLICE);
+    slices++;
+  }
+
+  // the guessed reply is played, and the computer answers it
+  Board reply = search.board;
+  KeyHistory reply_keys = search.keys;
+  think(&search, &reply, TURN_RED, &reply_keys, REPLY_BUDGET, MAX_PLY);
+  uint8_t pondered = search.depth;
+
+  clear_table(&table);
+  think(&search, &reply, TURN_RED, &reply_keys, REPLY_BUDGET, MAX_PLY);
+
+  printf("ponder   %12u depth         (%u cold, in %u ms; %u slices "
+	 "pondered)\n", pondered, search.depth, REPLY_BUDGET,
+	 (unsigned) slices);
+  free(table.buckets);
+}
+
+int main(int argc, char** argv)
+{
+  double seconds = argc > 1 ? atof(argv[1]) : 1.0;
+  rng_state = argc > 2 ? strtoull(argv[2], NULL, 10) : 0x9E3779B97F4A7C15ULL;
+  if (!rng_state) {
+    rng_state = 1;
+  }
+
+  // sample positions from random games, so that every benchmark runs over
+  // the same mix of openings, middlegames and endgames
+  static Game samples[SAMPLE_POSITIONS];
+  uint16_t num_samples = 0;
+  Game game;
+  while (num_samples < SAMPLE_POSITIONS) {
+    play_random_game(&game, samples, &num_samples);
+  }
+
+  bench_movegen(samples, num_samples, seconds);
+  bench_batch(samples, num_samples, seconds);
+  bench_movelist(samples, num_samples, seconds);
+  bench_apply(samples, num_samples, seconds);
+  bench_update(samples, num_samples, seconds);
+  bench_unmake(samples, num_samples, seconds);
+  bench_games(seconds);
+  bench_search(seconds);
+  bench_ponder(seconds);
+  return 0;
+}
@@ -0,0 +1,418 @@
+/*
+  The opening book builder: plays games from the opening against itself,
+  and reads in games played elsewhere, and writes the moves played in the
+  first few plies of them as the sketch's opening book (see ../book.h).
+
+  In a game of self-play, every move from the position reached is scored
+  by a search of the position it leaves, to a fixed depth, and one of the
+  moves scoring within BOOK_MARGIN of the best is picked at random; so the
+  games spread over the sound openings rather than repeating one.  Scores
+  are remembered by position, so a position the games come back to is only
+  searched once.  Games read in are lines of moves, one game a line, in
+  the notation perft prints: squares 1-32, the from and to squares of each
+  move joined by a - or, for a capture, an x.
+
+  Every move played in a position counts toward its weight, the share of
+  the time the sketch plays it.  Positions reached in fewer than
+  BOOK_MIN_GAMES games, and those with only one legal move, are left out,
+  and if that still leaves more than BOOK_MAX_ENTRIES moves the least
+  played positions go until it does not.
+
+  usage: bookgen [games] [plies] [depth] [header] [games file]
+
+  With a header (../book_data.h for the sketch, which `make book` writes),
+  the book is written there.  Without one, or with -, the book built is
+  checked against the one compiled in instead: book_move should pick each
+  of its moves with the weights it was built with, as it does when the
+  compiled-in book was written by the same run.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <vector>
+#include "rules.h"
+#include "search.h"
+#include "ttable.h"
+#include "book.h"
+
+#define BOOK_MARGIN 10 // how far below the best a move may score and be played
+#define BOOK_MIN_GAMES 2 // the fewest games a position is kept from
+#define BOOK_MAX_ENTRIES 512 // 4 KB of flash
+#define TABLE_MEGABYTES 16
+#define NO_DEADLINE (1UL << 30) // the searches end at their depth
+
+/*
+  Struct for a position of the book as it is built, where:
+
+  key:   the position key, to tell positions sharing a book hash apart
+  board: the position
+  turn:  the player to move there
+  games: the number of games that reached it
+  moves: the moves played there, packed by PACK_MOVE, and how often
+*/
+typedef struct {
+  uint64_t key;
+  Board board;
+  int8_t turn;
+  uint32_t games;
+  std::map<uint16_t, uint32_t> moves;
+} BookPosition;
+
+static std::map<uint32_t, BookPosition> positions; // by book hash
+static std::map<uint64_t, std::vector<int16_t> > scores; // by position key
+static Search search;
+static TransTable table;
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+static uint32_t collisions;
+
+static uint32_t rng_next()
+{
+  // xorshift64*, plenty for picking among moves
+  rng_state ^= rng_state >> 12;
+  rng_state ^= rng_state << 25;
+  rng_state ^= rng_state >> 27;
+  return (uint32_t) ((rng_state * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+static uint32_t clock_ms()
+{
+  return (uint32_t) std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void add_move(const Board* board, int8_t turn, const Move* move)
+{
+  /*
+    counts a move played in a game toward the book, where:
+
+    board, turn: the position it was played in
+    move: the move
+   */
+  MoveList list;
+  generate_moves(board, turn, &list);
+  if (list.count < 2) {
+    return; // nothing to choose
+  }
+
+  uint64_t key = position_key(board, turn);
+  BookPosition* position = &positions[BOOK_HASH(key)];
+  if (!position->games) {
+    position->key = key;
+    position->board = *board;
+    position->turn = turn;
+  }
+  else if (position->key != key) {
+    collisions++; // the first position to take the hash keeps it
+    return;
+  }
+  position->games++;
+  position->moves[PACK_MOVE(*move)]++;
+}
+
+static const std::vector<int16_t>* score_moves(const Board* board,
+					       int8_t turn,
+					       const MoveList* list,
+					       uint8_t depth)
+{
+  /*
+    scores each move in a position by searching the position it leaves,
+    where:
+
+    board, turn: the position
+    list: its moves, from generate_moves
+    depth: the depth to search to, counting the move itself
+
+    returns the scores, from the point of view of the player to move, in
+    the order of list
+   */
+  uint64_t key = position_key(board, turn);
+  std::vector<int16_t>* found = &scores[key];
+  if (found->size() == list->count) {
+    return found;
+  }
+
+  found->clear();
+  for (uint8_t i = 0; i < list->count; i++) {
+    Board child = *board;
+    MoveRecord record;
+    make_move(&child, &list->moves[i], &record);
+    if (!think(&search, &child, -turn, NULL, NO_DEADLINE, depth - 1)) {
+      found->push_back(WIN_SCORE - 1); // the move leaves no moves
+    }
+    else {
+      found->push_back(-search.score);
+    }
+  }
+  return found;
+}
+
+static void play_game(uint8_t plies, uint8_t depth)
+{
+  /*
+    plays a game of self-play from the opening for the book, where:
+
+    plies: the number of plies to play
+    depth: the depth each move is searched to
+   */
+  Board board;
+  int8_t turn = TURN_BLUE;
+  MoveList list;
+  MoveRecord record;
+
+  setup_board(&board);
+  for (uint8_t ply = 0; ply < plies; ply++) {
+    generate_moves(&board, turn, &list);
+    if (!list.count) {
+      return;
+    }
+    const std::vector<int16_t>* found =
+      score_moves(&board, turn, &list, depth);
+    int16_t best = *std::max_element(found->begin(), found->end());
+    uint8_t good[MAX_MOVES];
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < list.count; i++) {
+      if ((*found)[i] >= best - BOOK_MARGIN) {
+	good[count++] = i;
+      }
+    }
+    Move* move = &list.moves[good[rng_next() % count]];
+    add_move(&board, turn, move);
+    make_move(&board, move, &record);
+    turn = -turn;
+  }
+}
+
+static uint8_t read_move(const char* text, const Board* board, int8_t turn,
+			 Move* move)
+{
+  /*
+    finds the legal move written in a game read in, where:
+
+    text: the move, as from-to or fromxto with squares 1-32
+    board, turn: the position it is played in
+    move: set to the move
+
+    returns 0 if the text is not a legal move there
+   */
+  unsigned from, to;
+  char joint;
+  MoveList list;
+
+  if (sscanf(text, "%u%c%u", &from, &joint, &to) != 3 ||
+      (joint != '-' && joint != 'x') || from < 1 || from > NUM_SQUARES ||
+      to < 1 || to > NUM_SQUARES) {
+    return 0;
+  }
+  generate_moves(board, turn, &list);
+  for (uint8_t i = 0; i < list.count; i++) {
+    if (list.moves[i].from == from - 1 && list.moves[i].to == to - 1 &&
+	(list.moves[i].captured != 0) == (joint == 'x')) {
+      *move = list.moves[i];
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static long read_games(const char* name, uint8_t plies)
+{
+  /*
+    counts the first plies of the games in a file toward the book, where:
+
+    name: the file name
+    plies: the number of plies of each game to count
+
+    returns the number of games, or -1 if the file could not be read; a
+    game with a move that is not legal is counted up to that move
+   */
+  FILE* file = fopen(name, "r");
+  char line[4096];
+  long games = 0;
+
+  if (!file) {
+    return -1;
+  }
+  while (fgets(line, sizeof(line), file)) {
+    Board board;
+    int8_t turn = TURN_BLUE;
+    uint8_t ply = 0;
+    uint8_t counted = 0;
+
+    setup_board(&board);
+    for (char* text = strtok(line, " \t\r\n"); text && ply < plies;
+	 text = strtok(NULL, " \t\r\n")) {
+      Move move;
+      MoveRecord record;
+      if (!read_move(text, &board, turn, &move)) {
+	fprintf(stderr, "bookgen: %s: game %ld: %s is not a legal move\n",
+		name, games + 1, text);
+	break;
+      }
+      add_move(&board, turn, &move);
+      make_move(&board, &move, &record);
+      turn = -turn;
+      ply++;
+      counted = 1;
+    }
+    games += counted;
+  }
+  fclose(file);
+  return games;
+}
+
+static void build_book(std::vector<BookEntry>* book)
+{
+  /*
+    picks the positions to keep and lists their moves as the book, where:
+
+    book: set to the entries, sorted by hash and then move
+   */
+  std::vector<std::pair<uint32_t, uint32_t> > kept; // games, hash
+  for (auto& entry : positions) {
+    if (entry.second.games >= BOOK_MIN_GAMES) {
+      kept.push_back(std::make_pair(entry.second.games, entry.first));
+    }
+  }
+  std::sort(kept.rbegin(), kept.rend()); // the most played first
+
+  size_t count = 0;
+  book->clear();
+  for (auto& entry : kept) {
+    BookPosition* position = &positions[entry.second];
+    count += position->moves.size();
+    if (count > BOOK_MAX_ENTRIES) {
+      break;
+    }
+    for (auto& move : position->moves) {
+      BookEntry book_entry;
+      book_entry.hash = entry.second;
+      book_entry.move = move.first;
+      book_entry.weight = (uint16_t) std::min<uint32_t>(move.second, 0xFFFF);
+      book->push_back(book_entry);
+    }
+  }
+  std::sort(book->begin(), book->end(),
+	    [](const BookEntry& a, const BookEntry& b) {
+	      return a.hash != b.hash ? a.hash < b.hash : a.move < b.move;
+	    });
+}
+
+static int write_book(const char* name, const std::vector<BookEntry>* book)
+{
+  /*
+    writes the book as a header for the sketch (see book.h), where:
+
+    name: the file name
+    book: the entries
+
+    returns 0 if the file could not be written
+   */
+  FILE* file = fopen(name, "w");
+  if (!file) {
+    return 0;
+  }
+  fprintf(file, "/*\n"
+	  "  The opening book's moves (see book.h), written by\n"
+	  "  host/bookgen.cpp: do not edit.\n"
+	  "*/\n\n"
+	  "#ifndef _BOOK_DATA_H\n"
+	  "#define _BOOK_DATA_H\n\n"
+	  "// hash, move, weight; sorted by hash\n"
+	  "static const BookEntry BOOK[%u] PROGMEM = {\n",
+	  (unsigned) book->size());
+  for (const BookEntry& entry : *book) {
+    fprintf(file, "  {0x%08XUL, 0x%04X, %u},\n", (unsigned) entry.hash,
+	    entry.move, entry.weight);
+  }
+  fprintf(file, "};\n\n#endif\n");
+  return fclose(file) == 0;
+}
+
+static uint32_t check_book(const std::vector<BookEntry>* book)
+{
+  /*
+    checks the compiled-in book against the book built, where:
+
+    book: the entries built, sorted by hash
+
+    returns the number of moves of the book built that book_move does not
+    pick when its choice falls in their share of the weights
+   */
+  uint32_t wrong = 0;
+  uint32_t choice = 0;
+
+  for (size_t i = 0; i < book->size(); i++) {
+    const BookEntry* entry = &(*book)[i];
+    const BookPosition* position = &positions[entry->hash];
+    Move move;
+    if (i && entry->hash != (*book)[i - 1].hash) {
+      choice = 0;
+    }
+    if (!book_move(&position->board, position->turn, choice, &move) ||
+	PACK_MOVE(move) != entry->move) {
+      wrong++;
+    }
+    choice += entry->weight;
+  }
+  return wrong;
+}
+
+int main(int argc, char** argv)
+{
+  unsigned games = argc > 1 ? atoi(argv[1]) : 1024;
+  unsigned plies = argc > 2 ? atoi(argv[2]) : 12;
+  unsigned depth = argc > 3 ? atoi(argv[3]) : 10;
+  const char* header = argc > 4 && strcmp(argv[4], "-") ? argv[4] : NULL;
+  const char* games_file = argc > 5 ? argv[5] : NULL;
+  if (plies < 1 || plies > 255 || depth < 1 || depth > MAX_PLY) {
+    fprintf(stderr, "usage: bookgen [games] [plies] [depth, 1-%u] "
+	    "[header, or -] [games file]\n", MAX_PLY);
+    return 1;
+  }
+
+  uint32_t bytes = (uint32_t) TABLE_MEGABYTES << 20;
+  if (!init_table(&table, malloc(bytes), bytes)) {
+    fprintf(stderr, "bookgen: no memory for the table\n");
+    return 1;
+  }
+  init_search(&search, clock_ms, &table);
+
+  uint32_t start = clock_ms();
+  for (unsigned game = 0; game < games; game++) {
+    play_game(plies, depth);
+  }
+  printf("%u games of self-play to ply %u at depth %u in %.1f s, "
+	 "%u positions searched\n", games, plies, depth,
+	 (clock_ms() - start) / 1000.0, (unsigned) scores.size());
+  if (games_file) {
+    long read = read_games(games_file, plies);
+    if (read < 0) {
+      fprintf(stderr, "bookgen: could not read %s\n", games_file);
+      return 1;
+    }
+    printf("%s: %ld games\n", games_file, read);
+  }
+
+  std::vector<BookEntry> book;
+  build_book(&book);
+  printf("%u positions reached, %u hash collisions; book of %u moves, "
+	 "%u bytes\n", (unsigned) positions.size(), collisions,
+	 (unsigned) book.size(), (unsigned) (book.size() * sizeof(BookEntry)));
+  free(table.buckets);
+
+  if (header) {
+    if (!write_book(header, &book)) {
+      fprintf(stderr, "bookgen: could not write %s\n", header);
+      return 1;
+    }
+    printf("%s written\n", header);
+    return 0;
+  }
+  uint32_t wrong = check_book(&book);
+  printf("compiled-in book (%u moves): %u wrong\n", book_size(), wrong);
+  return wrong ? 1 : 0;
+}
@@ -0,0 +1,560 @@
+/*
+  The proof-number solver: proves a position won, lost or drawn for the
+  player to move by depth-first proof-number search (df-pn), for endgames
+  and composed puzzles, where the search only gives a score.
+
+  Each search sets out to prove that one player, the attacker, wins within
+  a number of plies.  At the attacker's turns (OR nodes) one winning move
+  proves the node, and at the defender's (AND nodes) every move must lose.
+  Each node has a proof number, the fewest leaves that must be proved to
+  prove it, and a disproof number, the fewest to disprove it; df-pn
+  expands the most proving child of each node, depth-first, until the
+  node's numbers pass the thresholds its parent sets, and keeps the
+  numbers of the nodes it leaves in the transposition table.  The position
+  is won if a search for the player to move proves it, lost if one for the
+  other player does, and drawn if both are disproved: neither player can
+  force a win within the plies.
+
+  The plies left are part of each node, and of its key in the table, so
+  the nodes form a tree with transpositions but no cycles: a position
+  reached again is a different node, with fewer plies left.  That keeps the
+  numbers from feeding back into themselves round a repetition, which
+  could grow them without end, and makes every result exact for its number
+  of plies, with no need to track repetitions or the DRAW_PLIES rule (a
+  forced win never needs either).
+
+  The table has a fixed size.  Each entry keeps the work done under its
+  node, and when the table is more than GC_FULL full the half with the
+  least work is freed, solved or not: those are the cheapest to search
+  again.  Entries are looked for among PROBE_ENTRIES slots, and if none is
+  free, the one with the least work there is replaced.
+
+  usage: dfpn [position] [turn] [plies] [table megabytes] [node limit]
+         dfpn check [positions] [plies] [file]
+
+  A position is 32 characters, one for each square in the order of
+  rules.h: '.' for an empty square, 'r' and 'b' for red and blue men, 'R'
+  and 'B' for kings; the turn is 'r' or 'b'.  Without one a short ending of
+  kings is solved.  Prints the result with a winning move, the nodes
+  searched and the table's use.  With check, random positions from an
+  endgame database (host/endgame.db, from tbgen) are solved, with
+  CHECK_NODES nodes for each search, and compared with it.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "rules.h"
+#include "endgame.h"
+#include "tablebase.h"
+
+#define INFINITE_NUMBER 0x3FFFFFFFu // a proof or disproof number: solved
+#define MAX_PLIES 250 // the most plies a search may look ahead
+#define PROBE_ENTRIES 8 // the slots an entry may be kept in
+#define GC_FULL 0.9 // how full the table gets before it is collected
+#define PLIES_KEY 0x9E3779B97F4A7C15ULL // times the plies left, in a key
+#define CHECK_NODES 4000000 // the nodes each search may take in a check
+#define DEFAULT_POSITION "..........R..........B......B..."
+#define MAX_SLICES 1024
+
+// results
+#define RESULT_UNKNOWN 0
+#define RESULT_WIN 1
+#define RESULT_LOSS 2
+#define RESULT_DRAW 3
+
+/*
+  Struct for a node kept in the table, where:
+
+  key:   its position key with the player to move, and the plies left; 0
+         for a free slot
+  proof, disproof: its numbers
+  work:  the nodes searched under it, in all, up to UINT32_MAX
+*/
+typedef struct {
+  uint64_t key;
+  uint32_t proof;
+  uint32_t disproof;
+  uint32_t work;
+} Entry;
+
+/*
+  Struct for the solver's state, where:
+
+  table, mask: the transposition table, a power of two in size
+  used:        the entries in use
+  peak:        the most entries ever in use
+  collections: the times the table has been collected
+  freed:       the entries freed by them
+  nodes:       the nodes searched
+  limit:       the nodes to stop at, 0 for no limit
+  attacker:    the player the search sets out to prove wins
+*/
+typedef struct {
+  std::vector<Entry> table;
+  uint64_t mask;
+  uint64_t used;
+  uint64_t peak;
+  uint32_t collections;
+  uint64_t freed;
+  uint64_t nodes;
+  uint64_t limit;
+  int8_t attacker;
+} Solver;
+
+static const char* const RESULT_NAMES[4] = {
+  "unknown", "win", "loss", "draw"
+};
+
+static double now_seconds()
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t add_numbers(uint32_t a, uint32_t b)
+{
+  // adds to a proof or disproof number, which only reaches
+  // INFINITE_NUMBER once solved
+  if (a == INFINITE_NUMBER || b == INFINITE_NUMBER) {
+    return INFINITE_NUMBER;
+  }
+  return std::min<uint64_t>((uint64_t) a + b, INFINITE_NUMBER - 1);
+}
+
+static uint64_t node_key(const Board* board, int8_t turn, uint8_t plies)
+{
+  return position_key(board, turn) ^ (plies * PLIES_KEY);
+}
+
+static void clear_solver(Solver* solver, int8_t attacker)
+{
+  std::fill(solver->table.begin(), solver->table.end(), Entry());
+  solver->used = 0;
+  solver->nodes = 0;
+  solver->attacker = attacker;
+}
+
+static void collect_table(Solver* solver)
+{
+  // frees the half of the entries with the least work
+  std::vector<uint32_t> works;
+
+  works.reserve(solver->used);
+  for (const Entry& entry : solver->table) {
+    if (entry.key) {
+      works.push_back(entry.work);
+    }
+  }
+  if (works.empty()) {
+    return;
+  }
+  std::nth_element(works.begin(), works.begin() + works.size() / 2,
+		   works.end());
+  uint32_t least = works[works.size() / 2];
+  for (Entry& entry : solver->table) {
+    if (entry.key && entry.work <= least) {
+      entry.key = 0;
+      solver->used--;
+      solver->freed++;
+    }
+  }
+  solver->collections++;
+}
+
+static void store_entry(Solver* solver, uint64_t key, uint32_t proof,
+			uint32_t disproof, uint64_t work)
+{
+  /*
+    keeps a node's numbers in the table, where:
+
+    solver: the solver
+    key: the node's key
+    proof, disproof: its numbers
+    work: the nodes searched under it this time, added to any before
+   */
+  Entry* slot = NULL;
+
+  if (solver->used >= GC_FULL * solver->table.size()) {
+    collect_table(solver);
+  }
+  for (uint8_t i = 0; i < PROBE_ENTRIES; i++) {
+    Entry* entry = &solver->table[(key + i) & solver->mask];
+    if (entry->key == key) {
+      work += entry->work;
+      slot = entry;
+      break;
+    }
+    if (!slot || (slot->key && (!entry->key || entry->work < slot->work))) {
+      slot = entry;
+    }
+  }
+  if (!slot->key) {
+    solver->used++;
+    solver->peak = std::max(solver->peak, solver->used);
+  }
+  *slot = Entry{key, proof, disproof,
+		(uint32_t) std::min<uint64_t>(work, UINT32_MAX)};
+}
+
+static void look_up(const Solver* solver, uint64_t key, uint32_t* proof,
+		    uint32_t* disproof)
+{
+  // a node's numbers, from the table, or 1 and 1 if it is not there
+  for (uint8_t i = 0; i < PROBE_ENTRIES; i++) {
+    const Entry* entry = &solver->table[(key + i) & solver->mask];
+    if (entry->key == key) {
+      *proof = entry->proof;
+      *disproof = entry->disproof;
+      return;
+    }
+  }
+  *proof = 1;
+  *disproof = 1;
+}
+
+static void search_node(Solver* solver, Board* board, int8_t turn,
+			uint8_t plies, uint32_t proof_limit,
+			uint32_t disproof_limit)
+{
+  /*
+    searches a node until its proof number reaches proof_limit or its
+    disproof number disproof_limit, and keeps its numbers in the table,
+    where:
+
+    solver: the solver
+    board: the position, played on and restored
+    turn: the player to move
+    plies: the plies left for the attacker to win in
+    proof_limit, disproof_limit: the thresholds
+   */
+  uint8_t or_node = turn == solver->attacker;
+  uint64_t key = node_key(board, turn, plies);
+  uint64_t start = solver->nodes++;
+  MoveList list;
+  uint64_t keys[MAX_MOVES];
+  uint32_t proof;
+  uint32_t disproof;
+
+  generate_moves(board, turn, &list);
+  if (!list.count || !plies) {
+    // the player to move has lost, or the attacker has run out of plies
+    uint8_t won = !list.count && !or_node;
+    store_entry(solver, key, won ? 0 : INFINITE_NUMBER,
+		won ? INFINITE_NUMBER : 0, 1);
+    return;
+  }
+
+  for (uint8_t i = 0; i < list.count; i++) {
+    MoveRecord record;
+    make_move(board, &list.moves[i], &record);
+    keys[i] = node_key(board, -turn, plies - 1);
+    unmake_move(board, &record);
+  }
+
+  while (1) {
+    // at an OR node the proof number is the least of the children's, and
+    // the disproof number the greatest of theirs plus one for each other
+    // child not disproved; at an AND node the other way round.  A true sum
+    // would count a node reached by several paths once for each, and with
+    // as many transpositions as the plies make, it soon overflows
+    uint8_t best = 0;
+    uint32_t best_number = INFINITE_NUMBER;
+    uint32_t second = INFINITE_NUMBER;
+    uint32_t most = 0;
+    uint8_t open = 0;
+
+    for (uint8_t i = 0; i < list.count; i++) {
+      uint32_t child_proof;
+      uint32_t child_disproof;
+      look_up(solver, keys[i], &child_proof, &child_disproof);
+      uint32_t number = or_node ? child_proof : child_disproof;
+      uint32_t other = or_node ? child_disproof : child_proof;
+      if (number < best_number) {
+	second = best_number;
+	best_number = number;
+	best = i;
+      }
+      else if (number < second) {
+	second = number;
+      }
+      most = std::max(most, other);
+      open += other != 0;
+    }
+    uint32_t sum = open ? add_numbers(most, open - 1) : 0;
+    proof = or_node ? best_number : sum;
+    disproof = or_node ? sum : best_number;
+    if (proof >= proof_limit || disproof >= disproof_limit ||
+	(solver->limit && solver->nodes >= solver->limit)) {
+      break;
+    }
+
+    // the child's thresholds: the number being minimized may rise to just
+    // past the second best, and the other until it would take this node's
+    // to its limit
+    uint32_t limit = or_node ? proof_limit : disproof_limit;
+    uint32_t other_limit = or_node ? disproof_limit : proof_limit;
+    uint32_t child_limit = std::min(limit, add_numbers(second, 1));
+    uint32_t child_other = other_limit >= INFINITE_NUMBER ?
+      INFINITE_NUMBER : add_numbers(other_limit - sum, most);
+    MoveRecord record;
+    make_move(board, &list.moves[best], &record);
+    search_node(solver, board, -turn, plies - 1,
+		or_node ? child_limit : child_other,
+		or_node ? child_other : child_limit);
+    unmake_move(board, &record);
+  }
+  store_entry(solver, key, proof, disproof, solver->nodes - start);
+}
+
+static uint8_t prove(Solver* solver, Board* board, int8_t turn,
+		     int8_t attacker, uint8_t plies)
+{
+  /*
+    searches for a win for the attacker, where:
+
+    solver: the solver
+    board: the position
+    turn: the player to move
+    attacker: the player to prove wins
+    plies: the plies to win in
+
+    returns 1 if proved, 0 if disproved, and 2 if the node limit was hit
+   */
+  uint32_t proof;
+  uint32_t disproof;
+
+  clear_solver(solver, attacker);
+  search_node(solver, board, turn, plies, INFINITE_NUMBER, INFINITE_NUMBER);
+  look_up(solver, node_key(board, turn, plies), &proof, &disproof);
+  return !proof ? 1 : !disproof ? 0 : 2;
+}
+
+static uint8_t solve(Solver* solver, Board* board, int8_t turn,
+		     uint8_t plies, uint64_t* nodes, Move* win)
+{
+  /*
+    solves a position, where:
+
+    solver: the solver
+    board: the position
+    turn: the player to move
+    plies: the plies either player has to win in
+    nodes: set to the nodes searched, in both searches
+    win: set to a winning move, if the result is a win
+
+    returns the result for the player to move
+   */
+  uint8_t won = prove(solver, board, turn, turn, plies);
+
+  *nodes = solver->nodes;
+  if (won == 1) {
+    MoveList list;
+    generate_moves(board, turn, &list);
+    for (uint8_t i = 0; i < list.count; i++) {
+      MoveRecord record;
+      uint32_t proof;
+      uint32_t disproof;
+      make_move(board, &list.moves[i], &record);
+      look_up(solver, node_key(board, -turn, plies - 1), &proof, &disproof);
+      unmake_move(board, &record);
+      if (!proof) {
+	*win = list.moves[i];
+	break;
+      }
+    }
+    return RESULT_WIN;
+  }
+  if (won == 2) {
+    return RESULT_UNKNOWN;
+  }
+  uint8_t lost = prove(solver, board, turn, -turn, plies);
+  *nodes += solver->nodes;
+  return lost == 1 ? RESULT_LOSS : lost == 0 ? RESULT_DRAW : RESULT_UNKNOWN;
+}
+
+static uint8_t parse_position(const char* text, Board* board)
+{
+  // reads a position as described above; returns 0 if it is not one
+  if (strlen(text) != NUM_SQUARES) {
+    return 0;
+  }
+  board->red = board->blue = board->kings = 0;
+  for (uint8_t square = 0; square < NUM_SQUARES; square++) {
+    uint32_t bit = SQUARE_BIT(square);
+    switch (text[square]) {
+    case 'R':
+      board->kings |= bit;
+      // fall through
+    case 'r':
+      board->red |= bit;
+      break;
+    case 'B':
+      board->kings |= bit;
+      // fall through
+    case 'b':
+      board->blue |= bit;
+      break;
+    case '.':
+      break;
+    default:
+      return 0;
+    }
+  }
+  board->key = compute_key(board);
+  return 1;
+}
+
+static FILE* probed_file; // the database check_solver compares with
+
+static uint8_t read_file_block(uint32_t block, uint8_t* data)
+{
+  fseek(probed_file, (long) block * ENDGAME_BLOCK, SEEK_SET);
+  return fread(data, 1, ENDGAME_BLOCK, probed_file) == ENDGAME_BLOCK;
+}
+
+static int check_solver(Solver* solver, unsigned positions, uint8_t plies,
+			const char* name)
+{
+  /*
+    solves random positions from an endgame database and compares the
+    results with it: a win or loss in more plies than the solver was given
+    should come out a draw, where:
+
+    solver: the solver
+    positions: the number of positions to solve
+    plies: the plies to solve them to
+    name: the database file
+
+    returns 0 if every result agrees
+   */
+  static Tablebase tablebase;
+  static TablebaseSlice entries[MAX_SLICES];
+  static uint8_t block[ENDGAME_BLOCK];
+  uint64_t rng = 0x9E3779B97F4A7C15ULL;
+  unsigned wrong = 0;
+  unsigned unknown = 0;
+  unsigned results[4] = {0, 0, 0, 0};
+  uint64_t nodes = 0;
+  double start = now_seconds();
+
+  probed_file = fopen(name, "rb");
+  if (!probed_file ||
+      !open_tablebase(&tablebase, read_file_block, entries, MAX_SLICES,
+		      block)) {
+    fprintf(stderr, "dfpn: could not read %s\n", name);
+    return 1;
+  }
+  solver->limit = CHECK_NODES;
+  for (unsigned i = 0; i < positions;) {
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+
+    // the material: each piece a red or blue man or king at random
+    uint8_t counts[4] = {0, 0, 0, 0};
+    uint8_t pieces = 2 + (uint8_t) (rng % (tablebase.pieces - 1));
+    for (uint8_t piece = 0; piece < pieces; piece++) {
+      counts[(rng >> (8 + 2 * piece)) & 3]++;
+    }
+    Material material = {counts[0], counts[1], counts[2], counts[3]};
+    if (!(material.red_men + material.red_kings) ||
+	!(material.blue_men + material.blue_kings)) {
+      continue;
+    }
+    Board board;
+    uint32_t index = (uint32_t) ((rng >> 32) % slice_positions(&material));
+    int8_t turn = (rng >> 20) & 1 ? TURN_RED : TURN_BLUE;
+    if (!endgame_position(&material, index, &board)) {
+      continue;
+    }
+    uint8_t value = probe_tablebase(&tablebase, &board, turn);
+    if (value == TABLEBASE_UNKNOWN) {
+      continue;
+    }
+
+    uint8_t expected = value == ENDGAME_DRAW ||
+      ENDGAME_PLIES(value) > plies ? RESULT_DRAW :
+      ENDGAME_WON(value) ? RESULT_WIN : RESULT_LOSS;
+    uint64_t searched;
+    Move win;
+    uint8_t result = solve(solver, &board, turn, plies, &searched, &win);
+    nodes += searched;
+    results[expected]++;
+    if (result == RESULT_UNKNOWN) {
+      unknown++;
+    }
+    else if (result != expected) {
+      wrong++;
+    }
+    i++;
+  }
+  fclose(probed_file);
+  printf("%u positions of up to %u pieces to %u plies (%u wins, %u losses, "
+	 "%u draws): %u wrong, %u unknown, %llu nodes in %.1f s\n",
+	 positions, tablebase.pieces, plies, results[RESULT_WIN],
+	 results[RESULT_LOSS], results[RESULT_DRAW], wrong, unknown,
+	 (unsigned long long) nodes, now_seconds() - start);
+  return wrong != 0;
+}
+
+int main(int argc, char** argv)
+{
+  Solver solver;
+  uint8_t checking = argc > 1 && !strcmp(argv[1], "check");
+  const char* text = argc > 1 && !checking ? argv[1] : DEFAULT_POSITION;
+  const char* turn_name = argc > 2 && !checking ? argv[2] : "b";
+  unsigned plies = argc > 3 ? atoi(argv[3]) : checking ? 20 : 60;
+  unsigned megabytes = argc > 4 && !checking ? atoi(argv[4]) : 64;
+  Board board;
+
+  solver.limit = argc > 5 && !checking ? strtoull(argv[5], NULL, 10) : 0;
+  if (!plies || plies > MAX_PLIES || !megabytes || megabytes > 65536 ||
+      !parse_position(text, &board) ||
+      (strcmp(turn_name, "r") && strcmp(turn_name, "b"))) {
+    fprintf(stderr, "usage: dfpn [position] [turn, r or b] [plies, 1-%u] "
+	    "[table megabytes] [node limit]\n"
+	    "       dfpn check [positions] [plies] [file]\n", MAX_PLIES);
+    return 1;
+  }
+  uint64_t entries = 1;
+  while (entries * 2 * sizeof(Entry) <= ((uint64_t) megabytes << 20)) {
+    entries *= 2;
+  }
+  solver.table.resize(entries);
+  solver.mask = entries - 1;
+  solver.peak = 0;
+  solver.collections = 0;
+  solver.freed = 0;
+
+  if (checking) {
+    return check_solver(&solver, argc > 2 ? atoi(argv[2]) : 200, plies,
+			argc > 4 ? argv[4] : "endgame.db");
+  }
+
+  int8_t turn = turn_name[0] == 'r' ? TURN_RED : TURN_BLUE;
+  uint64_t nodes;
+  Move win;
+  double start = now_seconds();
+  uint8_t result = solve(&solver, &board, turn, plies, &nodes, &win);
+  double seconds = now_seconds() - start;
+
+  printf("%s to move: %s within %u plies", turn == TURN_RED ? "red" : "blue",
+	 RESULT_NAMES[result], plies);
+  if (result == RESULT_WIN) {
+    printf(", with %u%c%u", win.from + 1, win.captured ? 'x' : '-',
+	   win.to + 1);
+  }
+  printf("\n%llu nodes in %.2f s (%.0f nodes/s)\n",
+	 (unsigned long long) nodes, seconds,
+	 seconds > 0 ? nodes / seconds : 0.0);
+  printf("table: %llu entries of %u bytes (%.1f MB), %llu at most in use, "
+	 "%u collections freeing %llu\n", (unsigned long long) entries,
+	 (unsigned) sizeof(Entry), entries * sizeof(Entry) / 1048576.0,
+	 (unsigned long long) solver.peak, solver.collections,
+	 (unsigned long long) solver.freed);
+  return result == RESULT_UNKNOWN;
+}
@@ -0,0 +1,189 @@
+/*
+  A multi-threaded search engine for the host, for analysis and engine
+  work: lazy SMP over the search in ../search.cpp.  Every thread runs its
+  own iterative deepening of the same position, and they share one
+  transposition table without locks (see ../ttable.h), so each finds much
+  of the others' work already done; half of the helpers start a ply ahead
+  of the main thread, so that they fill in the table where it is going
+  next rather than where it is.  The main thread's move is the one played,
+  and once it reaches the depth asked for the helpers are halted.
+
+  usage: engine [max threads] [depth] [table megabytes]
+
+  For 1, 2, 4, ... threads up to the maximum, each test position (the
+  opening and a few from random games) is searched to the given depth, and
+  the total nodes per second and time to depth are reported, with the
+  speedup in time to depth over one thread.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "rules.h"
+#include "search.h"
+#include "ttable.h"
+
+#define MAX_THREADS 64
+#define TEST_POSITIONS 4
+#define RANDOM_PLIES 12 // how far into a random game a test position is
+#define NO_DEADLINE (1UL << 30) // the helpers run until they are halted
+
+static std::atomic<bool> halting;
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+
+static uint32_t rng_next()
+{
+  // xorshift64*, plenty for picking random moves
+  rng_state ^= rng_state >> 12;
+  rng_state ^= rng_state << 25;
+  rng_state ^= rng_state >> 27;
+  return (uint32_t) ((rng_state * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+static double now_seconds()
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t clock_ms()
+{
+  return (uint32_t) (now_seconds() * 1000);
+}
+
+static uint8_t halted()
+{
+  return halting.load(std::memory_order_relaxed);
+}
+
+static uint8_t random_position(Board* board, int8_t* turn)
+{
+  /*
+    plays RANDOM_PLIES random moves from the opening, where:
+
+    board, turn: set to the position reached
+
+    returns 0 if the game ended, or left the player to move with only one
+    move, which is no test of a search
+   */
+  MoveList list;
+  MoveRecord record;
+
+  setup_board(board);
+  *turn = TURN_BLUE;
+  for (uint8_t ply = 0; ply < RANDOM_PLIES; ply++) {
+    generate_moves(board, *turn, &list);
+    if (!list.count) {
+      return 0;
+    }
+    make_move(board, &list.moves[rng_next() % list.count], &record);
+    *turn = -*turn;
+  }
+  generate_moves(board, *turn, &list);
+  return list.count > 1;
+}
+
+static void run_thread(Search* search, uint8_t max_depth)
+{
+  deepen(search, NO_DEADLINE, max_depth);
+}
+
+static uint32_t smp_search(Search* searches, uint8_t threads,
+			   TransTable* table, const Board* board, int8_t turn,
+			   uint8_t depth)
+{
+  /*
+    searches a position to a depth on the given number of threads, where:
+
+    searches: a search for each thread, the first the main one
+    threads: the number of threads
+    table: the table the threads share
+    board, turn: the position to search
+    depth: the depth the main thread is to reach
+
+    returns the milliseconds it took the main thread
+   */
+  std::thread helpers[MAX_THREADS];
+
+  age_table(table);
+  halting.store(false);
+  for (uint8_t i = 0; i < threads; i++) {
+    init_search(&searches[i], clock_ms, table);
+    searches[i].halt = halted;
+    begin_search(&searches[i], board, turn, NULL);
+    searches[i].depth = i & 1; // odd helpers skip the first iteration
+  }
+
+  uint32_t start = clock_ms();
+  for (uint8_t i = 1; i < threads; i++) {
+    helpers[i] = std::thread(run_thread, &searches[i], MAX_PLY);
+  }
+  deepen(&searches[0], NO_DEADLINE, depth);
+  uint32_t elapsed = clock_ms() - start;
+
+  halting.store(true);
+  for (uint8_t i = 1; i < threads; i++) {
+    helpers[i].join();
+  }
+  return elapsed;
+}
+
+int main(int argc, char** argv)
+{
+  unsigned max_threads = argc > 1 ? atoi(argv[1]) : MAX_THREADS;
+  unsigned depth = argc > 2 ? atoi(argv[2]) : 14;
+  unsigned megabytes = argc > 3 ? atoi(argv[3]) : 64;
+  if (max_threads < 1 || max_threads > MAX_THREADS || depth < 1 ||
+      depth > MAX_PLY || !megabytes) {
+    fprintf(stderr, "usage: engine [max threads, 1-%u] [depth, 1-%u] "
+	    "[table megabytes]\n", MAX_THREADS, MAX_PLY);
+    return 1;
+  }
+
+  static Search searches[MAX_THREADS];
+  static TransTable table;
+  uint32_t bytes = (uint32_t) megabytes << 20;
+  if (!init_table(&table, malloc(bytes), bytes)) {
+    fprintf(stderr, "engine: no memory for the table\n");
+    return 1;
+  }
+
+  Board boards[TEST_POSITIONS];
+  int8_t turns[TEST_POSITIONS];
+  setup_board(&boards[0]);
+  turns[0] = TURN_BLUE;
+  for (uint8_t i = 1; i < TEST_POSITIONS; i++) {
+    while (!random_position(&boards[i], &turns[i])) {
+    }
+  }
+
+  printf("lazy SMP, depth %u over %u positions, %u MB table, %u cores\n",
+	 depth, TEST_POSITIONS, megabytes,
+	 std::thread::hardware_concurrency());
+  printf("threads      nodes/s  time to depth  speedup\n");
+
+  uint32_t single = 0;
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+    uint64_t nodes = 0;
+    uint32_t elapsed = 0;
+
+    for (uint8_t i = 0; i < TEST_POSITIONS; i++) {
+      clear_table(&table); // each search starts cold, as the first did
+      elapsed += smp_search(searches, threads, &table, &boards[i],
+			    turns[i], depth);
+      for (unsigned j = 0; j < threads; j++) {
+	nodes += searches[j].nodes;
+      }
+    }
+    if (threads == 1) {
+      single = elapsed;
+    }
+    printf("%7u %12.0f %11u ms %8.2f\n", threads,
+	   elapsed ? nodes / (elapsed / 1000.0) : 0.0, (unsigned) elapsed,
+	   elapsed ? (double) single / elapsed : 0.0);
+  }
+  free(table.buckets);
+  return 0;
+}
@@ -0,0 +1,458 @@
+/*
+  A self-play match between two settings of the search, to tell whether a
+  change makes the computer play better: games are played on all cores at
+  once, the result is turned into an Elo difference, and a sequential
+  probability ratio test (SPRT) says when there are games enough to
+  decide.
+
+  Each player is given a budget for every move, one of:
+    ms:N     - N milliseconds, as the sketch plays (fair only with no more
+               threads than free cores)
+    nodes:N  - the last iteration completed within N nodes, which gives
+               the same games on any machine and under any load
+    depth:N  - iterations to depth N
+  and optionally a transposition table size, as in nodes:20000/4 for a
+  4 MB table (16 MB by default).
+
+  Games are played in pairs from openings of RANDOM_PLIES random moves,
+  each opening once with each player as blue, so that a lopsided opening
+  favors neither.  A game is lost by the player left with no moves, and
+  drawn by the rules' DRAW_PLIES and repetition (see position_drawn) or
+  after MAX_GAME_PLIES.
+
+  The SPRT weighs the hypotheses that A is SPRT_ELO0 or SPRT_ELO1 Elo
+  stronger than B, with SPRT_ALPHA and SPRT_BETA the chances of accepting
+  each wrongly, by the log-likelihood ratio of the score so far (in the
+  normal approximation); the match stops as soon as the ratio leaves its
+  bounds.
+
+  usage: match [games] [threads] [player A] [player B] [records file]
+
+  Reports the results, Elo with its 95% interval, the SPRT verdict, games
+  per second and each player's nodes per second.  With a records file,
+  each game is written to it on a line of its own: its number, the color
+  A played, the result for A (1, = or 0), and the moves from the start,
+  the random ones included, in perft's notation (squares 1-32, - or x
+  between them).
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "rules.h"
+#include "search.h"
+#include "ttable.h"
+
+#define MAX_THREADS 64
+#define RANDOM_PLIES 6 // the random moves each opening starts with
+#define MAX_GAME_PLIES 300 // a game still going then is a draw
+#define REPORT_GAMES 100 // a progress line every so many games
+#define NO_DEADLINE (1UL << 30) // for node and depth budgets
+
+// the SPRT: A is SPRT_ELO0 or SPRT_ELO1 Elo stronger, and the chances of
+// accepting each wrongly
+#define SPRT_ELO0 0.0
+#define SPRT_ELO1 10.0
+#define SPRT_ALPHA 0.05
+#define SPRT_BETA 0.05
+
+// budgets
+#define BUDGET_MS 0
+#define BUDGET_NODES 1
+#define BUDGET_DEPTH 2
+
+/*
+  Struct for the settings of a player, where:
+
+  name:      the setting as given, for the report
+  budget:    BUDGET_MS, BUDGET_NODES or BUDGET_DEPTH
+  amount:    the milliseconds, nodes or depth
+  megabytes: the size of its transposition table
+  moves:     the moves it has searched for in all its games
+  nodes:     the nodes it has searched
+  elapsed:   the microseconds it has searched for
+*/
+typedef struct {
+  const char* name;
+  uint8_t budget;
+  uint32_t amount;
+  uint32_t megabytes;
+  std::atomic<uint64_t> moves;
+  std::atomic<uint64_t> nodes;
+  std::atomic<uint64_t> elapsed;
+} Player;
+
+/*
+  Struct for the results so far, where:
+
+  wins, draws, losses: for A
+  llr:                 the SPRT's log-likelihood ratio
+  verdict:             0 while the SPRT is undecided, 1 once it accepts
+                       SPRT_ELO1, and -1 once it accepts SPRT_ELO0
+*/
+typedef struct {
+  unsigned wins;
+  unsigned draws;
+  unsigned losses;
+  double llr;
+  int verdict;
+} Results;
+
+static Player players[2];
+static Results results;
+static std::mutex results_lock;
+static std::atomic<unsigned> next_pair;
+static unsigned num_games;
+static FILE* records;
+static double start_time;
+
+// a node budget is kept by the search's halt function, which takes no
+// arguments, so each thread says here which search it is running
+static thread_local const Search* running;
+static thread_local uint32_t node_limit;
+
+static double now_seconds()
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t clock_ms()
+{
+  return (uint32_t) (now_seconds() * 1000);
+}
+
+static uint32_t rng_next(uint64_t* state)
+{
+  // xorshift64*, plenty for the openings
+  *state ^= *state >> 12;
+  *state ^= *state << 25;
+  *state ^= *state >> 27;
+  return (uint32_t) ((*state * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+static uint8_t out_of_nodes()
+{
+  return running->nodes >= node_limit;
+}
+
+static uint8_t parse_player(const char* text, Player* player)
+{
+  /*
+    reads a player's settings, where:
+
+    text: the settings, as budget:amount[/megabytes]
+    player: set to them
+
+    returns 0 if they don't make sense
+   */
+  char budget[8];
+  unsigned amount, megabytes = 16;
+
+  if (sscanf(text, "%7[a-z]:%u/%u", budget, &amount, &megabytes) < 2 ||
+      !amount || !megabytes) {
+    return 0;
+  }
+  if (!strcmp(budget, "ms")) {
+    player->budget = BUDGET_MS;
+  }
+  else if (!strcmp(budget, "nodes")) {
+    player->budget = BUDGET_NODES;
+  }
+  else if (!strcmp(budget, "depth") && amount <= MAX_PLY) {
+    player->budget = BUDGET_DEPTH;
+  }
+  else {
+    return 0;
+  }
+  player->name = text;
+  player->amount = amount;
+  player->megabytes = megabytes;
+  return 1;
+}
+
+static void pick_move(Player* player, Search* search, const Board* board,
+		      int8_t turn, const KeyHistory* keys)
+{
+  // searches for a player's move within its budget, leaving it in
+  // search->best
+  double start = now_seconds();
+
+  running = search;
+  node_limit = player->budget == BUDGET_NODES ? player->amount : ~0U;
+  search->halt = player->budget == BUDGET_NODES ? out_of_nodes : NULL;
+  think(search, board, turn, keys,
+	player->budget == BUDGET_MS ? player->amount : NO_DEADLINE,
+	player->budget == BUDGET_DEPTH ? player->amount : MAX_PLY);
+  player->moves++;
+  player->nodes += search->nodes;
+  player->elapsed += (uint64_t) ((now_seconds() - start) * 1e6);
+}
+
+static void add_move(std::string* moves, const Move* move)
+{
+  // writes a move onto a game record, in perft's notation
+  char text[16];
+
+  snprintf(text, sizeof(text), " %u%c%u", move->from + 1,
+	   move->captured ? 'x' : '-', move->to + 1);
+  *moves += text;
+}
+
+static void random_opening(unsigned pair, Board* board, int8_t* turn,
+			   std::string* moves)
+{
+  /*
+    plays RANDOM_PLIES random moves from the opening, the same for both
+    games of a pair, where:
+
+    pair: the number of the pair, which seeds the moves
+    board, turn: set to the position reached
+    moves: set to the moves played, in perft's notation
+   */
+  uint64_t rng = 0x9E3779B97F4A7C15ULL * (pair + 1);
+  MoveList list;
+  MoveRecord record;
+
+  do {
+    setup_board(board);
+    *turn = TURN_BLUE;
+    moves->clear();
+    for (uint8_t ply = 0; ply < RANDOM_PLIES; ply++) {
+      generate_moves(board, *turn, &list);
+      if (!list.count) {
+	break;
+      }
+      Move* move = &list.moves[rng_next(&rng) % list.count];
+      add_move(moves, move);
+      make_move(board, move, &record);
+      *turn = -*turn;
+    }
+    generate_moves(board, *turn, &list);
+  } while (list.count < 2);
+}
+
+static int play_game(Search** searches, const Board* opening, int8_t turn,
+		     int8_t a_turn, std::string* moves)
+{
+  /*
+    plays a game between the players, where:
+
+    searches: a search for A and one for B, with their tables
+    opening, turn: the position to start from
+    a_turn: the color A plays
+    moves: the game's moves are added to it (see add_move)
+
+    returns 1 if A won, -1 if it lost, and 0 for a draw
+   */
+  Board board = *opening;
+  KeyHistory keys;
+  MoveList list;
+  MoveRecord record;
+
+  clear_keys(&keys);
+  push_key(&keys, position_key(&board, turn), 1);
+  for (uint8_t i = 0; i < 2; i++) {
+    clear_table(searches[i]->table);
+  }
+  for (unsigned ply = 0; ply < MAX_GAME_PLIES; ply++) {
+    generate_moves(&board, turn, &list);
+    if (!list.count) {
+      return turn == a_turn ? -1 : 1;
+    }
+    uint8_t side = turn == a_turn ? 0 : 1;
+    pick_move(&players[side], searches[side], &board, turn, &keys);
+    Move move = searches[side]->best;
+
+    add_move(moves, &move);
+    make_move(&board, &move, &record);
+    turn = -turn;
+    push_key(&keys, position_key(&board, turn), record.irreversible);
+    if (position_drawn(&keys)) {
+      return 0;
+    }
+  }
+  return 0;
+}
+
+static double elo_of(double score)
+{
+  // the Elo difference that makes score the expected score
+  return -400 * log10(1 / score - 1);
+}
+
+static double expected_score(double elo)
+{
+  return 1 / (1 + pow(10, -elo / 400));
+}
+
+static void score_stats(const Results* r, double* mean, double* variance)
+{
+  // the mean and variance of the score of a game for A
+  double games = r->wins + r->draws + r->losses;
+  *mean = (r->wins + 0.5 * r->draws) / games;
+  *variance = (r->wins * (1 - *mean) * (1 - *mean) +
+	       r->draws * (0.5 - *mean) * (0.5 - *mean) +
+	       r->losses * *mean * *mean) / games;
+}
+
+static void update_sprt(Results* r)
+{
+  // works out the log-likelihood ratio, and the verdict once it leaves
+  // its bounds
+  double mean, variance;
+  double games = r->wins + r->draws + r->losses;
+  double score0 = expected_score(SPRT_ELO0);
+  double score1 = expected_score(SPRT_ELO1);
+
+  score_stats(r, &mean, &variance);
+  if (variance <= 0) {
+    r->llr = 0; // every game alike so far: no evidence either way
+    return;
+  }
+  r->llr = games * (score1 - score0) * (2 * mean - score0 - score1) /
+    (2 * variance);
+  if (r->llr >= log((1 - SPRT_BETA) / SPRT_ALPHA)) {
+    r->verdict = 1;
+  }
+  else if (r->llr <= log(SPRT_BETA / (1 - SPRT_ALPHA))) {
+    r->verdict = -1;
+  }
+}
+
+static void report(const Results* r)
+{
+  // prints the results so far
+  double mean, variance;
+  unsigned games = r->wins + r->draws + r->losses;
+  double elapsed = now_seconds() - start_time;
+
+  score_stats(r, &mean, &variance);
+  double margin = 1.96 * sqrt(variance / games);
+  printf("%6u games  +%u =%u -%u  Elo %+.1f [%+.1f, %+.1f]  LLR %.2f "
+	 "[%.2f, %.2f]  %.1f games/s\n", games, r->wins, r->draws,
+	 r->losses, mean > 0 && mean < 1 ? elo_of(mean) : 0.0,
+	 mean - margin > 0 ? elo_of(mean - margin) : -INFINITY,
+	 mean + margin < 1 ? elo_of(mean + margin) : INFINITY, r->llr,
+	 log(SPRT_BETA / (1 - SPRT_ALPHA)),
+	 log((1 - SPRT_BETA) / SPRT_ALPHA), games / elapsed);
+  fflush(stdout);
+}
+
+static void add_result(unsigned game, int8_t a_turn, int result,
+		       const std::string* moves)
+{
+  // counts a game, writes its record, and reports now and then
+  std::lock_guard<std::mutex> hold(results_lock);
+  results.wins += result > 0;
+  results.draws += !result;
+  results.losses += result < 0;
+  update_sprt(&results);
+  if (records) {
+    fprintf(records, "%u %s %c%s\n", game + 1,
+	    a_turn == TURN_BLUE ? "blue" : "red",
+	    result > 0 ? '1' : result < 0 ? '0' : '=', moves->c_str());
+  }
+  if (!((results.wins + results.draws + results.losses) % REPORT_GAMES)) {
+    report(&results);
+  }
+}
+
+static void run_worker()
+{
+  // plays pairs of games until there are games enough, or the SPRT has
+  // decided
+  Search* searches[2];
+  for (uint8_t i = 0; i < 2; i++) {
+    uint32_t bytes = players[i].megabytes << 20;
+    searches[i] = new Search;
+    TransTable* table = new TransTable;
+    init_table(table, malloc(bytes), bytes);
+    init_search(searches[i], clock_ms, table);
+  }
+
+  unsigned pair;
+  while ((pair = next_pair++) * 2 < num_games) {
+    {
+      std::lock_guard<std::mutex> hold(results_lock);
+      if (results.verdict) {
+	break;
+      }
+    }
+    Board opening;
+    int8_t turn;
+    std::string opening_moves;
+    random_opening(pair, &opening, &turn, &opening_moves);
+    for (uint8_t color = 0; color < 2; color++) {
+      int8_t a_turn = color ? -turn : turn;
+      std::string moves = opening_moves;
+      int result = play_game(searches, &opening, turn, a_turn, &moves);
+      add_result(2 * pair + color, a_turn, result, &moves);
+    }
+  }
+
+  for (uint8_t i = 0; i < 2; i++) {
+    free(searches[i]->table->buckets);
+    delete searches[i]->table;
+    delete searches[i];
+  }
+}
+
+int main(int argc, char** argv)
+{
+  num_games = argc > 1 ? atoi(argv[1]) : 1000;
+  unsigned threads = argc > 2 ? atoi(argv[2]) :
+    std::thread::hardware_concurrency();
+  const char* a = argc > 3 ? argv[3] : "nodes:20000";
+  const char* b = argc > 4 ? argv[4] : "nodes:10000";
+  const char* records_file = argc > 5 ? argv[5] : NULL;
+  if (!threads) {
+    threads = 1;
+  }
+  if (!num_games || threads > MAX_THREADS ||
+      !parse_player(a, &players[0]) || !parse_player(b, &players[1])) {
+    fprintf(stderr, "usage: match [games] [threads, 1-%u] [player A] "
+	    "[player B] [records file]\n"
+	    "  a player is ms:N, nodes:N or depth:N, with /MB for its "
+	    "table\n", MAX_THREADS);
+    return 1;
+  }
+  if (records_file && !(records = fopen(records_file, "w"))) {
+    fprintf(stderr, "match: could not write %s\n", records_file);
+    return 1;
+  }
+
+  printf("A %s against B %s, up to %u games on %u threads; SPRT of "
+	 "%+.0f against %+.0f Elo\n", players[0].name, players[1].name,
+	 num_games, threads, SPRT_ELO0, SPRT_ELO1);
+  std::thread workers[MAX_THREADS];
+  start_time = now_seconds();
+  for (unsigned i = 0; i < threads; i++) {
+    workers[i] = std::thread(run_worker);
+  }
+  for (unsigned i = 0; i < threads; i++) {
+    workers[i].join();
+  }
+
+  report(&results);
+  printf("SPRT: %s\n", results.verdict > 0 ? "A is stronger (H1)" :
+	 results.verdict < 0 ? "A is no stronger (H0)" : "undecided");
+  for (uint8_t i = 0; i < 2; i++) {
+    printf("%c: %.0f nodes/s, %.0f nodes a move\n", 'A' + i,
+	   players[i].elapsed ?
+	   players[i].nodes / (players[i].elapsed / 1e6) : 0.0,
+	   (double) players[i].nodes /
+	   std::max<uint64_t>(1, players[i].moves.load()));
+  }
+  if (records) {
+    fclose(records);
+  }
+  return 0;
+}
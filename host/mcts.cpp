@@ -0,0 +1,509 @@
+/*
+  A Monte Carlo tree search engine for the host, to set against the
+  alpha-beta search in ../search.cpp on the same move generator.
+
+  The search is UCT: from the root it walks down the tree, at each node
+  taking the child with the best upper confidence bound, until it reaches
+  a node not yet expanded; it expands that node, plays a random game on
+  from it (a playout), and adds the result to every node on the way back
+  up.  A playout that runs past PLAYOUT_PLIES is cut short and scored by
+  evaluate, as a win for the side ahead by at least a man and a draw
+  otherwise, so that kings shuffling about don't run on forever.
+  Repetitions are not tracked inside the tree.
+
+  Nodes come from an arena allocated once and reset before every move, so
+  a search allocates nothing; a node's children are taken from it all at
+  once, next to each other, when it is expanded.  If the arena runs out,
+  the search goes on playing out from the leaves it has.
+
+  Any number of threads can search the one tree at once, without locks:
+  the counts in a node are atomic, a node is expanded by the one thread
+  that claims it, and a thread passing through a node adds a virtual loss
+  to it (VIRTUAL_LOSS visits with no score), which steers the other
+  threads down other lines until its playout's result replaces the loss.
+
+  usage: mcts [max threads] [milliseconds a move] [games] [arena megabytes]
+
+  Reports the playouts per second from the opening for 1, 2, 4, ...
+  threads up to the maximum, next to the nodes per second of alpha-beta,
+  then plays the given number of games between the two (MCTS on the most
+  threads, alpha-beta on one, with the same time a move), from openings
+  of a few random moves, each opening played with both colors.
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "rules.h"
+#include "search.h"
+#include "ttable.h"
+#include "eval.h"
+
+#define MAX_THREADS 64
+#define PLAYOUT_PLIES 80 // a playout past this is scored by evaluate
+#define VIRTUAL_LOSS 3 // the visits a thread passing through a node adds
+#define EXPLORATION 1.4 // the weight of the confidence bound in UCT
+#define RANDOM_PLIES 6 // the random moves each opening starts with
+#define MAX_GAME_PLIES 200 // a game still going then is a draw
+#define MAX_TREE_DEPTH 128 // the deepest a search walks down the tree
+#define TABLE_MEGABYTES 16 // alpha-beta's transposition table
+#define SCALING_MS 2000 // the time each throughput measurement runs for
+
+// the state of a node
+#define LEAF 0
+#define EXPANDING 1
+#define EXPANDED 2
+
+/*
+  Struct for a node of the tree, where:
+
+  move:     the move that leads to it from its parent
+  visits:   the playouts through it, and the virtual losses of the
+            threads passing through it now
+  score:    the results of those playouts, in half points (2 a win, 1 a
+            draw) for the player who made move
+  state:    LEAF, EXPANDING while a thread lists its children, or EXPANDED
+  first:    the arena index of its first child, once EXPANDED
+  children: the number of its children, once EXPANDED; 0 if the game is
+            over there
+*/
+typedef struct {
+  Move move;
+  std::atomic<uint32_t> visits;
+  std::atomic<uint32_t> score;
+  std::atomic<uint8_t> state;
+  uint32_t first;
+  uint8_t children;
+} Node;
+
+/*
+  Struct for the node arena, where:
+
+  nodes: the nodes
+  size:  the number of nodes
+  used:  the number handed out since the last reset; may run past size
+         when the arena is full, and the excess is never used
+*/
+typedef struct {
+  Node* nodes;
+  uint32_t size;
+  std::atomic<uint32_t> used;
+} Arena;
+
+/*
+  Struct for a search of the tree, shared by its threads, where:
+
+  arena:    the nodes; the root is the first
+  board:    the position at the root
+  turn:     the player to move there
+  deadline: the clock reading at which to stop
+  playouts: the playouts made
+*/
+typedef struct {
+  Arena arena;
+  Board board;
+  int8_t turn;
+  double deadline;
+  std::atomic<uint64_t> playouts;
+} Tree;
+
+static uint64_t rng_seed = 0x9E3779B97F4A7C15ULL;
+
+static uint32_t rng_next(uint64_t* state)
+{
+  // xorshift64*, plenty for playouts; each thread has its own state
+  *state ^= *state >> 12;
+  *state ^= *state << 25;
+  *state ^= *state >> 27;
+  return (uint32_t) ((*state * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+static double now_seconds()
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t clock_ms()
+{
+  return (uint32_t) (now_seconds() * 1000);
+}
+
+static uint32_t take_nodes(Arena* arena, uint8_t count)
+{
+  /*
+    hands out consecutive nodes from the arena, cleared, where:
+
+    arena: the arena
+    count: the number of nodes
+
+    returns the index of the first, or arena->size if the arena is full
+   */
+  uint32_t first = arena->used.fetch_add(count);
+  if (first + count > arena->size) {
+    return arena->size;
+  }
+  for (uint32_t i = first; i < first + count; i++) {
+    arena->nodes[i].visits.store(0, std::memory_order_relaxed);
+    arena->nodes[i].score.store(0, std::memory_order_relaxed);
+    arena->nodes[i].state.store(LEAF, std::memory_order_relaxed);
+  }
+  return first;
+}
+
+static void reset_tree(Tree* tree, const Board* board, int8_t turn)
+{
+  // empties the arena and sets up a new root, before each move
+  tree->arena.used.store(0);
+  take_nodes(&tree->arena, 1);
+  tree->board = *board;
+  tree->turn = turn;
+  tree->playouts.store(0);
+}
+
+static uint8_t expand(Tree* tree, Node* node, const Board* board,
+		      int8_t turn)
+{
+  /*
+    lists the children of a leaf, if this thread is the first to get to
+    it, where:
+
+    tree: the tree
+    node: the leaf
+    board, turn: its position
+
+    returns 0 if another thread is expanding it or the arena is full, in
+    which case it stays a leaf
+   */
+  uint8_t leaf = LEAF;
+  if (!node->state.compare_exchange_strong(leaf, EXPANDING)) {
+    return 0;
+  }
+
+  MoveList list;
+  generate_moves(board, turn, &list);
+  uint32_t first = take_nodes(&tree->arena, list.count);
+  if (first == tree->arena.size) {
+    node->state.store(LEAF);
+    return 0;
+  }
+  for (uint8_t i = 0; i < list.count; i++) {
+    tree->arena.nodes[first + i].move = list.moves[i];
+  }
+  node->first = first;
+  node->children = list.count;
+  node->state.store(EXPANDED, std::memory_order_release);
+  return 1;
+}
+
+static Node* select_child(Tree* tree, Node* node)
+{
+  // the child with the best upper confidence bound; one never visited
+  // comes first
+  double log_visits = log((double) node->visits.load() + 1);
+  Node* best = NULL;
+  double best_bound = -1;
+
+  for (uint8_t i = 0; i < node->children; i++) {
+    Node* child = &tree->arena.nodes[node->first + i];
+    uint32_t visits = child->visits.load(std::memory_order_relaxed);
+    if (!visits) {
+      return child;
+    }
+    double bound =
+      child->score.load(std::memory_order_relaxed) / (2.0 * visits) +
+      EXPLORATION * sqrt(log_visits / visits);
+    if (bound > best_bound) {
+      best = child;
+      best_bound = bound;
+    }
+  }
+  return best;
+}
+
+static uint32_t playout(Board* board, int8_t turn, uint64_t* rng)
+{
+  /*
+    plays random moves from a position to the end of the game, or until
+    PLAYOUT_PLIES, where:
+
+    board: the position, played on
+    turn: the player to move
+    rng: the thread's random state
+
+    returns the result in half points for the player to move at the start
+   */
+  MoveList list;
+  MoveRecord record;
+  int8_t mover = turn;
+
+  for (uint8_t ply = 0; ply < PLAYOUT_PLIES; ply++) {
+    generate_moves(board, turn, &list);
+    if (!list.count) {
+      return turn == mover ? 0 : 2;
+    }
+    make_move(board, &list.moves[rng_next(rng) % list.count], &record);
+    turn = -turn;
+  }
+  int16_t score = evaluate(board, mover);
+  return score >= MAN_WEIGHT ? 2 : score <= -MAN_WEIGHT ? 0 : 1;
+}
+
+static void run_search(Tree* tree, unsigned thread)
+{
+  /*
+    one thread's share of a search: selection, expansion, playout and
+    backing up, over and over until the deadline, where:
+
+    tree: the tree
+    thread: the thread's number, which seeds its random state
+   */
+  Node* path[MAX_TREE_DEPTH + 1];
+  uint64_t rng = rng_seed + 0x2545F4914F6CDD1DULL * (thread + 1);
+  uint32_t count = 0;
+
+  while ((count++ & 15) || now_seconds() < tree->deadline) {
+    Board board = tree->board;
+    int8_t turn = tree->turn;
+    MoveRecord record;
+    Node* node = &tree->arena.nodes[0];
+    uint8_t depth = 0;
+
+    // down the tree, leaving a virtual loss in each node passed
+    path[depth++] = node;
+    node->visits.fetch_add(VIRTUAL_LOSS, std::memory_order_relaxed);
+    while (node->state.load(std::memory_order_acquire) == EXPANDED &&
+	   node->children && depth < MAX_TREE_DEPTH) {
+      node = select_child(tree, node);
+      make_move(&board, &node->move, &record);
+      turn = -turn;
+      path[depth++] = node;
+      node->visits.fetch_add(VIRTUAL_LOSS, std::memory_order_relaxed);
+    }
+
+    // a new leaf is expanded, and the playout starts from its first child
+    uint32_t result;
+    if (node->state.load(std::memory_order_acquire) == LEAF &&
+	expand(tree, node, &board, turn) && node->children) {
+      node = &tree->arena.nodes[node->first];
+      make_move(&board, &node->move, &record);
+      turn = -turn;
+      path[depth++] = node;
+      node->visits.fetch_add(VIRTUAL_LOSS, std::memory_order_relaxed);
+    }
+    if (node->state.load(std::memory_order_acquire) == EXPANDED &&
+	!node->children) {
+      result = 0; // the player to move has lost
+    }
+    else {
+      result = playout(&board, turn, &rng);
+    }
+
+    // back up, turning each virtual loss into the visit it stood for
+    while (depth--) {
+      path[depth]->visits.fetch_sub(VIRTUAL_LOSS - 1,
+				    std::memory_order_relaxed);
+      result = 2 - result; // for the player who moved into the node
+      path[depth]->score.fetch_add(result, std::memory_order_relaxed);
+    }
+    tree->playouts.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+static uint8_t mcts_move(Tree* tree, const Board* board, int8_t turn,
+			 unsigned threads, uint32_t budget, Move* move)
+{
+  /*
+    searches a position with MCTS and picks the most visited move, where:
+
+    tree: the tree, reset first
+    board, turn: the position
+    threads: the number of threads to search with
+    budget: the milliseconds to search for
+    move: set to the move
+
+    returns 0 if the player to move has no moves
+   */
+  std::thread helpers[MAX_THREADS];
+  MoveList list;
+
+  generate_moves(board, turn, &list);
+  if (list.count <= 1) {
+    *move = list.moves[0];
+    return list.count;
+  }
+  reset_tree(tree, board, turn);
+  tree->deadline = now_seconds() + budget / 1000.0;
+  for (unsigned i = 1; i < threads; i++) {
+    helpers[i] = std::thread(run_search, tree, i);
+  }
+  run_search(tree, 0);
+  for (unsigned i = 1; i < threads; i++) {
+    helpers[i].join();
+  }
+
+  Node* root = &tree->arena.nodes[0];
+  uint32_t most = 0;
+  *move = list.moves[0];
+  if (root->state.load() != EXPANDED) {
+    return list.count; // not one playout expanded the root
+  }
+  for (uint8_t i = 0; i < root->children; i++) {
+    Node* child = &tree->arena.nodes[root->first + i];
+    if (child->visits.load() > most) {
+      most = child->visits.load();
+      *move = child->move;
+    }
+  }
+  return list.count;
+}
+
+static int play_game(Tree* tree, Search* search, const Board* opening,
+		     int8_t turn, int8_t mcts_turn, unsigned threads,
+		     uint32_t budget)
+{
+  /*
+    plays a game between MCTS and alpha-beta, where:
+
+    tree, search: the two engines
+    opening, turn: the position to start from
+    mcts_turn: the color MCTS plays
+    threads: the threads MCTS searches with
+    budget: the milliseconds each engine has a move
+
+    returns 1 if MCTS won, -1 if it lost, and 0 for a draw
+   */
+  Board board = *opening;
+  KeyHistory keys;
+  MoveRecord record;
+  Move move;
+
+  clear_keys(&keys);
+  push_key(&keys, position_key(&board, turn), 1);
+  clear_table(search->table);
+  for (unsigned ply = 0; ply < MAX_GAME_PLIES; ply++) {
+    uint8_t moves;
+    if (turn == mcts_turn) {
+      moves = mcts_move(tree, &board, turn, threads, budget, &move);
+    }
+    else {
+      moves = think(search, &board, turn, &keys, budget, MAX_PLY);
+      move = search->best;
+    }
+    if (!moves) {
+      return turn == mcts_turn ? -1 : 1;
+    }
+    make_move(&board, &move, &record);
+    turn = -turn;
+    push_key(&keys, position_key(&board, turn), record.irreversible);
+    if (position_drawn(&keys)) {
+      return 0;
+    }
+  }
+  return 0;
+}
+
+static void random_opening(Board* board, int8_t* turn, uint64_t* rng)
+{
+  // plays RANDOM_PLIES random moves from the opening
+  MoveList list;
+  MoveRecord record;
+
+  do {
+    setup_board(board);
+    *turn = TURN_BLUE;
+    for (uint8_t ply = 0; ply < RANDOM_PLIES; ply++) {
+      generate_moves(board, *turn, &list);
+      if (!list.count) {
+	break;
+      }
+      make_move(board, &list.moves[rng_next(rng) % list.count], &record);
+      *turn = -*turn;
+    }
+    generate_moves(board, *turn, &list);
+  } while (list.count < 2);
+}
+
+int main(int argc, char** argv)
+{
+  unsigned max_threads = argc > 1 ? atoi(argv[1]) :
+    std::thread::hardware_concurrency();
+  unsigned budget = argc > 2 ? atoi(argv[2]) : 100;
+  unsigned games = argc > 3 ? atoi(argv[3]) : 10;
+  unsigned megabytes = argc > 4 ? atoi(argv[4]) : 256;
+  if (!max_threads) {
+    max_threads = 1;
+  }
+  if (max_threads > MAX_THREADS || !budget || !megabytes) {
+    fprintf(stderr, "usage: mcts [max threads, 1-%u] "
+	    "[milliseconds a move] [games] [arena megabytes]\n",
+	    MAX_THREADS);
+    return 1;
+  }
+
+  static Tree tree;
+  tree.arena.size = (uint32_t) (((uint64_t) megabytes << 20) / sizeof(Node));
+  tree.arena.nodes = new Node[tree.arena.size];
+  static Search search;
+  static TransTable table;
+  uint32_t bytes = (uint32_t) TABLE_MEGABYTES << 20;
+  if (!init_table(&table, malloc(bytes), bytes)) {
+    fprintf(stderr, "mcts: no memory for the table\n");
+    return 1;
+  }
+  init_search(&search, clock_ms, &table);
+
+  // throughput from the opening
+  Board board;
+  Move move;
+  setup_board(&board);
+  printf("MCTS from the opening, %u ms each, %u MB arena (%u nodes), "
+	 "%u cores\n", SCALING_MS, megabytes, tree.arena.size,
+	 std::thread::hardware_concurrency());
+  printf("threads   playouts/s       nodes  move\n");
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+    double start = now_seconds();
+    mcts_move(&tree, &board, TURN_BLUE, threads, SCALING_MS, &move);
+    double elapsed = now_seconds() - start;
+    uint32_t used = tree.arena.used.load();
+    printf("%7u %12.0f %11u  %u-%u\n", threads,
+	   tree.playouts.load() / elapsed,
+	   used < tree.arena.size ? used : tree.arena.size,
+	   move.from + 1, move.to + 1);
+  }
+  clear_table(&table);
+  think(&search, &board, TURN_BLUE, NULL, SCALING_MS, MAX_PLY);
+  printf("alpha-beta: %.0f nodes/s, depth %u, move %u-%u\n",
+	 search.elapsed ? search.nodes / (search.elapsed / 1000.0) : 0.0,
+	 search.depth, search.best.from + 1, search.best.to + 1);
+
+  // strength against alpha-beta, each opening played with both colors
+  int wins = 0, draws = 0, losses = 0;
+  int8_t turn = TURN_BLUE;
+  uint64_t rng = rng_seed;
+  for (unsigned game = 0; game < games; game++) {
+    if (!(game & 1)) {
+      random_opening(&board, &turn, &rng);
+    }
+    int8_t mcts_turn = (game & 1) ? -turn : turn;
+    int result = play_game(&tree, &search, &board, turn, mcts_turn,
+			   max_threads, budget);
+    wins += result > 0;
+    draws += !result;
+    losses += result < 0;
+    printf("game %u: MCTS (%s) %s\n", game + 1,
+	   mcts_turn == TURN_BLUE ? "blue" : "red",
+	   result > 0 ? "won" : result < 0 ? "lost" : "drew");
+    fflush(stdout);
+  }
+  if (games) {
+    printf("MCTS on %u threads against alpha-beta on 1, %u ms a move: "
+	   "+%d =%d -%d\n", max_threads, budget, wins, draws, losses);
+  }
+  delete[] tree.arena.nodes;
+  free(table.buckets);
+  return 0;
+}
@@ -0,0 +1,278 @@
+/*
+  Perft for the rules core: counts the positions reached after every
+  sequence of legal moves to a depth, the standard check on a move
+  generator, and times it.  A capture sequence counts as one move, as it
+  does in generate_moves, so the counts cover the double jump rules too.
+
+  The tree is split across a pool of threads that steal work from each
+  other: each thread keeps a queue of subtrees, runs the newest of its own,
+  and when it runs out takes the oldest (and so largest) from another's.
+  Subtrees deeper than SPLIT_DEPTH are split into their children rather
+  than counted, so there are always subtrees to steal.  An optional cache
+  remembers the counts of positions already counted, shared by the threads
+  without locks.
+
+  usage: perft [depth] [threads] [cache megabytes, 0 for none]
+
+  Prints the count under each move from the opening set up by SETUP_MODE
+  (blue to move), the total, and the positions counted per second.
+  Squares are numbered 1-32 in the order of rules.h, and captures are
+  written with an x.
+
+  The counts match English draughts (7, 49, 302, 1469) until men start
+  jumping backward after their first hop, which the English rules do not
+  allow: from depth 5 on they are this game's own (7493, 38110, 191466,
+  939159, 4634555, 22851779 at depth 10).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "rules.h"
+
+#define MAX_THREADS 64
+#define SPLIT_DEPTH 5 // subtrees at least this deep are split, not counted
+
+/*
+  Struct for a subtree waiting to be counted, where:
+
+  board: the position at its root
+  turn:  the player to move there
+  depth: the plies left to count
+  root:  the opening move it is under, for the divide
+*/
+typedef struct {
+  Board board;
+  int8_t turn;
+  uint8_t depth;
+  uint8_t root;
+} Task;
+
+/*
+  Struct for a cached count, where:
+
+  check: the position key (with the player to move) XOR data, so that an
+         entry torn by two threads writing it at once fails to match
+  data:  the count, above the depth it was counted to in the low byte
+*/
+typedef struct {
+  std::atomic<uint64_t> check;
+  std::atomic<uint64_t> data;
+} CacheEntry;
+
+typedef struct {
+  std::deque<Task> tasks;
+  std::mutex lock;
+} WorkQueue;
+
+static WorkQueue queues[MAX_THREADS];
+static unsigned num_threads;
+static std::atomic<uint32_t> pending; // tasks queued or being counted
+static std::atomic<uint64_t> divide[MAX_MOVES];
+static CacheEntry* cache;
+static uint64_t cache_mask;
+
+static double now_seconds()
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint8_t probe_cache(uint64_t key, uint8_t depth, uint64_t* count)
+{
+  CacheEntry* entry = &cache[key & cache_mask];
+  uint64_t data = entry->data.load(std::memory_order_relaxed);
+  uint64_t check = entry->check.load(std::memory_order_relaxed);
+
+  if ((check ^ data) != key || (data & 0xFF) != depth) {
+    return 0;
+  }
+  *count = data >> 8;
+  return 1;
+}
+
+static void store_cache(uint64_t key, uint8_t depth, uint64_t count)
+{
+  CacheEntry* entry = &cache[key & cache_mask];
+  uint64_t data = (count << 8) | depth;
+
+  entry->data.store(data, std::memory_order_relaxed);
+  entry->check.store(key ^ data, std::memory_order_relaxed);
+}
+
+static uint64_t perft(Board* board, int8_t turn, uint8_t depth)
+{
+  /*
+    counts the positions depth plies from a position, where:
+
+    board: the position, played on and restored
+    turn: the player to move
+    depth: the plies to count to
+   */
+  MoveList list;
+  MoveRecord record;
+  uint64_t key = 0;
+  uint64_t count = 0;
+
+  if (!depth) {
+    return 1;
+  }
+  generate_moves(board, turn, &list);
+  if (depth == 1) {
+    return list.count;
+  }
+  if (cache) {
+    key = position_key(board, turn);
+    if (probe_cache(key, depth, &count)) {
+      return count;
+    }
+  }
+
+  for (uint8_t i = 0; i < list.count; i++) {
+    make_move(board, &list.moves[i], &record);
+    count += perft(board, -turn, depth - 1);
+    unmake_move(board, &record);
+  }
+  if (cache) {
+    store_cache(key, depth, count);
+  }
+  return count;
+}
+
+static void push_task(unsigned thread, const Task* task)
+{
+  std::lock_guard<std::mutex> hold(queues[thread].lock);
+  queues[thread].tasks.push_back(*task);
+}
+
+static uint8_t take_task(unsigned thread, Task* task)
+{
+  /*
+    takes the newest task from a thread's own queue, or failing that steals
+    the oldest from another thread's, where:
+
+    thread: the thread taking the task
+    task: set to the task taken
+
+    returns 0 if every queue is empty
+   */
+  {
+    std::lock_guard<std::mutex> hold(queues[thread].lock);
+    if (!queues[thread].tasks.empty()) {
+      *task = queues[thread].tasks.back();
+      queues[thread].tasks.pop_back();
+      return 1;
+    }
+  }
+  for (unsigned i = 1; i < num_threads; i++) {
+    WorkQueue* victim = &queues[(thread + i) % num_threads];
+    std::lock_guard<std::mutex> hold(victim->lock);
+    if (!victim->tasks.empty()) {
+      *task = victim->tasks.front();
+      victim->tasks.pop_front();
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void run_worker(unsigned thread)
+{
+  Task task;
+
+  while (pending.load()) {
+    if (!take_task(thread, &task)) {
+      std::this_thread::yield(); // the last tasks are still being split
+      continue;
+    }
+
+    if (task.depth < SPLIT_DEPTH) {
+      divide[task.root] += perft(&task.board, task.turn, task.depth);
+    }
+    else {
+      // split the subtree into its children, for this thread or others
+      MoveList list;
+      MoveRecord record;
+      generate_moves(&task.board, task.turn, &list);
+      pending += list.count;
+      for (uint8_t i = 0; i < list.count; i++) {
+	Task child = task;
+	make_move(&child.board, &list.moves[i], &record);
+	child.turn = -task.turn;
+	child.depth = task.depth - 1;
+	push_task(thread, &child);
+      }
+    }
+    pending--;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  unsigned depth = argc > 1 ? atoi(argv[1]) : 10;
+  num_threads = argc > 2 ? atoi(argv[2]) :
+    std::thread::hardware_concurrency();
+  unsigned megabytes = argc > 3 ? atoi(argv[3]) : 64;
+  if (!num_threads) {
+    num_threads = 1;
+  }
+  if (depth < 1 || depth > 255 || num_threads > MAX_THREADS) {
+    fprintf(stderr, "usage: perft [depth] [threads, 1-%u] "
+	    "[cache megabytes, 0 for none]\n", MAX_THREADS);
+    return 1;
+  }
+  if (megabytes) {
+    uint64_t entries = 1;
+    while (2 * entries * sizeof(CacheEntry) <= ((uint64_t) megabytes << 20)) {
+      entries *= 2;
+    }
+    cache = new CacheEntry[entries](); // zeroed, depth 0: never a match
+    cache_mask = entries - 1;
+  }
+
+  // the opening, as SETUP_MODE leaves it: blue moves first
+  Board board;
+  MoveList list;
+  setup_board(&board);
+  generate_moves(&board, TURN_BLUE, &list);
+
+  double start = now_seconds();
+  pending = list.count;
+  for (uint8_t i = 0; i < list.count; i++) {
+    Task task;
+    MoveRecord record;
+    task.board = board;
+    make_move(&task.board, &list.moves[i], &record);
+    task.turn = TURN_RED;
+    task.depth = depth - 1;
+    task.root = i;
+    divide[i] = 0;
+    push_task(i % num_threads, &task);
+  }
+  std::thread workers[MAX_THREADS];
+  for (unsigned i = 0; i < num_threads; i++) {
+    workers[i] = std::thread(run_worker, i);
+  }
+  for (unsigned i = 0; i < num_threads; i++) {
+    workers[i].join();
+  }
+  double elapsed = now_seconds() - start;
+
+  uint64_t total = 0;
+  for (uint8_t i = 0; i < list.count; i++) {
+    printf("%2u%c%-2u %14llu\n", list.moves[i].from + 1,
+	   list.moves[i].captured ? 'x' : '-', list.moves[i].to + 1,
+	   (unsigned long long) divide[i].load());
+    total += divide[i];
+  }
+  printf("\nperft %u: %llu positions in %.3f s, %.0f positions/s "
+	 "(%u threads, %u MB cache)\n", depth, (unsigned long long) total,
+	 elapsed, elapsed > 0 ? total / elapsed : 0.0, num_threads,
+	 cache ? megabytes : 0);
+  delete[] cache;
+  return 0;
+}
@@ -0,0 +1,760 @@
+/*
+  Builds the endgame database (see ../endgame.h) for every position with
+  up to the given number of checkers, by retrograde analysis on all the
+  cores, and writes it out as a block-compressed file with a block index.
+
+  usage: tbgen [pieces] [threads] [file] [bitbase header]
+
+  Slices are solved fewest checkers first and, among those with as many,
+  fewest men first. Each move either stays in its slice, goes to the
+  mirror slice (the same material with the colors swapped), captures into
+  a slice with fewer checkers, or crowns into one with fewer men. So each
+  slice and its mirror are solved together, and every other slice a
+  position can reach is already done.
+
+  They are solved in passes.  Pass 0 marks the positions with no moves,
+  which are lost for the player to move.  Pass n marks the positions won
+  in n plies (n odd) or lost in n plies (n even):
+    - a position is won in n if a move reaches a position lost in n - 1;
+    - it is lost in n if every move reaches a position won by the other
+      player, and the longest of those wins is n - 1.
+  A pass only ever reads values from earlier passes, so the threads can
+  split a pass between them in any order and still agree on the result.
+  Passes stop once two in a row find nothing new and no slice already
+  done has a longer result that could still arrive.  Whatever is left is
+  a draw.
+
+  The file is checked by probing every position back through
+  ../tablebase.cpp, as the sketch would, before the tool finishes.  The
+  sketch reads it from the card's root folder as ENDGAME_FILE (see
+  ../projectnew.cpp), a block at a time with no file system in the way,
+  so the file must lie in one piece: copy it first onto a freshly
+  formatted card.
+
+  Given a bitbase header, it also writes the bits of the bitbase compiled
+  into the sketch (see ../bitbase.h) there, which takes at least
+  BITBASE_KING_PIECES pieces; otherwise it checks the bitbase it was
+  built with against what it solved.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "rules.h"
+#include "endgame.h"
+#include "bitbase.h"
+#include "tablebase.h"
+
+#define MAX_THREADS 64
+#define UNUSED 0xFF // an index with no position, while solving
+#define CHUNK_POSITIONS 4096 // the positions a thread takes at a time
+
+typedef struct {
+  Material material;
+  uint32_t positions;
+  std::unique_ptr<std::atomic<uint8_t>[]> values;
+  uint8_t solved;
+  uint8_t longest; // the largest value in the slice, once solved
+} Slice;
+
+static std::vector<Slice> slices; // in the order of slice_number
+static unsigned num_threads;
+
+static double now_seconds()
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint8_t child_value(const Board* board, const Move* move)
+{
+  /*
+    the value of the position a move leaves, for the player to move there,
+    where:
+
+    board: the position, with red to move
+    move: the move
+   */
+  Board child = *board;
+  MoveRecord record;
+  Material material;
+
+  make_move(&child, move, &record);
+  flip_board(&child);
+  board_material(&child, &material);
+  if (!(material.red_men + material.red_kings)) {
+    return ENDGAME_VALUE(0); // the last checker was taken
+  }
+  Slice* slice = &slices[slice_number(&material)];
+  return slice->values[endgame_index(&child, &material)].load(
+    std::memory_order_relaxed);
+}
+
+static uint8_t solve_position(const Material* material, uint32_t index,
+			      uint8_t pass)
+{
+  /*
+    works out whether a position is decided in this pass, where:
+
+    material, index: the position
+    pass: the pass, 0 for positions with no moves
+
+    returns the position's new value, or ENDGAME_DRAW if it is not decided
+    in this pass
+   */
+  Board board;
+  MoveList list;
+
+  endgame_position(material, index, &board);
+  generate_moves(&board, TURN_RED, &list);
+  if (!pass) {
+    return list.count ? ENDGAME_DRAW : ENDGAME_VALUE(0);
+  }
+
+  uint8_t longest = 0;
+  for (uint8_t i = 0; i < list.count; i++) {
+    uint8_t value = child_value(&board, &list.moves[i]);
+
+    if (pass & 1) {
+      // a win: one move reaching a loss in pass - 1 is enough
+      if (ENDGAME_LOST(value) && ENDGAME_PLIES(value) == pass - 1) {
+	return ENDGAME_VALUE(pass);
+      }
+    }
+    else {
+      // a loss: every move has to reach a win, decided already
+      if (!ENDGAME_WON(value)) {
+	return ENDGAME_DRAW;
+      }
+      if (value > longest) {
+	longest = value;
+      }
+    }
+  }
+  return (!(pass & 1) && ENDGAME_PLIES(longest) == pass - 1) ?
+    ENDGAME_VALUE(pass) : ENDGAME_DRAW;
+}
+
+static uint64_t whole_chunks(const Slice* slice)
+{
+  // the positions of a slice, rounded up to whole chunks
+  return ((slice->positions + CHUNK_POSITIONS - 1) / CHUNK_POSITIONS) *
+    CHUNK_POSITIONS;
+}
+
+static void run_pass(Slice** group, uint8_t members, uint8_t pass,
+		     std::atomic<uint64_t>* next, std::atomic<uint64_t>* found)
+{
+  /*
+    one thread's share of a pass over a slice and its mirror, taking
+    CHUNK_POSITIONS at a time until none are left, where:
+
+    group, members: the slices
+    pass: the pass
+    next: the next position to take, counting through the slices in turn,
+      each rounded up to whole chunks so that no chunk spans two
+    found: counts the positions decided
+   */
+  uint64_t decided = 0;
+
+  for (;;) {
+    uint64_t start = next->fetch_add(CHUNK_POSITIONS);
+    uint8_t member = 0;
+    while (member < members && start >= whole_chunks(group[member])) {
+      start -= whole_chunks(group[member]);
+      member++;
+    }
+    if (member == members) {
+      break;
+    }
+
+    Slice* slice = group[member];
+    uint64_t end = start + CHUNK_POSITIONS;
+    if (end > slice->positions) {
+      end = slice->positions;
+    }
+    for (uint32_t index = start; index < end; index++) {
+      if (slice->values[index].load(std::memory_order_relaxed) !=
+	  ENDGAME_DRAW) {
+	continue;
+      }
+      uint8_t value = solve_position(&slice->material, index, pass);
+      if (value != ENDGAME_DRAW) {
+	slice->values[index].store(value, std::memory_order_relaxed);
+	decided++;
+      }
+    }
+  }
+  *found += decided;
+}
+
+static void solve_group(Slice** group, uint8_t members, uint8_t longest_done)
+{
+  /*
+    solves a slice together with its mirror, where:
+
+    group, members: the slices, one if the slice is its own mirror
+    longest_done: the largest value in any slice already solved
+   */
+  // mark the indices with no position, which no pass need look at
+  for (uint8_t i = 0; i < members; i++) {
+    Slice* slice = group[i];
+    slice->values.reset(new std::atomic<uint8_t>[slice->positions]);
+    for (uint32_t index = 0; index < slice->positions; index++) {
+      Board board;
+      slice->values[index].store(
+	endgame_position(&slice->material, index, &board) ?
+	ENDGAME_DRAW : UNUSED, std::memory_order_relaxed);
+    }
+  }
+
+  uint8_t quiet = 0;
+  for (unsigned pass = 0; pass <= MAX_ENDGAME_PLIES; pass++) {
+    std::atomic<uint64_t> next(0);
+    std::atomic<uint64_t> found(0);
+    std::thread workers[MAX_THREADS];
+
+    for (unsigned i = 0; i < num_threads; i++) {
+      workers[i] = std::thread(run_pass, group, members, pass, &next,
+			       &found);
+    }
+    for (unsigned i = 0; i < num_threads; i++) {
+      workers[i].join();
+    }
+
+    quiet = found ? 0 : quiet + 1;
+    if (quiet >= 2 && ENDGAME_VALUE(pass) > longest_done + 1) {
+      break;
+    }
+    if (pass == MAX_ENDGAME_PLIES && found) {
+      fprintf(stderr, "tbgen: results longer than %u plies are cut short\n",
+	      MAX_ENDGAME_PLIES);
+    }
+  }
+
+  for (uint8_t i = 0; i < members; i++) {
+    Slice* slice = group[i];
+    slice->longest = 0;
+    for (uint32_t index = 0; index < slice->positions; index++) {
+      uint8_t value = slice->values[index].load(std::memory_order_relaxed);
+      if (value != UNUSED && value > slice->longest) {
+	slice->longest = value;
+      }
+    }
+    slice->solved = 1;
+  }
+}
+
+static uint16_t encode_block(const Slice* slice, uint32_t* first,
+			     uint8_t* block)
+{
+  /*
+    codes the values of as many positions as fit into a block as runs and
+    literals (see block_value), never splitting a run, where:
+
+    slice: the slice
+    first: the first position to code, moved on past the last one coded
+    block: the block, ENDGAME_BLOCK bytes, zeroed past the code
+
+    returns the bytes used
+   */
+  uint16_t used = 0;
+  uint16_t literal = 0; // the control byte of the open literal
+  uint16_t literal_values = 0; // the values in it, 0 with none open
+  uint32_t index = *first;
+
+  memset(block, 0, ENDGAME_BLOCK);
+  while (index < slice->positions) {
+    uint8_t value = slice->values[index].load(std::memory_order_relaxed);
+    uint32_t run = 1;
+    while (index + run < slice->positions &&
+	   slice->values[index + run].load(std::memory_order_relaxed) ==
+	   value) {
+      run++;
+    }
+
+    if (run < ENDGAME_MIN_RUN) {
+      // a short run joins the open literal a value at a time, or opens
+      // one, and may be split between blocks
+      uint8_t open = literal_values && literal_values < ENDGAME_MAX_LITERAL;
+      if (used + (open ? 1 : 2) > ENDGAME_BLOCK) {
+	break;
+      }
+      if (!open) {
+	literal = used++;
+	literal_values = 0;
+      }
+      block[literal] = literal_values++;
+      block[used++] = value;
+      index++;
+      continue;
+    }
+
+    uint8_t code[8];
+    uint8_t length = 0;
+    uint32_t left = run - ENDGAME_MIN_RUN;
+    code[length++] = ENDGAME_RUN | (left & 0x3F) |
+      ((left > 0x3F) ? ENDGAME_RUN_MORE : 0);
+    for (left >>= 6; left; left >>= 7) {
+      code[length++] = (left & 0x7F) | ((left > 0x7F) ? 0x80 : 0);
+    }
+    code[length++] = value;
+    if (used + length > ENDGAME_BLOCK) {
+      break; // the run starts the next block
+    }
+    memcpy(&block[used], code, length);
+    used += length;
+    index += run;
+    literal_values = 0;
+  }
+  *first = index;
+  return used;
+}
+
+static void fill_unused(Slice* slice)
+{
+  // gives the indices with no position the value before them, which costs
+  // nothing in a run
+  uint8_t last = ENDGAME_DRAW;
+  for (uint32_t index = 0; index < slice->positions; index++) {
+    uint8_t value = slice->values[index].load(std::memory_order_relaxed);
+    if (value == UNUSED) {
+      slice->values[index].store(last, std::memory_order_relaxed);
+    }
+    else {
+      last = value;
+    }
+  }
+}
+
+static uint32_t data_block_of(const std::vector<uint32_t>& firsts,
+			      uint32_t position)
+{
+  // the data block of a slice holding a position, given the first position
+  // in each of its data blocks
+  return std::upper_bound(firsts.begin(), firsts.end(), position) -
+    firsts.begin() - 1;
+}
+
+static uint32_t choose_index_positions(const Slice* slice,
+				       const std::vector<uint32_t>& firsts)
+{
+  // the most positions for each block of a slice's index, a power of two,
+  // for which none of its blocks has more than ENDGAME_INDEX_ENTRIES data
+  // blocks to list; one position always fits
+  uint32_t index_positions = 1;
+
+  while (index_positions < slice->positions) {
+    index_positions *= 2;
+  }
+  for (; index_positions > 1; index_positions /= 2) {
+    uint8_t fits = 1;
+    for (uint32_t start = 0; fits && start < slice->positions;
+	 start += index_positions) {
+      uint32_t end = start + index_positions;
+      if (end > slice->positions) {
+	end = slice->positions;
+      }
+      fits = data_block_of(firsts, end - 1) - data_block_of(firsts, start) <
+	ENDGAME_INDEX_ENTRIES;
+    }
+    if (fits) {
+      break;
+    }
+  }
+  return index_positions;
+}
+
+static long write_file(const char* name, uint8_t pieces)
+{
+  /*
+    writes the database file, where:
+
+    name: the file name
+    pieces: the most checkers in a slice
+
+    returns the file size in bytes, or -1 if it could not be written
+   */
+  FILE* file = fopen(name, "wb");
+  if (!file) {
+    return -1;
+  }
+
+  // code every slice first, to know where each one's blocks will go
+  std::vector<std::vector<uint8_t> > data(slices.size());
+  std::vector<std::vector<uint32_t> > firsts(slices.size());
+  std::vector<uint32_t> index_positions(slices.size());
+  for (size_t i = 0; i < slices.size(); i++) {
+    uint32_t first = 0;
+    while (first < slices[i].positions) {
+      uint8_t block[ENDGAME_BLOCK];
+      firsts[i].push_back(first);
+      encode_block(&slices[i], &first, block);
+      data[i].insert(data[i].end(), block, block + ENDGAME_BLOCK);
+    }
+    index_positions[i] = choose_index_positions(&slices[i], firsts[i]);
+  }
+
+  uint32_t directory_bytes = sizeof(EndgameHeader) +
+    slices.size() * sizeof(EndgameSlice);
+  uint32_t block = (directory_bytes + ENDGAME_BLOCK - 1) / ENDGAME_BLOCK;
+  std::vector<uint8_t> directory(block * ENDGAME_BLOCK, 0);
+
+  EndgameHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = ENDGAME_MAGIC;
+  header.version = ENDGAME_VERSION;
+  header.pieces = pieces;
+  header.slices = slices.size();
+  memcpy(&directory[0], &header, sizeof(header));
+
+  for (size_t i = 0; i < slices.size(); i++) {
+    EndgameSlice entry;
+    entry.material = slices[i].material;
+    entry.positions = slices[i].positions;
+    entry.blocks = firsts[i].size();
+    entry.index_positions = index_positions[i];
+    entry.index_block = block;
+    entry.first_block = block + (slices[i].positions + index_positions[i] -
+				 1) / index_positions[i];
+    memcpy(&directory[sizeof(header) + i * sizeof(entry)], &entry,
+	   sizeof(entry));
+    block = entry.first_block + entry.blocks;
+  }
+  fwrite(&directory[0], 1, directory.size(), file);
+
+  for (size_t i = 0; i < slices.size(); i++) {
+    // each block of the index: its first data block, then the first
+    // position in that one and every later one starting in its range
+    for (uint32_t start = 0; start < slices[i].positions;
+	 start += index_positions[i]) {
+      uint32_t index[ENDGAME_INDEX_ENTRIES + 1];
+      uint32_t data_block = data_block_of(firsts[i], start);
+      index[0] = data_block;
+      for (uint8_t j = 1; j <= ENDGAME_INDEX_ENTRIES; j++, data_block++) {
+	index[j] = (data_block < firsts[i].size() &&
+		    (j == 1 || firsts[i][data_block] <
+		     start + index_positions[i])) ?
+	  firsts[i][data_block] : ENDGAME_NO_POSITION;
+      }
+      fwrite(index, 1, sizeof(index), file); // little-endian, as required
+    }
+    fwrite(data[i].data(), 1, data[i].size(), file);
+  }
+  long size = ftell(file);
+  return fclose(file) ? -1 : size;
+}
+
+static FILE* probed_file; // the file check_file reads through a Tablebase
+
+static uint8_t read_file_block(uint32_t block, uint8_t* data)
+{
+  fseek(probed_file, (long) block * ENDGAME_BLOCK, SEEK_SET);
+  return fread(data, 1, ENDGAME_BLOCK, probed_file) == ENDGAME_BLOCK;
+}
+
+static uint64_t check_file(const char* name, uint32_t* most_reads)
+{
+  /*
+    probes every position of a database file through open_tablebase and
+    probe_tablebase, as the sketch does, and compares it with the solved
+    slices, where:
+
+    name: the file name
+    most_reads: set to the most blocks any one probe read
+
+    returns the number of positions that differ
+   */
+  static Tablebase tablebase;
+  static uint8_t block[ENDGAME_BLOCK];
+  std::vector<TablebaseSlice> entries(slices.size());
+  uint64_t wrong = 0;
+
+  *most_reads = 0;
+  probed_file = fopen(name, "rb");
+  if (!probed_file ||
+      !open_tablebase(&tablebase, read_file_block, entries.data(),
+		      entries.size(), block)) {
+    if (probed_file) {
+      fclose(probed_file);
+    }
+    return ~0ULL;
+  }
+
+  for (size_t i = 0; i < slices.size(); i++) {
+    const Slice* slice = &slices[i];
+    for (uint32_t index = 0; index < slice->positions; index++) {
+      Board board;
+      if (!endgame_position(&slice->material, index, &board)) {
+	continue;
+      }
+      uint32_t reads = tablebase.reads;
+      if (probe_tablebase(&tablebase, &board, TURN_RED) !=
+	  slice->values[index].load(std::memory_order_relaxed)) {
+	wrong++;
+      }
+      if (tablebase.reads - reads > *most_reads) {
+	*most_reads = tablebase.reads - reads;
+      }
+    }
+  }
+  fclose(probed_file);
+  return wrong;
+}
+
+static uint8_t bitbase_covers(const Slice* slice)
+{
+  const Material* material = &slice->material;
+  uint8_t total = material->red_men + material->red_kings +
+    material->blue_men + material->blue_kings;
+  return BITBASE_COVERS(material, total);
+}
+
+static long write_bitbase(const char* name, uint64_t* conflicts)
+{
+  /*
+    writes the bitbase's data as a header for the sketch (see bitbase.h),
+    where:
+
+    name: the file name
+    conflicts: set to the number of positions whose bit differs from that
+      of another position with the same index, which would be a bug in
+      bitbase_index
+
+    returns the bytes of bits, or -1 if the file could not be written
+   */
+  std::vector<uint32_t> starts(slices.size(), ~0U);
+  std::vector<uint8_t> bits;
+  uint32_t total = 0;
+
+  for (size_t i = 0; i < slices.size(); i++) {
+    if (bitbase_covers(&slices[i])) {
+      starts[i] = total;
+      total += bitbase_positions(&slices[i].material);
+    }
+  }
+  bits.resize((total + 7) / 8, 0);
+
+  // every position sets its bit; a won position whose index another
+  // position has already left clear conflicts with it, and the other way
+  std::vector<uint8_t> seen(bits.size(), 0);
+  *conflicts = 0;
+  for (size_t i = 0; i < slices.size(); i++) {
+    if (starts[i] == ~0U) {
+      continue;
+    }
+    Slice* slice = &slices[i];
+    for (uint32_t index = 0; index < slice->positions; index++) {
+      Board board;
+      if (!endgame_position(&slice->material, index, &board)) {
+	continue;
+      }
+      uint32_t bit = starts[i] + bitbase_index(&board, &slice->material);
+      uint8_t mask = 1 << (bit % 8);
+      uint8_t won = ENDGAME_WON(
+	slice->values[index].load(std::memory_order_relaxed)) ? mask : 0;
+      if ((seen[bit / 8] & mask) && (bits[bit / 8] & mask) != won) {
+	(*conflicts)++;
+      }
+      seen[bit / 8] |= mask;
+      bits[bit / 8] |= won;
+    }
+  }
+
+  FILE* file = fopen(name, "w");
+  if (!file) {
+    return -1;
+  }
+  fprintf(file, "/*\n"
+	  "  The endgame bitbase's bits (see bitbase.h), written by\n"
+	  "  host/tbgen.cpp: do not edit.\n"
+	  "*/\n\n"
+	  "#ifndef _BITBASE_DATA_H\n"
+	  "#define _BITBASE_DATA_H\n\n"
+	  "#define BITBASE_ABSENT 0xFFFFFFFFUL // a slice not in the bitbase"
+	  "\n\n"
+	  "// the first bit of each slice, in the order of slice_number\n"
+	  "static const uint32_t BITBASE_SLICE_STARTS[%u] PROGMEM = {\n",
+	  (unsigned) slices.size());
+  for (size_t i = 0; i < slices.size(); i++) {
+    const Material* material = &slices[i].material;
+    if (starts[i] == ~0U) {
+      fprintf(file, "  BITBASE_ABSENT");
+    }
+    else {
+      fprintf(file, "  %luUL", (unsigned long) starts[i]);
+    }
+    fprintf(file, "%s // %u%u%u%u\n", i + 1 < slices.size() ? "," : "",
+	    material->red_men, material->red_kings, material->blue_men,
+	    material->blue_kings);
+  }
+  fprintf(file, "};\n\n"
+	  "static const uint8_t BITBASE_BITS[%u] PROGMEM_FAR = {\n",
+	  (unsigned) bits.size());
+  for (size_t i = 0; i < bits.size(); i++) {
+    fprintf(file, "%s0x%02X%s", i % 12 ? " " : "  ", bits[i],
+	    i + 1 == bits.size() ? "\n" : (i % 12 == 11) ? ",\n" : ",");
+  }
+  fprintf(file, "};\n\n#endif\n");
+  return fclose(file) ? -1 : (long) bits.size();
+}
+
+static uint64_t check_bitbase()
+{
+  // compares every solved position the compiled-in bitbase covers with
+  // probe_bitbase, and returns the number that differ
+  uint64_t wrong = 0;
+
+  for (size_t i = 0; i < slices.size(); i++) {
+    if (!bitbase_covers(&slices[i])) {
+      continue;
+    }
+    Slice* slice = &slices[i];
+    for (uint32_t index = 0; index < slice->positions; index++) {
+      Board board;
+      if (!endgame_position(&slice->material, index, &board)) {
+	continue;
+      }
+      uint8_t won = ENDGAME_WON(
+	slice->values[index].load(std::memory_order_relaxed)) ?
+	BITBASE_WIN : BITBASE_NO_WIN;
+      wrong += probe_bitbase(&board, TURN_RED) != won;
+      // and the same position with blue to move, turned around
+      flip_board(&board);
+      wrong += probe_bitbase(&board, TURN_BLUE) != won;
+    }
+  }
+  return wrong;
+}
+
+int main(int argc, char** argv)
+{
+  unsigned pieces = argc > 1 ? atoi(argv[1]) : 4;
+  num_threads = argc > 2 ? atoi(argv[2]) :
+    std::thread::hardware_concurrency();
+  const char* name = argc > 3 ? argv[3] : "endgame.db";
+  const char* header = argc > 4 ? argv[4] : NULL;
+  if (!num_threads) {
+    num_threads = 1;
+  }
+  if (pieces < 2 || pieces > MAX_ENDGAME_PIECES ||
+      num_threads > MAX_THREADS ||
+      (header && pieces < BITBASE_KING_PIECES)) {
+    fprintf(stderr, "usage: tbgen [pieces, 2-%u] [threads, 1-%u] [file] "
+	    "[bitbase header, with at least %u pieces]\n",
+	    MAX_ENDGAME_PIECES, MAX_THREADS, BITBASE_KING_PIECES);
+    return 1;
+  }
+  double start = now_seconds();
+
+  // every slice, in the order of slice_number
+  slices.resize(count_slices(pieces));
+  for (uint8_t total = 2; total <= pieces; total++) {
+    for (uint8_t a = 0; a <= total; a++) {
+      for (uint8_t b = 0; a + b <= total; b++) {
+	for (uint8_t c = 0; a + b + c <= total; c++) {
+	  Material material = {a, b, c, (uint8_t) (total - a - b - c)};
+	  if (!(a + b) || !(total - a - b)) {
+	    continue;
+	  }
+	  Slice* slice = &slices[slice_number(&material)];
+	  slice->material = material;
+	  slice->positions = slice_positions(&material);
+	  slice->solved = 0;
+	}
+      }
+    }
+  }
+
+  // solve them fewest checkers, then fewest men, first, with their mirrors
+  uint64_t positions = 0;
+  uint8_t longest = 0;
+  for (uint8_t total = 2; total <= pieces; total++) {
+    for (uint8_t men = 0; men <= total; men++) {
+      for (size_t i = 0; i < slices.size(); i++) {
+	Material* material = &slices[i].material;
+	if (slices[i].solved ||
+	    material->red_men + material->red_kings + material->blue_men +
+	    material->blue_kings != total ||
+	    material->red_men + material->blue_men != men) {
+	  continue;
+	}
+	Material mirror = {material->blue_men, material->blue_kings,
+			   material->red_men, material->red_kings};
+	Slice* group[2] = {&slices[i], &slices[slice_number(&mirror)]};
+	uint8_t members = (group[1] == group[0]) ? 1 : 2;
+
+	solve_group(group, members, longest);
+	for (uint8_t j = 0; j < members; j++) {
+	  positions += group[j]->positions;
+	  if (group[j]->longest > longest) {
+	    longest = group[j]->longest;
+	  }
+	}
+	printf("solved %u%u%u%u%s (%.1f s)\n", material->red_men,
+	       material->red_kings, material->blue_men, material->blue_kings,
+	       members > 1 ? " and its mirror" : "",
+	       now_seconds() - start);
+      }
+    }
+  }
+
+  // count the results, before the unused indices are filled in
+  uint64_t won = 0;
+  uint64_t lost = 0;
+  uint64_t drawn = 0;
+  for (size_t i = 0; i < slices.size(); i++) {
+    for (uint32_t index = 0; index < slices[i].positions; index++) {
+      uint8_t value =
+	slices[i].values[index].load(std::memory_order_relaxed);
+      won += value != UNUSED && ENDGAME_WON(value);
+      lost += value != UNUSED && ENDGAME_LOST(value);
+      drawn += value == ENDGAME_DRAW;
+    }
+    fill_unused(&slices[i]);
+  }
+
+  long size = write_file(name, pieces);
+  if (size < 0) {
+    fprintf(stderr, "tbgen: could not write %s\n", name);
+    return 1;
+  }
+  uint32_t most_reads;
+  uint64_t wrong = check_file(name, &most_reads);
+
+  printf("\n%u slices, %llu positions (%llu won, %llu lost, %llu drawn "
+	 "for the player to move), longest %u plies\n",
+	 (unsigned) slices.size(), (unsigned long long) positions,
+	 (unsigned long long) won, (unsigned long long) lost,
+	 (unsigned long long) drawn, ENDGAME_PLIES(longest));
+  printf("%s: %ld bytes (%.2f bits a position, against 8 uncoded), "
+	 "%llu wrong on probing back, at most %u blocks read a probe; "
+	 "%.1f s on %u threads\n",
+	 name, size, (8.0 * size) / positions, (unsigned long long) wrong,
+	 (unsigned) most_reads, now_seconds() - start, num_threads);
+
+  if (header) {
+    uint64_t conflicts;
+    long bytes = write_bitbase(header, &conflicts);
+    if (bytes < 0) {
+      fprintf(stderr, "tbgen: could not write %s\n", header);
+      return 1;
+    }
+    printf("%s: %ld bytes of bitbase, %llu conflicts\n", header, bytes,
+	   (unsigned long long) conflicts);
+    wrong += conflicts;
+  }
+  else {
+    uint64_t bitbase_wrong = check_bitbase();
+    printf("compiled-in bitbase: %llu wrong\n",
+	   (unsigned long long) bitbase_wrong);
+    wrong += bitbase_wrong;
+  }
+  return wrong ? 1 : 0;
+}
@@ -0,0 +1,143 @@
+/*
+  The tile extractor: cuts the 64 empty tiles out of the board image,
+  ../checkerboard.lcd, and writes them as the sketch's tile pixels (see
+  ../tile_data.h), so that draw_tile draws a tile from flash rather than
+  reading it from the card.
+
+  The image is the one the sketch has on the card as c.lcd: 128 by 160
+  pixels, row by row, each 16-bit pixel with its high byte first.  The
+  tiles are 15 pixels square, inside a 4 pixel border, and are kept tile
+  by tile in the order of tile_to_coord, row by row within a tile, with
+  their bytes already in the order pushColor takes them.  The board is
+  wood, so no two tiles look alike; all 64 are kept, in 28800 bytes of
+  far flash.
+
+  usage: tilegen [image] [header]
+
+  With a header (../tile_data.h for the sketch, which `make tiles`
+  writes), the tiles are written there.  Without one, or with -, the
+  tiles cut are checked against the ones compiled in instead, and it
+  exits with 1 if any pixel differs.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "progmem.h"
+#include "tile_data.h"
+
+#define IMAGE_WIDTH 128 // as SCREEN_WIDTH and SCREEN_HEIGHT in the sketch
+#define IMAGE_HEIGHT 160
+#define IMAGE_BORDER 4  // BORDER_WIDTH
+#define TILE_PIXELS_SIDE 15 // TILE_SIZE
+#define BOARD_TILES 64  // NUM_TILES
+#define TILE_AREA (TILE_PIXELS_SIDE * TILE_PIXELS_SIDE)
+
+static int read_image(const char* name, std::vector<uint16_t>* pixels)
+{
+  // reads the whole image, returning 0 if it is not the size expected
+  FILE* file = fopen(name, "rb");
+  if (!file) {
+    return 0;
+  }
+  std::vector<uint8_t> bytes(2 * IMAGE_WIDTH * IMAGE_HEIGHT + 1);
+  size_t got = fread(bytes.data(), 1, bytes.size(), file);
+  fclose(file);
+  if (got != 2 * IMAGE_WIDTH * IMAGE_HEIGHT) {
+    return 0;
+  }
+  pixels->resize(IMAGE_WIDTH * IMAGE_HEIGHT);
+  for (size_t i = 0; i < pixels->size(); i++) {
+    (*pixels)[i] = (uint16_t) ((bytes[2 * i] << 8) | bytes[2 * i + 1]);
+  }
+  return 1;
+}
+
+static std::vector<uint16_t> cut_tiles(const std::vector<uint16_t>& image)
+{
+  // the tiles' pixels, in the order draw_tile reads them
+  std::vector<uint16_t> tiles;
+
+  for (unsigned tile = 0; tile < BOARD_TILES; tile++) {
+    unsigned col = (tile % 8) * TILE_PIXELS_SIDE + IMAGE_BORDER;
+    unsigned row = (tile / 8) * TILE_PIXELS_SIDE + IMAGE_BORDER;
+    for (unsigned y = 0; y < TILE_PIXELS_SIDE; y++) {
+      for (unsigned x = 0; x < TILE_PIXELS_SIDE; x++) {
+	tiles.push_back(image[(row + y) * IMAGE_WIDTH + col + x]);
+      }
+    }
+  }
+  return tiles;
+}
+
+static int write_header(const char* name, const std::vector<uint16_t>& tiles)
+{
+  FILE* file = fopen(name, "w");
+  if (!file) {
+    return 0;
+  }
+  fprintf(file, "/*\n"
+	  "  The empty tiles of the board image (see draw_tile), written by\n"
+	  "  host/tilegen.cpp from checkerboard.lcd: do not edit.\n"
+	  "*/\n\n"
+	  "#ifndef _TILE_DATA_H\n"
+	  "#define _TILE_DATA_H\n\n"
+	  "// %u tiles of %u by %u pixels, in the order of tile_to_coord, "
+	  "each row by row\n"
+	  "static const uint16_t TILE_PIXELS[%u] PROGMEM_FAR = {\n",
+	  BOARD_TILES, TILE_PIXELS_SIDE, TILE_PIXELS_SIDE,
+	  (unsigned) tiles.size());
+  for (size_t i = 0; i < tiles.size(); i++) {
+    fprintf(file, "%s0x%04X%s", i % 8 ? " " : "  ", tiles[i],
+	    i + 1 == tiles.size() ? "\n" : (i % 8 == 7) ? ",\n" : ",");
+  }
+  fprintf(file, "};\n\n#endif\n");
+  return fclose(file) == 0;
+}
+
+static unsigned check_tiles(const std::vector<uint16_t>& tiles)
+{
+  // compares the tiles cut with the compiled-in ones, through the far
+  // reads draw_tile uses, and returns the number of pixels that differ
+  unsigned wrong = 0;
+
+  if (sizeof(TILE_PIXELS) / sizeof(TILE_PIXELS[0]) != tiles.size()) {
+    return (unsigned) tiles.size();
+  }
+  for (size_t i = 0; i < tiles.size(); i++) {
+    if (pgm_read_word_far(pgm_get_far_address(TILE_PIXELS) + 2 * i) !=
+	tiles[i]) {
+      wrong++;
+    }
+  }
+  return wrong;
+}
+
+int main(int argc, char** argv)
+{
+  const char* image_name = argc > 1 ? argv[1] : "../checkerboard.lcd";
+  const char* header = argc > 2 && strcmp(argv[2], "-") ? argv[2] : NULL;
+  std::vector<uint16_t> image;
+
+  if (!read_image(image_name, &image)) {
+    fprintf(stderr, "tilegen: %s is not a %u by %u image\n", image_name,
+	    IMAGE_WIDTH, IMAGE_HEIGHT);
+    fprintf(stderr, "usage: tilegen [image] [header]\n");
+    return 1;
+  }
+  std::vector<uint16_t> tiles = cut_tiles(image);
+
+  if (header) {
+    if (!write_header(header, tiles)) {
+      fprintf(stderr, "tilegen: could not write %s\n", header);
+      return 1;
+    }
+    printf("%s: %u tiles, %u bytes\n", header, BOARD_TILES,
+	   (unsigned) (2 * tiles.size()));
+    return 0;
+  }
+  unsigned wrong = check_tiles(tiles);
+  printf("compiled-in tiles: %u of %u pixels wrong\n", wrong,
+	 (unsigned) tiles.size());
+  return wrong ? 1 : 0;
+}
@@ -0,0 +1,367 @@
+/*
+  The evaluation tuner: fits the weights of the evaluation (see
+  ../eval.h) to the results of games, Texel-style, and writes them out as
+  the header the sketch compiles in.
+
+  The games are played by the search against itself, to a fixed depth,
+  each from an opening of RANDOM_PLIES random moves so that they differ.
+  Every quiet position of a game (the player to move has no capture) is
+  kept, with its terms from eval_features and the result of the game for
+  the player to move there: 1 for a win, 1/2 for a draw, 0 for a loss.  A
+  score s is taken to predict a result of 1 / (1 + e^(-k s)), and the
+  weights are fitted to make the mean squared error of the predictions
+  over all the positions as small as it will go:
+    - first the scale k, for the weights compiled in;
+    - then each weight but MAN_WEIGHT in turn, moved up or down by a step
+      while that lowers the error, the step halving down to 1.
+  The weights stay whole hundredths of a man, as the sketch uses them, and
+  within the bounds of WEIGHT_BOUNDS: a fit to games a shallow search
+  plays can find kings worth less than men, since it seldom wins with
+  them, and a search that believed that would never crown a man.
+
+  The games are shared among the threads, and so is each sum of the error
+  over the positions.
+
+  usage: tune [games] [threads] [depth] [header]
+
+  With a header (../eval_weights.h for the sketch, which `make weights`
+  writes), the weights are written there; otherwise they are only
+  reported.
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "rules.h"
+#include "search.h"
+#include "ttable.h"
+#include "eval.h"
+#include "eval_weights.h"
+
+#define MAX_THREADS 64
+#define RANDOM_PLIES 8 // the random moves each game starts with
+#define MAX_GAME_PLIES 200 // a game still going then is a draw
+#define TABLE_MEGABYTES 4 // each thread's transposition table
+#define NO_DEADLINE (1UL << 30) // the searches end at their depth
+#define FIRST_STEP 16 // the first step a weight is moved by
+
+/*
+  Struct for a position kept from a game, where:
+
+  features: its terms, from eval_features
+  result:   the result of the game for the player to move: 1, 1/2 or 0
+*/
+typedef struct {
+  int8_t features[EVAL_TERMS];
+  float result;
+} Sample;
+
+static const char* const TERM_NAMES[EVAL_TERMS] = {
+  "MAN", "KINGS", "BACK_RANK", "CENTER", "MOBILITY"
+};
+
+// the least and most each weight may be
+static const int WEIGHT_BOUNDS[EVAL_TERMS][2] = {
+  {MAN_WEIGHT, MAN_WEIGHT}, {MAN_WEIGHT, 2 * MAN_WEIGHT},
+  {0, MAN_WEIGHT / 2}, {-MAN_WEIGHT / 4, MAN_WEIGHT / 4},
+  {0, MAN_WEIGHT / 4}
+};
+
+static std::vector<Sample> samples;
+static std::mutex samples_lock;
+static std::atomic<unsigned> next_game;
+static unsigned num_threads;
+
+static double now_seconds()
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t clock_ms()
+{
+  return (uint32_t) (now_seconds() * 1000);
+}
+
+static uint32_t rng_next(uint64_t* state)
+{
+  // xorshift64*, plenty for the openings; each thread has its own state
+  *state ^= *state >> 12;
+  *state ^= *state << 25;
+  *state ^= *state >> 27;
+  return (uint32_t) ((*state * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+static void play_games(unsigned thread, unsigned games, uint8_t depth)
+{
+  /*
+    one thread's share of the games: plays them until none are left, and
+    adds their quiet positions to the samples, where:
+
+    thread: the thread's number, which seeds its random state
+    games: the number of games to play among all the threads
+    depth: the depth each move is searched to
+   */
+  Search* search = new Search;
+  TransTable table;
+  uint32_t bytes = (uint32_t) TABLE_MEGABYTES << 20;
+  uint64_t rng = 0x9E3779B97F4A7C15ULL * (thread + 1);
+  std::vector<Sample> kept;
+  std::vector<int8_t> turns;
+
+  init_table(&table, malloc(bytes), bytes);
+  init_search(search, clock_ms, &table);
+  while (next_game++ < games) {
+    Board board;
+    int8_t turn = TURN_BLUE;
+    int8_t winner = 0;
+    KeyHistory keys;
+    MoveList list;
+    MoveRecord record;
+    size_t first = kept.size();
+
+    setup_board(&board);
+    clear_keys(&keys);
+    push_key(&keys, position_key(&board, turn), 1);
+    clear_table(&table);
+    turns.clear();
+    for (unsigned ply = 0; ply < MAX_GAME_PLIES; ply++) {
+      generate_moves(&board, turn, &list);
+      if (!list.count) {
+	winner = -turn;
+	break;
+      }
+
+      Move move;
+      uint32_t movers, jumpers;
+      if (ply < RANDOM_PLIES) {
+	move = list.moves[rng_next(&rng) % list.count];
+      }
+      else {
+	if (compute_moves(&board, turn, &movers, &jumpers)) {
+	  Sample sample;
+	  eval_features(&board, turn, sample.features);
+	  kept.push_back(sample);
+	  turns.push_back(turn);
+	}
+	think(search, &board, turn, &keys, NO_DEADLINE, depth);
+	move = search->best;
+      }
+      make_move(&board, &move, &record);
+      turn = -turn;
+      push_key(&keys, position_key(&board, turn), record.irreversible);
+      if (position_drawn(&keys)) {
+	break;
+      }
+    }
+
+    for (size_t i = first; i < kept.size(); i++) {
+      kept[i].result = !winner ? 0.5f : winner == turns[i - first];
+    }
+  }
+
+  std::lock_guard<std::mutex> hold(samples_lock);
+  samples.insert(samples.end(), kept.begin(), kept.end());
+  free(table.buckets);
+  delete search;
+}
+
+static void sum_errors(const int* weights, double scale, size_t begin,
+		       size_t end, double* sum)
+{
+  // one thread's share of total_error: the squared errors of some samples
+  double total = 0;
+
+  for (size_t i = begin; i < end; i++) {
+    int score = 0;
+    for (uint8_t term = 0; term < EVAL_TERMS; term++) {
+      score += weights[term] * samples[i].features[term];
+    }
+    double error = samples[i].result - 1 / (1 + exp(-scale * score));
+    total += error * error;
+  }
+  *sum = total;
+}
+
+static double total_error(const int* weights, double scale)
+{
+  /*
+    the mean squared error of the results the evaluation predicts, over
+    all the samples, where:
+
+    weights: the weight of each term
+    scale: the scale k of the prediction (see above)
+   */
+  std::thread workers[MAX_THREADS];
+  double sums[MAX_THREADS];
+  size_t share = (samples.size() + num_threads - 1) / num_threads;
+
+  for (unsigned i = 0; i < num_threads; i++) {
+    size_t begin = std::min(samples.size(), i * share);
+    size_t end = std::min(samples.size(), begin + share);
+    workers[i] = std::thread(sum_errors, weights, scale, begin, end,
+			     &sums[i]);
+  }
+  double total = 0;
+  for (unsigned i = 0; i < num_threads; i++) {
+    workers[i].join();
+    total += sums[i];
+  }
+  return total / samples.size();
+}
+
+static double fit_scale(const int* weights)
+{
+  // the scale k with the least error for the given weights, by ternary
+  // search; the error has a single minimum in k
+  double low = 0.0001;
+  double high = 0.1;
+
+  for (uint8_t i = 0; i < 60; i++) {
+    double lower = low + (high - low) / 3;
+    double upper = high - (high - low) / 3;
+    if (total_error(weights, lower) < total_error(weights, upper)) {
+      high = upper;
+    }
+    else {
+      low = lower;
+    }
+  }
+  return (low + high) / 2;
+}
+
+static double fit_weights(int* weights, double scale)
+{
+  /*
+    moves each weight but the man's up or down, within its bounds, while
+    that lowers the error, with the step halving down to 1, where:
+
+    weights: the weights, changed in place
+    scale: the scale k of the prediction
+
+    returns the error with the weights fitted
+   */
+  double best = total_error(weights, scale);
+
+  for (int step = FIRST_STEP; step >= 1; step /= 2) {
+    uint8_t improved = 1;
+    while (improved) {
+      improved = 0;
+      for (uint8_t term = EVAL_KINGS; term < EVAL_TERMS; term++) {
+	for (int direction = -1; direction <= 1; direction += 2) {
+	  int weight = weights[term] + direction * step;
+	  if (weight < WEIGHT_BOUNDS[term][0] ||
+	      weight > WEIGHT_BOUNDS[term][1]) {
+	    continue;
+	  }
+	  weights[term] = weight;
+	  double error = total_error(weights, scale);
+	  if (error < best) {
+	    best = error;
+	    improved = 1;
+	    break;
+	  }
+	  weights[term] -= direction * step;
+	}
+      }
+    }
+    printf("step %2d: error %.6f, weights", step, best);
+    for (uint8_t term = 0; term < EVAL_TERMS; term++) {
+      printf(" %d", weights[term]);
+    }
+    printf("\n");
+  }
+  return best;
+}
+
+static int write_weights(const char* name, const int* weights, double scale)
+{
+  /*
+    writes the weights as a header for the sketch (see eval.h), where:
+
+    name: the file name
+    weights: the weights
+    scale: the scale k they were fitted with
+
+    returns 0 if the file could not be written
+   */
+  FILE* file = fopen(name, "w");
+  if (!file) {
+    return 0;
+  }
+  fprintf(file, "/*\n"
+	  "  The evaluation's weights (see eval.h), written by\n"
+	  "  host/tune.cpp: do not edit.\n"
+	  "*/\n\n"
+	  "#ifndef _EVAL_WEIGHTS_H\n"
+	  "#define _EVAL_WEIGHTS_H\n\n"
+	  "// in hundredths of a man, fitted with a scale of %.5f on %u "
+	  "positions\n", scale, (unsigned) samples.size());
+  for (uint8_t term = EVAL_KINGS; term < EVAL_TERMS; term++) {
+    fprintf(file, "#define %s_WEIGHT %d\n", TERM_NAMES[term],
+	    weights[term]);
+  }
+  fprintf(file, "\n#endif\n");
+  return fclose(file) == 0;
+}
+
+int main(int argc, char** argv)
+{
+  unsigned games = argc > 1 ? atoi(argv[1]) : 10000;
+  num_threads = argc > 2 ? atoi(argv[2]) :
+    std::thread::hardware_concurrency();
+  unsigned depth = argc > 3 ? atoi(argv[3]) : 6;
+  const char* header = argc > 4 ? argv[4] : NULL;
+  if (!num_threads) {
+    num_threads = 1;
+  }
+  if (!games || num_threads > MAX_THREADS || depth < 1 ||
+      depth > MAX_PLY) {
+    fprintf(stderr, "usage: tune [games] [threads, 1-%u] [depth, 1-%u] "
+	    "[header]\n", MAX_THREADS, MAX_PLY);
+    return 1;
+  }
+
+  // the games
+  std::thread workers[MAX_THREADS];
+  double start = now_seconds();
+  for (unsigned i = 0; i < num_threads; i++) {
+    workers[i] = std::thread(play_games, i, games, depth);
+  }
+  for (unsigned i = 0; i < num_threads; i++) {
+    workers[i].join();
+  }
+  printf("%u games at depth %u on %u threads in %.1f s: %u positions\n",
+	 games, depth, num_threads, now_seconds() - start,
+	 (unsigned) samples.size());
+  if (samples.empty()) {
+    return 1;
+  }
+
+  // the fit, from the weights compiled in
+  int weights[EVAL_TERMS] = {
+    MAN_WEIGHT, KINGS_WEIGHT, BACK_RANK_WEIGHT, CENTER_WEIGHT,
+    MOBILITY_WEIGHT
+  };
+  start = now_seconds();
+  double scale = fit_scale(weights);
+  printf("scale %.5f: error %.6f with the weights compiled in\n", scale,
+	 total_error(weights, scale));
+  double error = fit_weights(weights, scale);
+  printf("fitted in %.1f s: error %.6f\n", now_seconds() - start, error);
+
+  if (header) {
+    if (!write_weights(header, weights, scale)) {
+      fprintf(stderr, "tune: could not write %s\n", header);
+      return 1;
+    }
+    printf("%s written\n", header);
+  }
+  return 0;
+}
@@ -0,0 +1,462 @@
+#ifndef _VARIANT_H
+#define _VARIANT_H
+
+/*
+  The rules of other kinds of draughts, for the host tools: a move
+  generator templated on a variant policy, so that each variant compiles
+  to its own code, with its own board tables worked out by the compiler
+  and every rule settled at compile time (if constexpr), rather than
+  checked as the moves are generated.
+
+  A policy is a struct of constants:
+    SIZE             - the board is SIZE x SIZE, 8 or 10
+    MEN_ROWS         - the rows of men each side starts with
+    MEN_CAPTURE      - which ways a man may capture (see below)
+    FLYING_KINGS     - whether a king moves and captures any distance
+                       along a diagonal, rather than one square
+    MAJORITY_CAPTURE - whether a player must take the sequence capturing
+                       the most checkers
+    REMOVE_AT_ONCE   - whether a captured checker leaves the board at the
+                       hop that takes it, rather than at the end of the
+                       move (when it blocks the rest of the sequence, and
+                       can't be taken twice either way)
+    CROWNING         - what happens when a man reaches the far row (see
+                       below)
+  HouseRules is the game the sketch plays (see ../rules.h), and the
+  move generator agrees with ../rules.cpp on it (see host/variants.cpp);
+  the others are English draughts, Russian draughts (flying kings, men
+  capturing backward and crowned in the middle of a capture) and
+  international draughts on 10x10.
+
+  The board is laid out as in ../rules.h, for any SIZE: square s is on row
+  s / (SIZE / 2), counted left to right along the dark squares of each
+  row, and on the larger board the sets of squares are 64 bits.  Red (side
+  0) starts on the first MEN_ROWS rows and moves down the board, and blue
+  (side 1) starts on the last and moves up, and first.
+*/
+
+#include <stdint.h>
+#include <algorithm>
+#include <type_traits>
+#include "rules.h"
+
+// which ways a man may capture
+#define MEN_CAPTURE_FORWARD 0 // only forward
+#define MEN_CAPTURE_AFTER_FIRST_HOP 1 // any way once the first hop is made
+#define MEN_CAPTURE_ANY_WAY 2
+
+// what happens when a man reaches the far row
+#define CROWN_ENDS_MOVE 0 // it is crowned, and its move ends there
+#define CROWN_ROWS_END_CAPTURES 1 // so does any capture, of a king too,
+                                  // that lands on the first or last row
+#define CROWN_AND_GO_ON 2 // it is crowned, and captures on as a king
+#define CROWN_AT_END 3 // it is crowned only if its move ends there
+
+#define MAX_VARIANT_MOVES 256
+
+struct HouseRules {
+  static constexpr int SIZE = 8;
+  static constexpr int MEN_ROWS = 3;
+  static constexpr int MEN_CAPTURE = MEN_CAPTURE_AFTER_FIRST_HOP;
+  static constexpr bool FLYING_KINGS = false;
+  static constexpr bool MAJORITY_CAPTURE = false;
+  static constexpr bool REMOVE_AT_ONCE = true;
+  static constexpr int CROWNING = CROWN_ROWS_END_CAPTURES;
+};
+
+struct EnglishRules {
+  static constexpr int SIZE = 8;
+  static constexpr int MEN_ROWS = 3;
+  static constexpr int MEN_CAPTURE = MEN_CAPTURE_FORWARD;
+  static constexpr bool FLYING_KINGS = false;
+  static constexpr bool MAJORITY_CAPTURE = false;
+  static constexpr bool REMOVE_AT_ONCE = false;
+  static constexpr int CROWNING = CROWN_ENDS_MOVE;
+};
+
+struct RussianRules {
+  static constexpr int SIZE = 8;
+  static constexpr int MEN_ROWS = 3;
+  static constexpr int MEN_CAPTURE = MEN_CAPTURE_ANY_WAY;
+  static constexpr bool FLYING_KINGS = true;
+  static constexpr bool MAJORITY_CAPTURE = false;
+  static constexpr bool REMOVE_AT_ONCE = false;
+  static constexpr int CROWNING = CROWN_AND_GO_ON;
+};
+
+struct InternationalRules {
+  static constexpr int SIZE = 10;
+  static constexpr int MEN_ROWS = 4;
+  static constexpr int MEN_CAPTURE = MEN_CAPTURE_ANY_WAY;
+  static constexpr bool FLYING_KINGS = true;
+  static constexpr bool MAJORITY_CAPTURE = true;
+  static constexpr bool REMOVE_AT_ONCE = false;
+  static constexpr int CROWNING = CROWN_AT_END;
+};
+
+template <class Policy>
+struct Variant {
+  static constexpr int SIZE = Policy::SIZE;
+  static constexpr int ROW_SQUARES = SIZE / 2;
+  static constexpr int SQUARES = SIZE * ROW_SQUARES;
+  static constexpr int NONE = SQUARES; // off the board
+  static constexpr int CHECKERS = Policy::MEN_ROWS * ROW_SQUARES;
+
+  typedef typename std::conditional<(SQUARES <= 32), uint32_t,
+				    uint64_t>::type Set;
+
+  /*
+    Struct for a position, where:
+
+    pieces: the squares of each side's checkers, red's first
+    kings:  the squares of the kings, of either side
+    side:   the side to move, 0 for red and 1 for blue
+  */
+  struct Position {
+    Set pieces[2];
+    Set kings;
+    int side;
+  };
+
+  /*
+    Struct for a move, where:
+
+    from, to: where the checker starts and ends
+    captured: the squares of the checkers it takes
+  */
+  struct Move {
+    uint8_t from;
+    uint8_t to;
+    Set captured;
+  };
+
+  struct MoveList {
+    Move moves[MAX_VARIANT_MOVES];
+    int count;
+  };
+
+  /*
+    Struct for the board tables, where:
+
+    rays:       for each square and direction, the squares along the
+                diagonal from it to the edge, nearest first
+    lengths:    the number of squares in each ray
+    crown_rows: the row each side's men are crowned on, red's first
+    end_rows:   the first and last rows
+    start:      the squares each side starts on, red's first
+  */
+  struct Tables {
+    uint8_t rays[SQUARES][NUM_DIRECTIONS][SIZE];
+    uint8_t lengths[SQUARES][NUM_DIRECTIONS];
+    Set crown_rows[2];
+    Set end_rows;
+    Set start[2];
+  };
+
+  static constexpr Set bit(int square)
+  {
+    return (Set) 1 << square;
+  }
+
+  static constexpr Tables make_tables()
+  {
+    // the directions as in ../rules.h: down-left, down-right, up-left and
+    // up-right, where down is toward the last row
+    const int dx[NUM_DIRECTIONS] = {-1, 1, -1, 1};
+    const int dy[NUM_DIRECTIONS] = {1, 1, -1, -1};
+    Tables tables = {};
+
+    for (int square = 0; square < SQUARES; square++) {
+      int y = square / ROW_SQUARES;
+      int x = 2 * (square % ROW_SQUARES) + ((y + 1) % 2);
+      for (int direction = 0; direction < NUM_DIRECTIONS; direction++) {
+	int length = 0;
+	for (int step = 1; step < SIZE; step++) {
+	  int to_x = x + step * dx[direction];
+	  int to_y = y + step * dy[direction];
+	  if (to_x < 0 || to_x >= SIZE || to_y < 0 || to_y >= SIZE) {
+	    break;
+	  }
+	  tables.rays[square][direction][length++] =
+	    (uint8_t) (to_y * ROW_SQUARES + to_x / 2);
+	}
+	for (int step = length; step < SIZE; step++) {
+	  tables.rays[square][direction][step] = NONE;
+	}
+	tables.lengths[square][direction] = (uint8_t) length;
+      }
+      if (y == SIZE - 1) {
+	tables.crown_rows[0] |= bit(square);
+      }
+      if (y == 0) {
+	tables.crown_rows[1] |= bit(square);
+      }
+      if (y < Policy::MEN_ROWS) {
+	tables.start[0] |= bit(square);
+      }
+      if (y >= SIZE - Policy::MEN_ROWS) {
+	tables.start[1] |= bit(square);
+      }
+    }
+    tables.end_rows = tables.crown_rows[0] | tables.crown_rows[1];
+    return tables;
+  }
+
+  static constexpr Tables TABLES = make_tables();
+
+  static void setup(Position* position)
+  {
+    // the opening: blue moves first
+    position->pieces[0] = TABLES.start[0];
+    position->pieces[1] = TABLES.start[1];
+    position->kings = 0;
+    position->side = 1;
+  }
+
+  static bool forward(int side, int direction)
+  {
+    // red's forward directions are down the board, and blue's up it
+    return side ? direction >= UP_LEFT : direction <= DOWN_RIGHT;
+  }
+
+  static void add_move(MoveList* list, int from, int to, Set captured)
+  {
+    // adds a move to a list, unless the same checkers are already taken
+    // by another route, or the list is full
+    if (captured) {
+      for (int i = 0; i < list->count; i++) {
+	if (list->moves[i].from == from && list->moves[i].to == to &&
+	    list->moves[i].captured == captured) {
+	  return;
+	}
+      }
+    }
+    if (list->count < MAX_VARIANT_MOVES) {
+      list->moves[list->count++] = Move{(uint8_t) from, (uint8_t) to,
+					captured};
+    }
+  }
+
+  static bool can_capture(int side, int at, bool king, bool first_hop,
+			  Set occupied, Set opp)
+  {
+    // whether a checker can make a hop from a square; occupied and opp as
+    // in extend_capture
+    for (int direction = 0; direction < NUM_DIRECTIONS; direction++) {
+      if (!king && !capture_way(side, direction, first_hop)) {
+	continue;
+      }
+      const uint8_t* ray = TABLES.rays[at][direction];
+      int length = TABLES.lengths[at][direction];
+      int i = 0;
+      if (king && Policy::FLYING_KINGS) {
+	while (i < length && !(occupied & bit(ray[i]))) {
+	  i++;
+	}
+      }
+      if (i + 1 < length && (opp & bit(ray[i])) &&
+	  !(occupied & bit(ray[i + 1]))) {
+	return true;
+      }
+    }
+    return false;
+  }
+
+  static bool capture_way(int side, int direction, bool first_hop)
+  {
+    // whether a man may capture in a direction
+    if constexpr (Policy::MEN_CAPTURE == MEN_CAPTURE_ANY_WAY) {
+      return true;
+    }
+    else if constexpr (Policy::MEN_CAPTURE == MEN_CAPTURE_AFTER_FIRST_HOP) {
+      return !first_hop || forward(side, direction);
+    }
+    else {
+      return forward(side, direction);
+    }
+  }
+
+  static void extend_capture(int side, int from, int at, bool king,
+			     bool first_hop, Set captured, Set occupied,
+			     Set opp, MoveList* list)
+  {
+    /*
+      extends a capture sequence by every hop available from where it has
+      got to, adding each sequence to the list once it can go no further,
+      where:
+
+      side: the side capturing
+      from, at: where the checker started and where it has got to
+      king: whether it captures as a king
+      first_hop: whether it has yet to make its first hop
+      captured: the squares of the checkers taken so far
+      occupied: the squares a hop can't land on or pass over: every
+        checker but the one capturing, less those taken if REMOVE_AT_ONCE
+      opp: the opponent's checkers that may still be taken
+      list: the list of sequences found
+     */
+    bool extended = false;
+
+    if constexpr (Policy::CROWNING == CROWN_ROWS_END_CAPTURES) {
+      if (!first_hop && (TABLES.end_rows & bit(at))) {
+	add_move(list, from, at, captured);
+	return;
+      }
+    }
+    for (int direction = 0; direction < NUM_DIRECTIONS; direction++) {
+      if (!king && !capture_way(side, direction, first_hop)) {
+	continue;
+      }
+      const uint8_t* ray = TABLES.rays[at][direction];
+      int length = TABLES.lengths[at][direction];
+      int i = 0;
+      if (king && Policy::FLYING_KINGS) {
+	while (i < length && !(occupied & bit(ray[i]))) {
+	  i++;
+	}
+      }
+      if (i + 1 >= length || !(opp & bit(ray[i])) ||
+	  (occupied & bit(ray[i + 1]))) {
+	continue;
+      }
+
+      Set over = bit(ray[i]);
+      Set next_occupied = Policy::REMOVE_AT_ONCE ? occupied & ~over :
+	occupied;
+      int last = i + 1; // the furthest landing square
+      if (king && Policy::FLYING_KINGS) {
+	while (last + 1 < length && !(next_occupied & bit(ray[last + 1]))) {
+	  last++;
+	}
+      }
+
+      // a flying king must land where it can capture on, if it can
+      bool must_go_on = false;
+      if (king && Policy::FLYING_KINGS) {
+	for (int j = i + 1; j <= last; j++) {
+	  must_go_on = must_go_on ||
+	    can_capture(side, ray[j], true, false, next_occupied,
+			opp & ~over);
+	}
+      }
+
+      for (int j = i + 1; j <= last; j++) {
+	int landing = ray[j];
+	bool next_king = king;
+	if (!king && (TABLES.crown_rows[side] & bit(landing))) {
+	  if constexpr (Policy::CROWNING == CROWN_ENDS_MOVE) {
+	    add_move(list, from, landing, captured | over);
+	    extended = true;
+	    continue;
+	  }
+	  next_king = Policy::CROWNING == CROWN_AND_GO_ON;
+	}
+	if (must_go_on &&
+	    !can_capture(side, landing, true, false, next_occupied,
+			 opp & ~over)) {
+	  continue;
+	}
+	extend_capture(side, from, landing, next_king, false, captured | over,
+		       next_occupied, opp & ~over, list);
+	extended = true;
+      }
+    }
+    if (!extended && captured) {
+      add_move(list, from, at, captured);
+    }
+  }
+
+  static void generate(const Position* position, MoveList* list)
+  {
+    /*
+      lists every legal move of the side to move: its capture sequences if
+      it has any (only the longest, if MAJORITY_CAPTURE), or else its
+      simple moves, where:
+
+      position: the position
+      list: set to the moves
+     */
+    int side = position->side;
+    Set own = position->pieces[side];
+    Set opp = position->pieces[!side];
+    Set occupied = own | opp;
+
+    list->count = 0;
+    for (Set checkers = own; checkers; checkers &= checkers - 1) {
+      int square = __builtin_ctzll(checkers);
+      extend_capture(side, square, square,
+		     (position->kings & bit(square)) != 0, true, 0,
+		     occupied & ~bit(square), opp, list);
+    }
+    if (list->count) {
+      if constexpr (Policy::MAJORITY_CAPTURE) {
+	int most = 0;
+	for (int i = 0; i < list->count; i++) {
+	  most = std::max(most, __builtin_popcountll(list->moves[i].captured));
+	}
+	int kept = 0;
+	for (int i = 0; i < list->count; i++) {
+	  if (__builtin_popcountll(list->moves[i].captured) == most) {
+	    list->moves[kept++] = list->moves[i];
+	  }
+	}
+	list->count = kept;
+      }
+      return;
+    }
+
+    for (Set checkers = own; checkers; checkers &= checkers - 1) {
+      int square = __builtin_ctzll(checkers);
+      bool king = (position->kings & bit(square)) != 0;
+      for (int direction = 0; direction < NUM_DIRECTIONS; direction++) {
+	if (!king && !forward(side, direction)) {
+	  continue;
+	}
+	const uint8_t* ray = TABLES.rays[square][direction];
+	int length = TABLES.lengths[square][direction];
+	int reach = (king && Policy::FLYING_KINGS) ? length :
+	  std::min(length, 1);
+	for (int i = 0; i < reach && !(occupied & bit(ray[i])); i++) {
+	  add_move(list, square, ray[i], 0);
+	}
+      }
+    }
+  }
+
+  static void make(Position* position, const Move* move)
+  {
+    // plays a move, crowning a man that ends it on the far row; a capture
+    // can end where it began, so the checker is lifted before it lands
+    int side = position->side;
+    bool king = (position->kings & bit(move->from)) != 0;
+
+    position->pieces[side] &= ~bit(move->from);
+    position->pieces[side] |= bit(move->to);
+    position->pieces[!side] &= ~move->captured;
+    position->kings &= ~(move->captured | bit(move->from));
+    if (king || (TABLES.crown_rows[side] & bit(move->to))) {
+      position->kings |= bit(move->to);
+    }
+    position->side = !side;
+  }
+
+  static uint64_t perft(const Position* position, int depth)
+  {
+    // counts the positions depth plies from a position
+    MoveList list;
+
+    generate(position, &list);
+    if (depth <= 1) {
+      return depth ? list.count : 1;
+    }
+    uint64_t count = 0;
+    for (int i = 0; i < list.count; i++) {
+      Position next = *position;
+      make(&next, &list.moves[i]);
+      count += perft(&next, depth - 1);
+    }
+    return count;
+  }
+};
+
+#endif
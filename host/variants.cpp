@@ -0,0 +1,133 @@
+/*
+  Perft for the variants of variant.h: counts the positions to a depth
+  from the opening of each, and times them, checking the counts against
+  the published ones where there are some.
+
+  The house rules are checked against ../rules.cpp itself, position count
+  for position count, so the templated generator is known to play the
+  sketch's game; English draughts against 7, 49, 302, 1469, 7361, 36768,
+  179740, 845931, 3963680, 18391564; and international draughts against
+  9, 81, 658, 4265, 27117, 167140, 1049442, 6483961, 41022423, 258895763.
+  Russian draughts are only counted.
+
+  usage: variants [depth]
+
+  Prints a line for each variant and depth, and exits with 1 if any count
+  is wrong.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "rules.h"
+#include "variant.h"
+
+#define MAX_DEPTH 12
+
+static const uint64_t ENGLISH_COUNTS[] = {
+  7, 49, 302, 1469, 7361, 36768, 179740, 845931, 3963680, 18391564
+};
+
+static const uint64_t INTERNATIONAL_COUNTS[] = {
+  9, 81, 658, 4265, 27117, 167140, 1049442, 6483961, 41022423, 258895763
+};
+
+static unsigned wrong;
+
+static double now_seconds()
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint64_t house_perft(Board* board, int8_t turn, uint8_t depth)
+{
+  // perft with ../rules.cpp, played on the board and restored
+  MoveList list;
+  MoveRecord record;
+  uint64_t count = 0;
+
+  generate_moves(board, turn, &list);
+  if (depth <= 1) {
+    return depth ? list.count : 1;
+  }
+  for (uint8_t i = 0; i < list.count; i++) {
+    make_move(board, &list.moves[i], &record);
+    count += house_perft(board, -turn, depth - 1);
+    unmake_move(board, &record);
+  }
+  return count;
+}
+
+static uint64_t house_count(unsigned depth)
+{
+  Board board;
+
+  setup_board(&board);
+  return house_perft(&board, TURN_BLUE, depth);
+}
+
+template <class Policy>
+static void count_variant(const char* name, unsigned max_depth,
+			  const uint64_t* counts, unsigned num_counts,
+			  uint64_t (*reference)(unsigned))
+{
+  /*
+    counts the positions of a variant at each depth, and checks them,
+    where:
+
+    name: the variant's name, for the report
+    max_depth: the deepest depth counted
+    counts: the published counts from depth 1, or NULL
+    num_counts: the number of published counts
+    reference: another perft to check against, or NULL
+   */
+  typedef Variant<Policy> Rules;
+  typename Rules::Position position;
+
+  Rules::setup(&position);
+  for (unsigned depth = 1; depth <= max_depth; depth++) {
+    double start = now_seconds();
+    uint64_t count = Rules::perft(&position, depth);
+    double seconds = now_seconds() - start;
+    uint64_t expected = 0;
+    const char* check = "";
+    if (counts && depth <= num_counts) {
+      expected = counts[depth - 1];
+    }
+    else if (reference) {
+      expected = reference(depth);
+    }
+    if (expected) {
+      check = count == expected ? "ok" : "WRONG";
+      wrong += count != expected;
+    }
+    printf("%-14s %2u %12llu %8.3f s %6.1f M/s %s", name, depth,
+	   (unsigned long long) count, seconds,
+	   seconds > 0 ? count / seconds / 1e6 : 0.0, check);
+    if (expected && count != expected) {
+      printf(" (expected %llu)", (unsigned long long) expected);
+    }
+    printf("\n");
+  }
+}
+
+int main(int argc, char** argv)
+{
+  unsigned depth = argc > 1 ? atoi(argv[1]) : 8;
+  if (depth < 1 || depth > MAX_DEPTH) {
+    fprintf(stderr, "usage: variants [depth, 1-%u]\n", MAX_DEPTH);
+    return 1;
+  }
+
+  count_variant<HouseRules>("house", depth, NULL, 0, house_count);
+  count_variant<EnglishRules>("english", depth, ENGLISH_COUNTS,
+			      sizeof(ENGLISH_COUNTS) / sizeof(uint64_t),
+			      NULL);
+  count_variant<RussianRules>("russian", depth, NULL, 0, NULL);
+  count_variant<InternationalRules>(
+    "international", depth, INTERNATIONAL_COUNTS,
+    sizeof(INTERNATIONAL_COUNTS) / sizeof(uint64_t), NULL);
+  printf("%u wrong\n", wrong);
+  return wrong != 0;
+}
@@ -26,7 +26,7 @@ void lcd_image_draw(lcd_image_t *img, Adafruit_ST7735 *tft,
 
   // Open requested file on SD card if not already open
   if ((file = SD.open(img->file_name)) == NULL) {
-    Serial.print("File not found:'");
+    Serial.print(F("File not found:'"));
     Serial.print(img->file_name);
     Serial.println('\'');
     return;  // how do we inform the caller than things went wrong?
@@ -45,7 +45,7 @@ void lcd_image_draw(lcd_image_t *img, Adafruit_ST7735 *tft,
 
     // Read row of pixels
     if (file.read((uint8_t *) pixels, 2 * width) != 2 * width) {
-      Serial.println("SD Card Read Error!");
+      Serial.println(F("SD Card Read Error!"));
       file.close();
       return;
     }
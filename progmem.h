@@ -0,0 +1,42 @@
+/*
+ * Lets tables be placed in flash with PROGMEM and read back with
+ * pgm_read_*, on the mega2560 and on the host alike; the host has only
+ * one address space, so there the reads are plain loads.
+ *
+ * pgm_read_* only reach the first 64 KB of flash, where the linker puts
+ * PROGMEM.  A table too big to share that with the others is marked
+ * PROGMEM_FAR instead, which puts it after the code, and is read with
+ * pgm_read_*_far from its 32-bit address, pgm_get_far_address.  The
+ * section it goes in is one of those run as the program exits, which a
+ * sketch never does.
+ */
+
+#ifndef _PROGMEM_H
+#define _PROGMEM_H
+
+#ifdef __AVR__
+
+#include <avr/pgmspace.h>
+
+#define PROGMEM_FAR __attribute__((section(".fini7")))
+
+#else
+
+#include <stdint.h>
+#include <string.h>
+
+typedef uintptr_t uint_farptr_t;
+
+#define PROGMEM
+#define PROGMEM_FAR
+#define pgm_read_byte(address) (*(const uint8_t*) (address))
+#define pgm_read_word(address) (*(const uint16_t*) (address))
+#define pgm_read_dword(address) (*(const uint32_t*) (address))
+#define memcpy_P memcpy
+#define pgm_get_far_address(table) ((uint_farptr_t) &(table))
+#define pgm_read_byte_far(address) (*(const uint8_t*) (address))
+#define pgm_read_word_far(address) (*(const uint16_t*) (address))
+
+#endif
+
+#endif
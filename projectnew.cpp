@@ -11,16 +11,17 @@
     Sub0.104: joystick pins
     Sub0.105: turn mapping
     Sub0.106: game state mapping
-    Sub0.107: debounce
+    Sub0.107: debounce & clock
     Sub0.108: cursor mode mapping
     Sub0.109: tile settings
     Sub0.110: color mapping
     Sub0.111: note mapping
     Sub0.112: sound playing
     Sub0.113: optional pins
+    Sub0.114: computer player
   Sec0.2: Non-Constant Globals and Cache Data
     Sub0.200: checker player variables
-    Sub0.201: tile array
+    Sub0.201: checker board
     Sub0.202: tft object
     Sub0.203: card object
     Sub0.204: lcd image objects
@@ -28,36 +29,42 @@
     Sub0.206: tile highlighting
     Sub0.207: game states
     Sub0.208: active player variables and pointers
-    Sub0.209: debounce
+    Sub0.209: move history
+    Sub0.210: debounce & clock
+    Sub0.211: computer player
   Sec0.3: Functions
-    Sub0.300: tile -> coordinate // coordinate -> tile maps
+    Sub0.300: tile -> coordinate // coordinate -> tile maps (in rules.cpp)
     Sub0.301: drawing procedures
-    Sub0.302: move and jump computing
+    Sub0.302: move and jump computing (in rules.cpp)
     Sub0.303: highlighting
-    Sub0.304: move & jump verification
-    Sub0.305: checker jumping & movement
+    Sub0.304: move & jump verification (in rules.cpp)
+    Sub0.305: checker jumping & movement (in rules.cpp)
     Sub0.306: debounce reset
     Sub0.307: joystick tile manipulation
     Sub0.308: nicer boolean functions
     Sub0.309: debounce reset
     Sub0.310: sounds & music
     Sub0.311: debug procedures
+    Sub0.312: undo & redo
+    Sub0.313: computer player
   Sec0.4: Arduino Setup Procedure
     Sub0.400: serial monitor & sd card preliminaries
-    Sub0.401: drawing the checker board
+    Sub0.401: timing a tile's redraw
     Sub0.402: set up pins
     Sub0.403: calibrate the joystick
     Sub0.404: initialize time-based interrupt
+    Sub0.405: computer player
   Sec0.5: Arduino Loop Procedure
     Sub0.500: joystick reading & calibration
     Sub0.501: game setup
-    Sub0.502: changing turns
+    Sub0.502: changing turns (and the computer's turn)
     Sub0.503: reading joystick movement
-    Sub0.504: reading button presses (contains subs 505, 506, 507)
+    Sub0.504: reading button presses (contains subs 505, 506, 507, 509)
     Sub0.505: checker selection
     Sub0.506: move selection
     Sub0.507: jump selection
     Sub0.508: debug prompt
+    Sub0.509: undo & redo
  */
 
 //****************************************************************************
@@ -72,8 +79,14 @@
 #include <stdlib.h>
 #include "TimerThree.h"
 #include "mem_syms.h"
-#include "tile.h"
-#include "checker.h"
+#include "rules.h"
+#include "search.h"
+#include "ttable.h"
+#include "endgame.h"
+#include "tablebase.h"
+#include "book.h"
+#include "progmem.h"
+#include "tile_data.h"
 #include "lcd_image.h"
 #include "projectnew.h"
 
@@ -102,10 +115,7 @@
 #define WIN_INCREMENT 30
 #define RED_OFFSET 15
 
-// Sub0.102: checkers settings
-const uint8_t CHECKERS_PER_SIDE = 12; // 12 pieces per side, as per game rules
-const uint8_t NUM_TILES = 64; // standard 8x8 board
-#define POSSIBLE_MOVES 4
+// Sub0.102: checkers settings (the rules themselves are in rules.h)
 #define TILE_SIZE ((128-8)/8)// tile width and height in pixels
 #define GRAV_PIECEWIDTH 11 // the width/height of a graveyard checker piece
 #define GRAV_PIECEHEIGHT 10
@@ -122,17 +132,16 @@ const uint8_t NUM_TILES = 64; // standard 8x8 board
 
 #define SPEAKER_PIN  11
 
-// Sub0.105: turn mapping
-#define TURN_RED 1
-#define TURN_BLUE -1
+// Sub0.105: turn mapping (TURN_RED and TURN_BLUE, in rules.h)
 
 // Sub0.106: game state mapping
 #define SETUP_MODE 0
 #define PLAY_MODE 1
 #define GAMEOVER_MODE 2
 
-// Sub0.107: debounce
+// Sub0.107: debounce & clock
 #define BOUNCE_PERIOD 500000
+#define TICK_PERIOD 1000 // Timer3 ticks every millisecond
 
 // Sub0.108: cursor mode mapping
 #define TILE_MOVEMENT 0
@@ -140,7 +149,9 @@ const uint8_t NUM_TILES = 64; // standard 8x8 board
 
 // Sub0.109: tile settings
 #define DEFAULT_TILE 36
-#define VOID_TILE 64
+#define CHECKER_RADIUS 6  // the checkers draw_tile draws on a tile
+#define CHECKER_RIM 1     // the dark ring around them
+#define KING_RADIUS 3     // the ring that crowns a king
 
 // Sub0.110: color mapping
 #define TILE_HIGHLIGHT 0xFFF7 // almost white
@@ -148,6 +159,11 @@ const uint8_t NUM_TILES = 64; // standard 8x8 board
 #define BLUE_HIGHLIGHT ST7735_BLUE
 #define MOVE_HIGHLIGHT ST7735_GREEN
 #define JUMP_HIGHLIGHT 0xfb20 // orange
+#define CHAIN_HIGHLIGHT ST7735_YELLOW // later hops of a capture sequence
+#define RED_CHECKER ST7735_RED
+#define BLUE_CHECKER ST7735_BLUE
+#define RIM_COLOR ST7735_BLACK
+#define KING_COLOR ST7735_YELLOW
 
 // Sub0.111: note mapping
 #define NOTE_EB3 156
@@ -181,20 +197,30 @@ const uint8_t NUM_TILES = 64; // standard 8x8 board
 
 // Sub0.113: optional pins
 #define DEBUG_BUTTON 10
+#define COMPUTER_SWITCH 12 // grounded at reset for a game against the mega
+
+// Sub0.114: computer player
+#define COMPUTER_BUDGET 3000 // milliseconds the computer thinks for a move
+#define PONDER_SLICE 2 // milliseconds pondered on each pass of the loop
+#define STACK_RESERVE 2048 // SRAM kept for the stack, the search's included;
+                           // the transposition table gets the rest
+#define TABLE_MIN_BYTES 512 // a smaller table is not worth the SRAM
+#define ENDGAME_FILE "endgame.db" // in one piece on the card; made by
+                                  // host/tbgen.cpp
+#define TABLEBASE_SLICES 41 // count_slices(4): endings of four checkers
 
 //****************************************************************************
 //                   Sec0.2: Non-Constant Globals and Cache Data     
 //****************************************************************************
 
 // Sub0.200: checkers player variables
-Checker red_checkers[CHECKERS_PER_SIDE];  // the array of red checkers
-Checker blue_checkers[CHECKERS_PER_SIDE]; // the array of blue checkers
 uint8_t red_dead = 0;
 uint8_t blue_dead = 0;
-uint8_t rm_tile;
+uint8_t rm_square;
 
-// Sub0.201: tile array
-Tile tile_array[NUM_TILES];
+// Sub0.201: checker board
+Board board; // the bitboards of both players' checkers (see rules.h)
+MoveState move_state; // both players' movers and jumpers, kept up to date
 
 // Sub0.202: tft object
 Adafruit_ST7735 tft = Adafruit_ST7735(TFT_CS, TFT_DC, TFT_RST);
@@ -209,10 +235,6 @@ lcd_image_t cb_img = {"c.lcd", SCREEN_WIDTH, SCREEN_HEIGHT};
 lcd_image_t cbr_image = {"cr.lcd", SCREEN_WIDTH, SCREEN_HEIGHT};
 // checkerboard image with blue pieces
 lcd_image_t cbb_image = {"cb.lcd", SCREEN_WIDTH, SCREEN_HEIGHT};
-// checkerboard image with red kinged pieces
-lcd_image_t cbrk_image = {"crk.lcd", SCREEN_WIDTH, SCREEN_HEIGHT};
-// checkerboard image with blue kinged pieces
-lcd_image_t cbbk_image = {"cbk.lcd", SCREEN_WIDTH, SCREEN_HEIGHT};
 // checkerboard image with fully populated graveyard
 lcd_image_t cbg_image = {"g.lcd", SCREEN_WIDTH, SCREEN_HEIGHT};
 
@@ -240,13 +262,33 @@ uint8_t no_moves = 0;
 uint8_t signal_redraw = 0;
 int16_t player_turn = TURN_RED; //16-bit necessary for tile_highlight function
 
-// Sub0.208: active player variable pointers
+// Sub0.208: active player variables and pointers
 uint8_t* player_dead = &red_dead;
-Checker* active_checker;
-Checker* player_checkers;
-
-// Sub0.209: debounce
+uint8_t active_square; // the square of the checker selected
+uint32_t active_moves; // the squares it can move or jump to
+uint32_t active_chain; // the squares its capture sequences land on later
+MoveList player_moves; // the legal moves of the player, for all checkers
+
+// Sub0.209: move history
+MoveStack history;  // the turns played, for undo and redo
+Board turn_board;   // the board as the current turn began
+KeyHistory keys;    // the keys of the positions reached lately
+uint8_t turn_from;  // the square of the checker selected this turn
+
+// Sub0.210: debounce & clock
 uint8_t bouncer = 0;
+uint16_t bounce_ticks = 0;   // ticks until the next bouncer_reset
+volatile uint32_t ticks = 0; // milliseconds since setup, counted by Timer3
+
+// Sub0.211: computer player
+int8_t computer_turn = 0; // the player the mega plays, or 0 for two humans
+Search search;            // the computer's search, kept off the heap
+TransTable table;         // its transposition table, in the spare SRAM
+Tablebase tablebase;      // the endgame database on the card, if any
+TablebaseSlice tablebase_slices[TABLEBASE_SLICES];
+uint8_t tablebase_open = 0;
+uint32_t endgame_start;   // the card block ENDGAME_FILE starts in
+uint32_t endgame_blocks;  // and the blocks it takes
 
 
 //****************************************************************************
@@ -255,94 +297,51 @@ uint8_t bouncer = 0;
 
 
 
-// Sub0.300: tile -> coordinate // coordinate -> tile maps
-
-uint8_t coord_to_tile(uint8_t x, uint8_t y)
-{
-  /*
-    Map (x,y) coordinate to corresponding tile in 64-tile array, where:
-
-    x: the horizontal tile
-    y: the vertical tile
-
-   */
-  if (x < 0 || x > 7 || y < 0 || y > 7){
-    return 0;
-  }
-  return ((8*y) + x);
-}
-
-uint8_t* tile_to_coord(uint8_t tile_num)
-{
-  /* 
-     maps a tile number to x,y coordinate, where:
-     
-     tile_num - the tile index of the tile array
-  */  
-  uint8_t x_y[2];
-  x_y[0] = tile_num % 8;
-  x_y[1] = tile_num / 8;
-  return x_y;
-}
-
-
 // Sub0.301: drawing procedures
 
-void draw_tile(Tile* tile_array, Checker* red_checkers, 
-	       Checker* blue_checkers, uint8_t tile_index)
+void draw_tile(Board* board, uint8_t tile_index)
 {
   /*
-    draw the tile tile_array[tile_index], and the checker it
-    contains (if any), to the lcd display; we can assume the image size
-    and screen size are equal, since there's no real reason to scroll in
-    a checkers game, we can use the same vars for icol, scol and irow, srow,
-    where:
+    draw the tile tile_index, and the checker it contains (if any), to the
+    lcd display: the empty tile from its pixels in flash, cut from the
+    board image at build time (see host/tilegen.cpp), and the checker over
+    it as a filled circle, so that the card is not read at all, where:
 
-    tile_array: the address of the array of tiles.
-    tile_index: the index of the tile in *tile_array to draw
-    red_checkers: the address of the red checker array
-    blue_checkers: the address of the blue checker array
-    
+    board: the checker board
+    tile_index: the index of the tile to draw
 
-    uses globals: cb_img, tft, TILE_SIZE
+    uses globals: TILE_PIXELS, tft, TILE_SIZE
         
    */
   uint8_t* x_y = tile_to_coord(tile_index);
   uint16_t col = (x_y[0] * TILE_SIZE) + BORDER_WIDTH;
   uint16_t row = (x_y[1] * TILE_SIZE) + BORDER_WIDTH;
-
-  // draw over this tile with a symmetric tile depending on what 
-  // checker it contains, and, if it contains one, whether or not it's kinged:
-  if (tile_array[tile_index].has_checker == 0){
-    // draw the blank tile
-    lcd_image_draw(&cb_img, &tft, col, row, col, row, TILE_SIZE, TILE_SIZE);
+  uint8_t square = tile_to_square(tile_index);
+  int8_t color = checker_color(board, square);
+
+  // the empty tile, in one window of the display; the pixels are above the
+  // first 64 KB of flash, with the bitbase, so they are read by far address
+  uint_farptr_t pixels = pgm_get_far_address(TILE_PIXELS) +
+    (uint32_t) tile_index * (TILE_SIZE * TILE_SIZE * 2);
+  tft.setAddrWindow(col, row, col + TILE_SIZE - 1, row + TILE_SIZE - 1);
+  for (uint16_t i = 0; i < TILE_SIZE * TILE_SIZE; i++) {
+    tft.pushColor(pgm_read_word_far(pixels + 2 * i));
   }
-  else if (tile_array[tile_index].has_checker == TURN_RED){
-    // draw the tile with a red checker on it
-    if (red_checkers[tile_array[tile_index].checker_num].is_kinged) {
-      lcd_image_draw(&cbrk_image, &tft, col, row, col, row, 
-		     TILE_SIZE, TILE_SIZE);
-    }
-    else {
-      lcd_image_draw(&cbr_image, &tft, col, row, col, row, TILE_SIZE, 
-		     TILE_SIZE);
+
+  // then the checker over it, if there is one, and whether it's kinged
+  if (color){
+    uint16_t center_x = col + TILE_SIZE / 2;
+    uint16_t center_y = row + TILE_SIZE / 2;
+    tft.fillCircle(center_x, center_y, CHECKER_RADIUS, RIM_COLOR);
+    tft.fillCircle(center_x, center_y, CHECKER_RADIUS - CHECKER_RIM,
+		   color == TURN_RED ? RED_CHECKER : BLUE_CHECKER);
+    if (board->kings & SQUARE_BIT(square)) {
+      tft.drawCircle(center_x, center_y, KING_RADIUS, KING_COLOR);
     }
   }
-  else {
-    // draw the tile with a blue checker on it
-    if (blue_checkers[tile_array[tile_index].checker_num].is_kinged) {
-      lcd_image_draw(&cbbk_image, &tft, col, row, col, row, 
-		     TILE_SIZE, TILE_SIZE);
-    }
-    else {
-      lcd_image_draw(&cbb_image, &tft, col, row, col, row, TILE_SIZE, 
-		     TILE_SIZE);
-    }
-  }  
 }
 
-void clear_draw(Tile* tile_array, Checker* active_checker,
-		Checker* red_checkers, Checker* blue_checkers, 
+void clear_draw(Board* board, MoveState* state, uint32_t destinations, 
 		uint8_t active_tile, uint8_t destination_tile) 
 {
   /*
@@ -352,38 +351,32 @@ void clear_draw(Tile* tile_array, Checker* active_checker,
     hamper the speed of the program since it is a  turn-based game and 
     constant re-drawing is not necessary, where:
    
-    tile_array: the array of tiles of the checker board
-    active_checker: a pointer to the checker whose moves/jumps to clear
-    red_checkers: the array of red checkers
-    blue_checkers: the array of blue checkers
+    board: the checker board
+    state: the move state, whose dirty squares are redrawn and cleared
+    destinations: the highlighted moves/jumps of the active checker to clear
     active_tile: the tile occupied by the active checker
     destination_tile: the tile occupied by our tertiary selection
    */
-  
-  // the checker of the jump, if applicable
-  uint8_t rm_tile = (active_tile + destination_tile) / 2;
 
-  // draw over the three tiles in a given diagonal from a checker
-  draw_tile(tile_array, red_checkers, blue_checkers, active_tile);
-  draw_tile(tile_array, red_checkers, blue_checkers, destination_tile);
-  // not always jumping, but redrawing an additional tile causes no issues
-  draw_tile(tile_array, red_checkers, blue_checkers, rm_tile);
+  // draw over the highlighted tiles of the active checker
+  draw_tile(board, active_tile);
+  draw_tile(board, destination_tile);
+
+  // draw over every square that changed, including the checker jumped
+  destinations |= state->dirty;
+  state->dirty = 0;
 
   // draw over all the move and jump tiles of the given checker
-  for (uint8_t i = 0; i < POSSIBLE_MOVES; i++){
-    if (active_checker->moves[i] != 0){
-      draw_tile(tile_array, red_checkers, blue_checkers,
-		active_checker->moves[i]);
-    }
-    if (active_checker->jumps[i] != 0) {
-      draw_tile(tile_array, red_checkers, blue_checkers, 
-		active_checker->jumps[i]);
-    }
+  while (destinations){
+    uint8_t square = FIRST_SQUARE(destinations);
+    draw_tile(board, square_to_tile(square));
+    destinations &= ~SQUARE_BIT(square);
   }
 }
 
 void win_screen(int8_t turn){
-  // draws a win screen for whosever turn it is, and initiates a new game
+  // draws a win screen for whosever turn it is (a draw screen for 0), and
+  // initiates a new game
   delay(500);
   if(turn == TURN_BLUE){
     tft.fillRect(BORDER_WIDTH, BORDER_WIDTH, SCREEN_WIDTH - (2*BORDER_WIDTH)
@@ -409,6 +402,14 @@ void win_screen(int8_t turn){
     tft.setCursor(WINSTART_X, WINSTART_Y + (2*WIN_INCREMENT));
     tft.print("WINS");
   }
+  else {
+    tft.fillRect(BORDER_WIDTH, BORDER_WIDTH, SCREEN_WIDTH - (2*BORDER_WIDTH)
+		 ,SCREEN_WIDTH - (2*BORDER_WIDTH), ST7735_BLACK);
+    tft.setCursor(WINSTART_X, WINSTART_Y + WIN_INCREMENT);
+    tft.setTextColor(ST7735_WHITE);
+    tft.setTextSize(4);
+    tft.print("DRAW");
+  }
   play_victory_music();
   delay(10000);
   game_state = SETUP_MODE;
@@ -430,7 +431,7 @@ void populate_graveyard(uint8_t num_dead, int8_t turn)
   */
   // invariant: 1 <= num_dead <= 12
   if (( num_dead < 1 || num_dead > CHECKERS_PER_SIDE)){
-    Serial.println("You called the populate graveyard function improperly");
+    Serial.println(F("You called the populate graveyard function improperly"));
     while(1) {} // loop until plug is pulled.
   }
 
@@ -460,19 +461,36 @@ void populate_graveyard(uint8_t num_dead, int8_t turn)
   }
 }
 
+void draw_graveyard()
+{
+  /*
+    redraws the graveyard from scratch, for when checkers come back to the
+    board as a turn is undone
+
+    uses globals: cb_img, tft, red_dead, blue_dead
+   */
+  lcd_image_draw(&cb_img, &tft, 0, SCREEN_WIDTH, 0, SCREEN_WIDTH,
+		 SCREEN_WIDTH, SCREEN_HEIGHT - SCREEN_WIDTH);
+  for (uint8_t i = 1; i <= red_dead; i++){
+    populate_graveyard(i, TURN_RED);
+  }
+  for (uint8_t i = 1; i <= blue_dead; i++){
+    populate_graveyard(i, TURN_BLUE);
+  }
+}
+
 
 void change_turn()
 {
   /*
     this function is called to indicate on the lcd display whose turn it is,
     and does so by coloring the border their respective color; also sets the 
-    active checker array and player dead to the new respective array and dead
-    of the now-active player.
+    player dead to the dead of the now-active player.
 
     due to difficulties with pointers, this procedure unfortunately takes no
     arguments and instead alters the global values, which include:
 
-    player_turn, red_checkers, red_dead, blue_checkers, blue_dead
+    player_turn, player_dead, red_dead, blue_dead
 
     
    */
@@ -482,7 +500,6 @@ void change_turn()
   player_turn = (-1) * player_turn; // change player turn to opposite turn
 
   if (player_turn == TURN_RED){
-    player_checkers = red_checkers;
     player_dead = &red_dead;
     lcd_image_draw(&cbr_image, &tft, 0, 0, 0, 0, SCREEN_WIDTH, BORDER_WIDTH);
     lcd_image_draw(&cbr_image, &tft, 0, 0, 0, 0, BORDER_WIDTH, SCREEN_WIDTH);
@@ -492,7 +509,6 @@ void change_turn()
 		   SCREEN_WIDTH - BORDER_WIDTH, SCREEN_WIDTH, BORDER_WIDTH);
   }
   else {
-    player_checkers = blue_checkers;
     player_dead = &blue_dead;
     lcd_image_draw(&cbb_image, &tft, 0, 0, 0, 0, SCREEN_WIDTH, BORDER_WIDTH);
     lcd_image_draw(&cbb_image, &tft, 0, 0, 0, 0, BORDER_WIDTH, SCREEN_WIDTH);
@@ -504,151 +520,6 @@ void change_turn()
 }
 
 
-//Sub0.302: move and jump computing
-
-uint8_t* compute_checker_jumps(Tile* tile_array, Checker* checker,
-			       int8_t opp_color, uint8_t djump)
-{
-  /*
-    this function checks the potential jumps of a given checker by checking
-    the two respective diagonal tiles it may have an opponent in (all four
-    if the checker is kinged) as well as the next diagonal space over in each
-    direction, where:
-    
-    tile_array: the address of the array containing the checker board tiles
-    checker: the checker in which we are interested
-    opp_color: the color of the opponents checkers
-    djump: whether we are checking for double jumps
-   */
-
-  // since each player has their colors given by -1 and 1, these also serve as
-  // directions for checking jumps
-  int8_t dir = opp_color;
-
-  // directions are from the perspective of the checker:
-  // forward-left
-  if (tile_array[coord_to_tile(checker->x_tile -1, 
-			    checker->y_tile - dir)].has_checker == opp_color){
-    if (tile_array[coord_to_tile(checker->x_tile - 2,
-				  checker->y_tile - 2*dir)].has_checker == 0){
-      checker->jumps[0] = coord_to_tile(checker->x_tile - 2, 
-				     checker->y_tile - 2*dir);
-      checker->must_jump = 1;
-    }
-  }
-
-  // forward-right
-  if (tile_array[coord_to_tile(checker->x_tile + 1 , 
-			    checker->y_tile - dir)].has_checker == opp_color){
-    if (tile_array[coord_to_tile(checker->x_tile + 2,
-				 checker->y_tile - 2*dir)].has_checker == 0) {
-      checker->jumps[1] = coord_to_tile(checker->x_tile + 2, 
-				     checker->y_tile - 2*dir);
-      checker->must_jump = 1;
-    }
-  }
-  if(checker->is_kinged || djump){
-
-    // backward-left
-    if (tile_array[coord_to_tile(checker->x_tile - 1, 
-			    checker->y_tile + dir)].has_checker == opp_color){
-      if (tile_array[coord_to_tile(checker->x_tile - 2,
-				  checker->y_tile + 2*dir)].has_checker == 0){
-	checker->jumps[2] = coord_to_tile(checker->x_tile - 2, 
-				       checker->y_tile + 2*dir);
-	checker->must_jump = 1;
-      }
-    }
-    // backward-right
-    if (tile_array[coord_to_tile(checker->x_tile + 1, 
-			    checker->y_tile + dir)].has_checker == opp_color){
-      if (tile_array[coord_to_tile(checker->x_tile + 2,
-				  checker->y_tile + 2*dir)].has_checker == 0){
-	checker->jumps[3] = coord_to_tile(checker->x_tile + 2, 
-				       checker->y_tile + 2*dir);
-	checker->must_jump = 1;
-      }
-    }
-  }
-}
-
-void compute_checker_moves(Tile* tile_array, Checker* checker, 
-			   int8_t opp_color)
-{
-  /*
-    this function checks the potential moves of a given checker by checking
-    the two respective diagonal tiles it may have an open move in (all four
-    if the checker is kinged), where:
-    
-    tile_array: the address of the array containing the checker board tiles
-    checker: the checker in which we are interested
-    opp_color: the color of the opponent's checkers
-
-  */
-
-  // since each player has their colors given by -1 and 1, these also serve as
-  // directions for checking moves
-  int8_t dir = opp_color;
-
-  // directions are from the perspective of the checker:
-  // forward-left
-  if (tile_array[coord_to_tile(checker->x_tile -1, 
-			    checker->y_tile - dir)].has_checker == 0) {
-    checker->moves[0] = coord_to_tile(checker->x_tile -1, checker->y_tile - 
-				      dir);
-  }
-  
-  if (tile_array[coord_to_tile(checker->x_tile + 1 , 
-			   checker->y_tile - dir)].has_checker == 0) {
-    checker->moves[1] = coord_to_tile(checker->x_tile + 1, checker->y_tile - 
-				      dir);
-  }
-  if(checker->is_kinged){
-    // backward-left
-    if (tile_array[coord_to_tile(checker->x_tile - 1, 
-			    checker->y_tile + dir)].has_checker == 0) {
-      checker->moves[2] = coord_to_tile(checker->x_tile - 1, checker->y_tile +
-					dir);
-    }
-    // backward-right
-    if (tile_array[coord_to_tile(checker->x_tile + 1, 
-			   checker->y_tile + dir)].has_checker == 0) {
-      checker->moves[3] = coord_to_tile(checker->x_tile + 1, checker->y_tile +
-					dir);
-    }
-  }
-}
-
-uint8_t compute_moves(Tile* tile_array, Checker* checkers, 
-			    int8_t opp_color)
-{
-  /*
-    computes the moves and jumps of an array of checker structs, where:
-
-    tile_array: the array of tiles of the checker board
-    checkers: the array of checker structs we are computing for
-    opp_color: the color of the opponents checkers
-
-   */
-
-  uint8_t no_fjumps = 1;  // no force jumps until proven otherwise:
-
-  for (uint8_t i = 0; i < CHECKERS_PER_SIDE; i++){
-
-    if (checkers[i].in_play){ // don't compute for those already dead
-
-      compute_checker_moves(tile_array, &checkers[i], opp_color);
-      compute_checker_jumps(tile_array, &checkers[i], opp_color, 0);
-
-      if (checkers[i].must_jump){ // check whether there is a jump
-	no_fjumps = 0;
-      }
-    }
-  }
-  return no_fjumps; // returns uint8_t
-}
-
-
 // Sub0.303: highlighting
 
 void highlight_tile(uint8_t tile_num, int16_t mode)
@@ -677,171 +548,62 @@ void highlight_tile(uint8_t tile_num, int16_t mode)
   tft.drawRect(col, row, TILE_SIZE, TILE_SIZE, color);
 }
 
-void highlight_moves(Checker* active_checker)
+void highlight_moves(uint32_t moves)
 {
-  // highlights the moves of the checker given, unless equal to the void tile
-  for (uint8_t i = 0; i < POSSIBLE_MOVES; i++){
-    if (active_checker->moves[i] != VOID_TILE){
-      highlight_tile(active_checker->moves[i], MOVE_HIGHLIGHT);
-    }
+  // highlights the tiles of the given set of move squares
+  while (moves){
+    uint8_t square = FIRST_SQUARE(moves);
+    highlight_tile(square_to_tile(square), MOVE_HIGHLIGHT);
+    moves &= ~SQUARE_BIT(square);
   }
 }
 
-void highlight_jumps(Checker* active_checker)
+void highlight_jumps(uint32_t jumps)
 {
-  // highlights the jumps of the checker given, unless equal to the void tile
-  for (uint8_t i = 0; i < POSSIBLE_MOVES; i++){
-    if (active_checker->jumps[i] != VOID_TILE){
-      highlight_tile(active_checker->jumps[i], JUMP_HIGHLIGHT);
-    }
-  }
-}
-
-// Sub0.304: move & jump verification
-
-uint8_t selection_matches_move(uint8_t selection, Checker* active_checker,
-			       uint8_t check_moves)
-{
-  /*
-    determines whether the given checker can move to the tile selected, where:
-    
-    selection: the tile selected
-    active_checker: the checker whose moves we are comparing to the selection
-    check_moves: whether to check the checkers moves or jumps to selection
-   */
-
-  // no matches until proven otherwise
-  uint8_t matches = 0;
-
-  for (uint8_t i = 0; i < POSSIBLE_MOVES; i++){
-    if (check_moves) {
-      if (selection == active_checker->moves[i]){
-	matches = 1;
-      }
-    }
-    else {
-      if (selection == active_checker->jumps[i]){
-	matches = 1;
-      }
-    }
+  // highlights the tiles of the given set of jump squares
+  while (jumps){
+    uint8_t square = FIRST_SQUARE(jumps);
+    highlight_tile(square_to_tile(square), JUMP_HIGHLIGHT);
+    jumps &= ~SQUARE_BIT(square);
   }
-  return matches;
 }
 
-uint8_t check_can_move(Checker* active_checker)
+void highlight_chain(uint32_t chain)
 {
-  // determines whether the given checker has an available move
-  uint8_t matches = 0;
-
-  for (uint8_t i = 0; i < POSSIBLE_MOVES; i++){
-
-    if (active_checker->moves[i] != VOID_TILE){
-      matches = 1;
-    }
+  // highlights the tiles of the given set of later capture squares
+  while (chain){
+    uint8_t square = FIRST_SQUARE(chain);
+    highlight_tile(square_to_tile(square), CHAIN_HIGHLIGHT);
+    chain &= ~SQUARE_BIT(square);
   }
-  return matches;
-}	
-
-uint8_t check_must_jump(Checker* active_checker)
-{
-  // determines whether the given checker has an available jump
-  uint8_t matches = 0;
-  for (uint8_t i = 0; i < POSSIBLE_MOVES; i++){
-    if (active_checker->jumps[i] != VOID_TILE){
-      matches = 1;
-    }
-  }
-  return matches;
-}		    
-
-uint8_t player_has_move(Checker* player_checkers) {
-  // determines whether the given player has a checker with a move
-  uint8_t player_has_move = 1;
-  for (uint8_t i = 0; i < CHECKERS_PER_SIDE; i++) {
-    if (check_can_move(&player_checkers[i])) {
-      player_has_move = 0;
-    }
-  }
-  return player_has_move;
 }
 
-
-// Sub0.305: checker jumping & movement
-
-void move_checker(Tile* tile_array, Checker* active_checker, 
-		  uint8_t active_tile, uint8_t destination_tile)
+uint32_t compute_chain(Board* board, uint8_t square, uint8_t djump)
 {
   /*
-    move a checker from its current position to new position at destination
-    tile; we don't have to worry about whether this move is valid, since this
-    is already checked before calling this procedure, where:
-
-    tile_array: the array of tiles of our checker board
-    active_checker: the checker we are moving
-    active_tile: the tile of the checker being moved
-    destination_tile: the tile to which the checker is moving
-    
-   */
-
-  tile_array[destination_tile].has_checker = 
-    tile_array[active_tile].has_checker;
-  tile_array[destination_tile].checker_num = 
-    tile_array[active_tile].checker_num;
-
-  tile_array[active_tile].has_checker = 0;
-  tile_array[active_tile].checker_num = 13;
+    computes the squares landed on after the first hop by the capture
+    sequences of the checker on a square, so that whole chains can be
+    previewed when the checker is selected, where:
 
-  uint8_t* x_y = tile_to_coord(destination_tile);
-  // king the checker if it moved into the 0th or 7th row
-
-  active_checker->x_tile = x_y[0];
-  active_checker->y_tile = x_y[1];
-  if(x_y[1] == 0 || x_y[1] == 7){
-    active_checker->is_kinged = 1;
-  }
-  play_move_sound();
-}
-
-
-uint8_t jump_checker(Tile* tile_array, Checker* active_checker, 
-		  uint8_t active_tile, uint8_t destination_tile)
-{
-  /* 
-     jump a checker to the destination tile and return the index of the tile
-     just jumped; we don't need to worry about whether this jump is valid, 
-     since this is checked in another procedure, where:
-
-     tile_array: the array of tiles of our checker board
-     active_checker: the checker that is jumping
-     active_tile: the tile from which the checker is jumping
-     destination_tile: the tile to which to checker is jumping
+    board: the checker board
+    square: the square of the checker selected
+    djump: whether the checker is partway through a double jump
    */
-  tile_array[destination_tile].has_checker = 
-    tile_array[active_tile].has_checker;
-  tile_array[destination_tile].checker_num = 
-    tile_array[active_tile].checker_num;
-
-  tile_array[active_tile].has_checker = 0;
-  tile_array[active_tile].checker_num = 13;
-  
-  // the tile jumped is the one between the active and destination tiles:
-  uint8_t rm_tile =  (active_tile + destination_tile) / 2; // avg of the two
-
-  uint8_t* x_y = tile_to_coord(destination_tile);
-  active_checker->x_tile = x_y[0];
-  active_checker->y_tile = x_y[1];
-
-
-  if(x_y[1] == 0 || x_y[1] == 7){
-    active_checker->is_kinged = 1;
+  Move sequences[MAX_MOVES];
+  uint8_t path[CHECKERS_PER_SIDE];
+  uint32_t chain = 0;
+  uint8_t count = generate_checker_captures(board, square, djump,
+					    sequences, 0);
+
+  for (uint8_t i = 0; i < count; i++){
+    uint8_t hops = capture_path(board, &sequences[i], path);
+    for (uint8_t hop = 1; hop < hops; hop++){
+      chain |= SQUARE_BIT(path[hop]);
+    }
   }
-
-  play_jump_sound();
-
-  return rm_tile;
+  return chain;
 }
 
-
 // Sub0.307: joystick tile manipulation
 
 uint8_t modify_tile_select(int joy_x, int joy_y, uint8_t* tile_highlighted)
@@ -872,12 +634,13 @@ uint8_t modify_tile_select(int joy_x, int joy_y, uint8_t* tile_highlighted)
 
 // Sub0.308: nicer boolean functions
 
-uint8_t player_piece_on_tile(Tile* tile_array, uint8_t tile_highlighted, 
+uint8_t player_piece_on_tile(Board* board, uint8_t tile_highlighted, 
 			     int8_t current_turn)
 {
   // determines whether the current player's piece is on the tile; a bit more
   // instructive than the below statement returned
-  return (tile_array[tile_highlighted].has_checker == current_turn);
+  return (checker_color(board, tile_to_square(tile_highlighted)) == 
+	  current_turn);
 }
 
 // Sub0.309: debounce reset
@@ -891,6 +654,27 @@ void bouncer_reset()
   }
 }
 
+void clock_tick()
+{
+  // called by Timer3 every millisecond, to keep the clock and reset the
+  // debounce every BOUNCE_PERIOD
+  ticks++;
+  if (++bounce_ticks == BOUNCE_PERIOD / TICK_PERIOD){
+    bounce_ticks = 0;
+    bouncer_reset();
+  }
+}
+
+uint32_t clock_ms()
+{
+  // the milliseconds since setup, read with the timer interrupt held off so
+  // that all four bytes come from the same tick
+  noInterrupts();
+  uint32_t now = ticks;
+  interrupts();
+  return now;
+}
+
 // Sub0.310: sounds & music
 
 void play_jump_sound(){
@@ -932,177 +716,289 @@ void play_victory_music(){
 
 // Sub0.310: debug procedures
 // these will not operate without the debug button in place!!!!
-void print_all_data(Tile* tile_array, Checker* red_checkers, 
-		    Checker* blue_checkers, Checker* player_checkers){
+void print_all_data(Board* board){
   // massive debug procedure that prints all of the checker data to the serial
   // monitor (there were bad bugs, in case you were wondering)
   Serial.println();
-  Serial.println("has_checker board:");
-  Serial.println("**********");
-  for(int i = 0; i < NUM_TILES; i++){
-    if( !(i%8) ){
-      Serial.print("*");
-    }
-    if(tile_array[i].has_checker == 0){
-      Serial.print("0");
-    }
-    else if(tile_array[i].has_checker == 1){
-      Serial.print("R");
-    }
-    else if(tile_array[i].has_checker == -1){
-      Serial.print("B");
-    }
-    else {Serial.print(tile_array[i].has_checker);}
-    if( !((i+1) % 8)){
-      Serial.println("*");
-    }
-  }
-  Serial.println("**********");
-  Serial.println();
-  Serial.println("checker_num board:");
-  Serial.println("******************");
-  for(int i = 0; i < NUM_TILES; i++){
-    if( !(i%8) ){
-      Serial.print("*");
-    }
-    if(tile_array[i].checker_num < 10){
-      Serial.print(" ");
-      Serial.print(tile_array[i].checker_num);
-    }
-    else {Serial.print(tile_array[i].checker_num);}
-    if( !((i+1) % 8)){
-      Serial.println("*");
-    }
-  }
-  Serial.println("******************");
+  Serial.println(F("board (r/b checkers, R/B kings):"));
+  print_board_data(board);
   Serial.println();
 
-  Serial.println("Red checker data:");
-  Serial.println("   X: Y: King: In: MJ: Jumps:          Moves:");
+  Serial.println(F("bitboards:"));
+  Serial.print(F("red:   ")); Serial.println(board->red, HEX);
+  Serial.print(F("blue:  ")); Serial.println(board->blue, HEX);
+  Serial.print(F("kings: ")); Serial.println(board->kings, HEX);
+  Serial.print(F("key:   ")); Serial.print((uint32_t) (board->key >> 32), HEX);
+  Serial.println((uint32_t) board->key, HEX);
+  Serial.print(F("repeats: ")); Serial.println(position_repeats(&keys));
   Serial.println();
-  for(int i=0; i < CHECKERS_PER_SIDE; i++){
-    Serial.print("#"); Serial.print(i); Serial.print(":"); Serial.print(" ");
-    if(i < 10){ Serial.print(" ");}
-    Serial.print(red_checkers[i].x_tile); Serial.print(" ");
-    if(red_checkers[i].x_tile < 10){Serial.print(" ");}
-    Serial.print(red_checkers[i].y_tile); Serial.print("    ");
-    if(red_checkers[i].x_tile < 10){Serial.print(" ");}
-    Serial.print(red_checkers[i].is_kinged); Serial.print("   ");
-    Serial.print(red_checkers[i].in_play); Serial.print("   ");
-    Serial.print(red_checkers[i].must_jump); Serial.print("      ");
-    for(int j = 0; j < POSSIBLE_MOVES; j++){
-      Serial.print(red_checkers[i].jumps[j]); Serial.print(", ");
-      if(red_checkers[i].jumps[j] < 10){ Serial.print(" ");}
-    }
-    for(int j = 0; j < POSSIBLE_MOVES; j++){
-      Serial.print(red_checkers[i].moves[j]); Serial.print(", ");
-      if(red_checkers[i].moves[j] < 10){ Serial.print(" ");}
-    }
-    Serial.println();
-  }
-  Serial.println();
-  Serial.println();
-  Serial.println("Blue checker data:");
-  Serial.println("   X: Y: King: In: MJ: Jumps:          Moves:");
-  Serial.println();
-  for(int i=0; i < CHECKERS_PER_SIDE; i++){
-    Serial.print("#"); Serial.print(i); Serial.print(":"); Serial.print(" ");
-    if(i < 10){ Serial.print(" ");}
-    Serial.print(blue_checkers[i].x_tile); Serial.print(" ");
-    if(blue_checkers[i].x_tile < 10){Serial.print(" ");}
-    Serial.print(blue_checkers[i].y_tile); Serial.print("    ");
-    if(blue_checkers[i].x_tile < 10){Serial.print(" ");}
-    Serial.print(blue_checkers[i].is_kinged); Serial.print("   ");
-    Serial.print(blue_checkers[i].in_play); Serial.print("   ");
-    Serial.print(blue_checkers[i].must_jump); Serial.print("      ");
-    for(int j = 0; j < POSSIBLE_MOVES; j++){
-      Serial.print(blue_checkers[i].jumps[j]); Serial.print(", ");
-      if(blue_checkers[i].jumps[j] < 10){ Serial.print(" ");}
-    }
-    for(int j = 0; j < POSSIBLE_MOVES; j++){
-      Serial.print(blue_checkers[i].moves[j]); Serial.print(", ");
-      if(blue_checkers[i].moves[j] < 10){ Serial.print(" ");} 
-    }
-    Serial.println();
+
+  Serial.print(F("player moves: ")); Serial.println(player_moves.count);
+  for (uint8_t i = 0; i < player_moves.count; i++){
+    Serial.print(F("  ")); Serial.print(player_moves.moves[i].from);
+    Serial.print(F(" -> ")); Serial.print(player_moves.moves[i].to);
+    Serial.print(F(" taking "));
+    Serial.println(player_moves.moves[i].captured, HEX);
   }
-  Serial.println();
+  Serial.print(F("red movers:   "));
+  Serial.println(move_state.movers[PLAYER_INDEX(TURN_RED)], HEX);
+  Serial.print(F("blue movers:  "));
+  Serial.println(move_state.movers[PLAYER_INDEX(TURN_BLUE)], HEX);
+  Serial.print(F("dirty squares:  ")); Serial.println(move_state.dirty, HEX);
+  Serial.print(F("no forced jumps: ")); Serial.println(no_fjumps);
+  Serial.print(F("active square: ")); Serial.print(active_square);
+  Serial.print(F(" moves: ")); Serial.println(active_moves, HEX);
   Serial.println();
 }
 
-void print_board_data(Tile* tile_array){
+void print_board_data(Board* board){
   // Prints the board to serial-mon for debugging purposes
-  Serial.println("**********");
+  Serial.println(F("**********"));
   for(int i = 0; i < NUM_TILES; i++){
     if( !(i%8) ){
-      Serial.print("*");
-    }
-    if(tile_array[i].has_checker == 0){
-      Serial.print("0");
+      Serial.print(F("*"));
     }
-    else if(tile_array[i].has_checker == 1){
-      Serial.print("R");
+    uint8_t square = tile_to_square(i);
+    int8_t color = checker_color(board, square);
+    uint8_t kinged = color && (board->kings & SQUARE_BIT(square));
+
+    if(color == TURN_RED){
+      Serial.print(kinged ? "R" : "r");
     }
-    else if(tile_array[i].has_checker == -1){
-      Serial.print("B");
+    else if(color == TURN_BLUE){
+      Serial.print(kinged ? "B" : "b");
     }
-    else {Serial.print("0");}
+    else {Serial.print(F("0"));}
     if( !((i+1) % 8)){
-      Serial.println("*");
+      Serial.println(F("*"));
     }
   }
-  Serial.println("**********");
-  Serial.println(no_fjumps);
-
-  Serial.println("RED:");
-  for (int i = 0 ; i < CHECKERS_PER_SIDE; i++){
-    Serial.print("checker["); Serial.print(i); Serial.print("]s moves: ");
-    for (int j = 0; j < POSSIBLE_MOVES; j++) {
-      Serial.print(red_checkers[i].moves[j]); Serial.print(", ");
-    }
-    Serial.print("  location: ("); Serial.print(red_checkers[i].x_tile);
-    Serial.print(", "); Serial.print(red_checkers[i].y_tile); 
-    Serial.print(" ) ");
-    Serial.println();
+  Serial.println(F("**********"));
+}
+
+// Sub0.312: undo & redo
+
+void record_turn(uint8_t destination_square)
+{
+  /*
+    pushes the turn just played onto the move history as one whole move,
+    by playing it again from the board as the turn began, where:
+
+    destination_square: the square the checker finished on
+
+    uses globals: board, turn_board, turn_from, history, player_turn
+   */
+  uint32_t opp_before = (player_turn == TURN_RED) ? turn_board.blue :
+    turn_board.red;
+  uint32_t opp_after = (player_turn == TURN_RED) ? board.blue : board.red;
+  Move move = { turn_from, destination_square, opp_before & ~opp_after };
+
+  board = turn_board;
+  push_move(&history, &board, &move);
+}
+
+uint8_t take_back_turn(uint8_t redo)
+{
+  /*
+    undoes the last turn played, or plays again the last turn undone, and
+    leaves player_turn so that the next turn change hands the turn to
+    whoever is to play next, where:
+
+    redo: whether to play the turn again rather than undo it
+
+    returns 1 if there was a turn to undo or redo
+
+    uses globals: board, history, keys, move_state, red_dead, blue_dead,
+                  player_turn, tile_highlighted
+   */
+  const MoveRecord* record = redo ? redo_move(&history, &board) :
+    undo_move(&history, &board);
+  if (!record){
+    return 0;
   }
-  for (int i = 0 ; i < CHECKERS_PER_SIDE; i++){
 
-    Serial.println("RED:");
-    Serial.print("checker["); Serial.print(i); Serial.print("]s jumps: ");
-    for (int j = 0; j < POSSIBLE_MOVES; j++) {
-      Serial.print(red_checkers[i].jumps[j]); Serial.print(", ");
-    }
-    Serial.print("  location: ("); Serial.print(red_checkers[i].x_tile);
-    Serial.print(", "); Serial.print(red_checkers[i].y_tile); 
-    Serial.print(" ) ");
-    Serial.println();
+  // the player who played the turn, going by the checker that moved
+  int16_t mover = checker_color(&board, redo ? record->move.to :
+				record->move.from);
+  uint8_t* mover_dead = (mover == TURN_RED) ? &red_dead : &blue_dead;
+  uint8_t taken = __builtin_popcountl(record->move.captured);
+
+  if (redo) { (*mover_dead) += taken; }
+  else {
+    (*mover_dead) -= taken;
+    pop_key(&keys);
+  }
+  player_turn = redo ? mover : (-1) * mover;
+
+  update_move_state(&board, &move_state, SQUARE_BIT(record->move.from) |
+		    SQUARE_BIT(record->move.to) | record->move.captured);
+  clear_draw(&board, &move_state, 0, tile_highlighted, tile_highlighted);
+  draw_graveyard();
+  return 1;
+}
+
+// Sub0.313: computer player
+
+void think_computer_turn()
+{
+  /*
+    lets the computer think about its move for COMPUTER_BUDGET, leaving it
+    in search.best, and reports how deep it searched and how fast over
+    Serial, with the positions the move arena was too full to search
+
+    uses globals: board, keys, search, player_turn
+   */
+  think(&search, &board, player_turn, &keys, COMPUTER_BUDGET, MAX_PLY);
+
+  Serial.print(F("depth ")); Serial.print(search.depth);
+  Serial.print(F(" score ")); Serial.print(search.score);
+  Serial.print(F(" nodes ")); Serial.print(search.nodes);
+  Serial.print(F(" crowded ")); Serial.print(search.crowded);
+  Serial.print(F(" nps "));
+  Serial.println(search.elapsed ?
+		 (uint32_t) ((1000.0 * search.nodes) / search.elapsed) : 0);
+  if (search.table){
+    Serial.print(F("table hits ")); Serial.print(search.hits);
+    Serial.print(F(" / ")); Serial.print(search.probes);
+    Serial.print(F(" probes ("));
+    Serial.print(search.probes ?
+		 (100.0 * search.hits) / search.probes : 0.0);
+    Serial.println(F("%)"));
   }
-  for (int i = 0 ; i < CHECKERS_PER_SIDE; i++){
-    Serial.println("BLUE:");
-    Serial.print("checker["); Serial.print(i); Serial.print("]s moves: ");
-    for (int j = 0; j < POSSIBLE_MOVES; j++) {
-      Serial.print(blue_checkers[i].moves[j]); Serial.print(", ");
+}
+
+void play_computer_turn()
+{
+  /*
+    plays the computer's move, hop by hop for a capture sequence: one from
+    the opening book or the best in the endgame database if the position
+    is in either, or else the best it finds thinking for COMPUTER_BUDGET
+
+    uses globals: board, keys, search, tablebase, tablebase_open,
+                  move_state, player_turn, player_dead, rm_square,
+                  turn_from, turn_change
+   */
+  // openings in the book and endings in the database are played from them;
+  // the rest are thought about.  The book's choice is random, from the
+  // microseconds the player took over their move
+  Move move;
+  uint8_t value = TABLEBASE_UNKNOWN;
+  if (tablebase_open){
+    // the tablebase keeps its block in the SD library's block cache, which
+    // the images drawn since the last move have used
+    lend_tablebase_block(&tablebase, SdVolume::cacheClear());
+  }
+  if (book_move(&board, player_turn, (uint16_t) micros(), &move)){
+    Serial.println(F("book move"));
+  }
+  else if (tablebase_open &&
+	   (value = tablebase_move(&tablebase, &board, player_turn, &move))
+	   != TABLEBASE_UNKNOWN){
+    Serial.print(F("tablebase "));
+    Serial.print(ENDGAME_WON(value) ? "win" :
+		 ENDGAME_LOST(value) ? "loss" : "draw");
+    if (value != ENDGAME_DRAW){
+      Serial.print(F(" in ")); Serial.print(ENDGAME_PLIES(value));
     }
-    Serial.print("  location: ("); Serial.print(blue_checkers[i].x_tile);
-    Serial.print(", "); Serial.print(blue_checkers[i].y_tile); 
-    Serial.print(" ) ");
-    Serial.println();
+    Serial.print(F(" plies, blocks read ")); Serial.print(tablebase.reads);
+    Serial.print(F(" / ")); Serial.print(tablebase.probes);
+    Serial.println(F(" probes"));
   }
-  for (int i = 0 ; i < CHECKERS_PER_SIDE; i++){
+  else {
+    think_computer_turn();
+    move = search.best;
+  }
+  turn_from = move.from;
 
-    Serial.println();
-    Serial.println("BLUE:");
-    Serial.print("checker["); Serial.print(i); Serial.print("]s jumps: ");
-    for (int j = 0; j < POSSIBLE_MOVES; j++) {
-      Serial.print(blue_checkers[i].jumps[j]); Serial.print(", ");
+  if (!move.captured){
+    move_checker(&board, move.from, move.to);
+    update_move_state(&board, &move_state, SQUARE_BIT(move.from) |
+		      SQUARE_BIT(move.to));
+    play_move_sound();
+  }
+  else {
+    // play the sequence a hop at a time, as a player would
+    uint8_t path[CHECKERS_PER_SIDE];
+    uint8_t hops = capture_path(&board, &move, path);
+    uint8_t square = move.from;
+
+    for (uint8_t hop = 0; hop < hops; hop++){
+      rm_square = jump_checker(&board, square, path[hop]);
+      update_move_state(&board, &move_state, SQUARE_BIT(square) |
+			SQUARE_BIT(rm_square) | SQUARE_BIT(path[hop]));
+      clear_draw(&board, &move_state, 0, tile_highlighted, tile_highlighted);
+      play_jump_sound();
+
+      (*player_dead) = (*player_dead) + 1;
+      populate_graveyard(*player_dead, player_turn);
+      square = path[hop];
     }
-    Serial.print("  location: ("); Serial.print(blue_checkers[i].x_tile);
-    Serial.print(", "); Serial.print(blue_checkers[i].y_tile); 
-    Serial.print(" ) ");
-    Serial.println();
-    Serial.println();
   }
+
+  clear_draw(&board, &move_state, 0, tile_highlighted, tile_highlighted);
+  record_turn(move.to);
+  turn_change = 1;
+}
+
+uint8_t find_endgame_file()
+{
+  /*
+    finds the blocks of the card that ENDGAME_FILE takes, so that
+    read_card_block can read them raw, without the file system; the file
+    has to lie in one piece, within the card, and returns 0 if it does not
+
+    uses globals: card, endgame_start, endgame_blocks
+   */
+  SdVolume volume;
+  SdFile root;
+  SdFile file;
+  uint32_t last;
+
+  endgame_blocks = 0;
+  if (!volume.init(&card) || !root.openRoot(&volume) ||
+      !file.open(&root, ENDGAME_FILE, O_READ)){
+    return 0;
+  }
+  uint32_t size = file.fileSize();
+  if (!size || !file.contiguousRange(&endgame_start, &last) ||
+      last >= card.cardSize() ||
+      (size + ENDGAME_BLOCK - 1) / ENDGAME_BLOCK > last - endgame_start + 1){
+    file.close();
+    return 0;
+  }
+  file.close();
+  endgame_blocks = (size + ENDGAME_BLOCK - 1) / ENDGAME_BLOCK;
+  return 1;
 }
 
+uint8_t read_card_block(uint32_t block, uint8_t* data)
+{
+  // reads a block of the endgame database from where it sits on the card,
+  // and nothing past its end
+  if (block >= endgame_blocks){
+    return 0;
+  }
+  return card.readBlock(endgame_start + block, data);
+}
+
+void idle(uint16_t wait_time)
+{
+  /*
+    waits for the given milliseconds, as delay does, pondering the
+    computer's next move meanwhile if the player is choosing theirs; the
+    wait after a cursor move is time the loop does not read the joystick
+    anyway, so pondering through it does not hold up the player
+
+    uses globals: search
+   */
+  uint32_t start = clock_ms();
+  ponder(&search, wait_time);
+
+  uint32_t spent = clock_ms() - start;
+  if (spent < wait_time){
+    delay(wait_time - spent);
+  }
+}
 
 
 //****************************************************************************
@@ -1115,23 +1011,38 @@ void setup()
   Serial.begin(9600);
   tft.initR(INITR_REDTAB);   // initialize a ST7735R chip, red tab
 
-  Serial.print("Avail mem (bytes):");
+  Serial.print(F("Avail mem (bytes):"));
   Serial.println(AVAIL_MEM);
 
-  Serial.print("Initializing SD card...");
+  Serial.print(F("Initializing SD card..."));
   if (!SD.begin(SD_CS)) {
-    Serial.println("failed!");
+    Serial.println(F("failed!"));
     return;
   }
-  Serial.println(" succeeded!");
+  Serial.println(F(" succeeded!"));
 
   if (!card.init(SPI_HALF_SPEED, SD_CS)) {
-    Serial.println("Raw SD Initialization has failed");
+    Serial.println(F("Raw SD Initialization has failed"));
     while (1) {};  // Just wait, stuff exploded.
   }
 
-  // Sub0.401 drawing the checker board
-
+  // the endgame database, if it is on the card; its block is kept in the
+  // SD library's block cache, borrowed afresh for each move looked up
+  tablebase_open = find_endgame_file() &&
+    open_tablebase(&tablebase, read_card_block, tablebase_slices,
+		   TABLEBASE_SLICES, SdVolume::cacheClear());
+  Serial.print(F("Endgame tablebase (checkers):"));
+  Serial.println(tablebase.pieces);
+  Serial.print(F("Opening book (moves):"));
+  Serial.println(book_size());
+
+  // Sub0.401 timing a tile's redraw, which every move of the cursor
+  // costs; the board is drawn over when the game is set up
+  setup_board(&board);
+  uint32_t draw_start = micros();
+  draw_tile(&board, square_to_tile(0));
+  Serial.print(F("Tile redraw (us):"));
+  Serial.println(micros() - draw_start);
 
   // Sub0.402: set up pins
   // joystick
@@ -1155,8 +1066,40 @@ void setup()
   joy_min_y = (((int32_t) joy_y) * JOY_REMAP_MAX) / (joy_y - VOLT_MAX);
 
   // Sub0.404: initialize time-based interrupt
-  Timer3.initialize();
-  Timer3.attachInterrupt(bouncer_reset, BOUNCE_PERIOD);
+  Timer3.initialize(TICK_PERIOD);
+  Timer3.attachInterrupt(clock_tick, TICK_PERIOD);
+
+  // Sub0.405: computer player
+  // grounding the computer switch gives a game against the mega, which
+  // plays red; blue, the human, moves first
+  pinMode(COMPUTER_SWITCH, INPUT);
+  digitalWrite(COMPUTER_SWITCH, HIGH);
+  if (digitalRead(COMPUTER_SWITCH) == LOW){
+    computer_turn = TURN_RED;
+  }
+
+  // the transposition table takes whatever SRAM is left once the stack has
+  // its reserve, as the largest power of two buckets that fit; this is the
+  // only allocation, and it is never freed.  With less than
+  // TABLE_MIN_BYTES to spare the computer searches without a table
+  int16_t spare = AVAIL_MEM - STACK_RESERVE;
+  uint32_t table_size = (spare > 0) ? table_bytes(spare) : 0;
+  void* table_memory = (table_size >= TABLE_MIN_BYTES) ?
+    malloc(table_size) : NULL;
+  if (table_memory && init_table(&table, table_memory, table_size)){
+    init_search(&search, clock_ms, &table);
+  }
+  else {
+    init_search(&search, clock_ms, NULL);
+    table_size = 0;
+  }
+  Serial.print(F("Transposition table (bytes):"));
+  Serial.println(table_size);
+  Serial.print(F("Left for the stack (bytes):"));
+  Serial.println(AVAIL_MEM);
+  if (AVAIL_MEM < STACK_RESERVE){
+    Serial.println(F("Too little SRAM left for the search's stack!"));
+  }
 }
 
 
@@ -1182,40 +1125,20 @@ void loop()
     tft.fillScreen(0); // fill to black  
     lcd_image_draw(&cb_img, &tft, 0, 0, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
 
-    // Fill the red checker array with blank checkers
-    for (uint8_t i = 1; i < NUM_TILES; i++){
-      tile_array[i].has_checker = 0;
+    setup_board(&board);
+    init_move_state(&board, &move_state);
+    clear_moves(&history);
+    clear_keys(&keys);
+    stop_ponder(&search);
+    if (search.table) {
+      clear_table(search.table);
     }
-    for (uint8_t i = 0; i < CHECKERS_PER_SIDE; i++) {	
-      uint8_t x_ti = (2*(i%4) + (((i/4) + 1)%2)); // fancy maths
-      uint8_t y_ti = i/4;
-      red_checkers[i].x_tile = x_ti;
-      red_checkers[i].y_tile = y_ti;
-      red_checkers[i].is_kinged = 0;
-      red_checkers[i].in_play = 1;
-      // record that the proper tiles contain these checkers
-      tile_array[coord_to_tile(x_ti, y_ti)].has_checker = TURN_RED;
-      tile_array[coord_to_tile(x_ti, y_ti)].checker_num = i;
-    }
-
-    // Fill the blue checker array with blank checkers
-    for (uint8_t i = 0; i < CHECKERS_PER_SIDE; i++) {
-      // x_ti, y_ti first declared above
-      uint8_t x_ti = (2*(i%4) + ((i/4)%2));
-      uint8_t y_ti = (i/4) + 5;
-      blue_checkers[i].x_tile = x_ti;
-      blue_checkers[i].y_tile = y_ti;
-      blue_checkers[i].is_kinged = 0;
-      blue_checkers[i].in_play = 1;
-      // record that the proper tiles contain these checkers
-      tile_array[coord_to_tile(x_ti, y_ti)].has_checker = TURN_BLUE;
-      tile_array[coord_to_tile(x_ti, y_ti)].checker_num = i;
-    }
-    for (uint8_t i = 1; i < 24; i = i + 2) { // draw all the checker tiles
-      draw_tile(tile_array, red_checkers, blue_checkers, i - (i/8)%2);
-      draw_tile(tile_array, red_checkers, blue_checkers, (i + 40) -
-		((i+40)/8)%2); // works, don't know why
+    for (uint8_t i = 0; i < NUM_SQUARES; i++) { // draw the checker tiles
+      if (checker_color(&board, i)) {
+	draw_tile(&board, square_to_tile(i));
+      }
     }
+    move_state.dirty = 0; // the empty squares are drawn already
     
     red_dead = 0;
     blue_dead = 0;
@@ -1223,7 +1146,6 @@ void loop()
     turn_change = 1;
     tile_highlighted = DEFAULT_TILE;
     game_state = PLAY_MODE;
-    tile_array[0].has_checker = 42;
 
   }
 
@@ -1233,27 +1155,34 @@ void loop()
 
     if (turn_change){
       change_turn();
+      turn_board = board;
+      push_key(&keys, position_key(&board, player_turn), history.made ?
+	       history.records[history.made - 1].irreversible : 1);
       // highlight the last tile highlighted with the new player's turn
       highlight_tile(tile_highlighted, player_turn);
 
-      for (int i = 0; i < CHECKERS_PER_SIDE; i++){
-	// assume all previous moves are now invalid, and clear new checkers
-	player_checkers[i].must_jump = 0;
-	for (int j = 0; j < POSSIBLE_MOVES; j++){
-	  player_checkers[i].moves[j] = VOID_TILE;
-	  player_checkers[i].jumps[j] = VOID_TILE;
-	}
-      }
-      // recompute moves and jumps for all checkers in current player's chkers
-      no_fjumps = compute_moves(tile_array, player_checkers, 
-				(-1) * player_turn);
-      no_moves = player_has_move(player_checkers);
+      // list the legal moves of all the player's checkers at once; a
+      // player with none has lost
+      no_fjumps = generate_moves(&board, player_turn, &player_moves);
+      no_moves = !player_moves.count;
 
       if (no_moves) {
 	win_screen((-1) * player_turn);
       }
+      else if (position_drawn(&keys)) {
+	win_screen(0);
+      }
       turn_change = 0;
 
+      if (game_state == PLAY_MODE && player_turn == computer_turn) {
+	play_computer_turn();
+      }
+      else if (game_state == PLAY_MODE && computer_turn) {
+	// guess the player's move, and think about the reply while they
+	// choose it
+	start_ponder(&search, &board, player_turn, &keys);
+      }
+
     }
 
     // Sub0.503: reading joystick movement
@@ -1267,25 +1196,28 @@ void loop()
 
     if ((joy_x != 0 || joy_y != 0) && !cursor_mode) { // moved, not selecting
       // modify the primary tile highlight
-      draw_tile(tile_array, red_checkers, blue_checkers, tile_highlighted);
+      draw_tile(&board, tile_highlighted);
       modify_tile_select(joy_x, joy_y, &tile_highlighted);
 
       // redraw certain tiles
       highlight_tile(tile_highlighted, player_turn);
-      delay(joy_delay_time);
+      idle(joy_delay_time);
     }
 
     else if ((joy_x !=0 || joy_y != 0) && cursor_mode){ // moved, selecting
       // modify the secondary tile highlight
-      draw_tile(tile_array, red_checkers, blue_checkers, subtile_highlighted);
+      draw_tile(&board, subtile_highlighted);
       modify_tile_select(joy_x, joy_y, &subtile_highlighted);
 
       // draw over old tiles, with precedence: moves/jumps>subtile>tile
-      if (no_fjumps){ highlight_moves(active_checker); }
-      else { highlight_jumps(active_checker); }
+      if (no_fjumps){ highlight_moves(active_moves); }
+      else {
+	highlight_chain(active_chain);
+	highlight_jumps(active_moves);
+      }
       highlight_tile(subtile_highlighted, player_turn);
       highlight_tile(tile_highlighted, TILE_HIGHLIGHT);
-      delay(joy_delay_time);
+      idle(joy_delay_time);
 
     }
 
@@ -1293,20 +1225,37 @@ void loop()
 
     if (digitalRead(JOYSTICK_BUTTON) == LOW && bouncer > 1){
       bouncer = 0; // debounce
-      if (cursor_mode == TILE_MOVEMENT) {
+      if (cursor_mode == TILE_MOVEMENT && joy_x != 0) {
+
+	// Sub0.509: undo & redo
+
+	// pressing with the joystick held left undoes a turn, and held
+	// right plays it again; against the computer, its reply goes too
+	if (take_back_turn(joy_x > 0)){
+	  if (computer_turn){
+	    take_back_turn(joy_x > 0);
+	  }
+	  if (joy_x < 0){
+	    pop_key(&keys); // the turn change records this position again
+	  }
+	  turn_change = 1;
+	}
+      }
+      else if (cursor_mode == TILE_MOVEMENT) {
 
 	// Sub0.505: checker selection
 
-	if (player_piece_on_tile(tile_array, tile_highlighted, player_turn)){
+	if (player_piece_on_tile(&board, tile_highlighted, player_turn)){
 	  // set active checker to the one we're selecting
-	  active_checker = 
-	(Checker*) &player_checkers[tile_array[tile_highlighted].checker_num];
+	  active_square = tile_to_square(tile_highlighted);
+	  turn_from = active_square;
 
 	  if (no_fjumps) {
 	    // check whether piece can move
-	    if (check_can_move(active_checker)) {
+	    active_moves = move_destinations(&player_moves, active_square);
+	    if (active_moves) {
 	      // select the checker and highlight its moves
-	      highlight_moves(active_checker);
+	      highlight_moves(active_moves);
 	      highlight_tile(tile_highlighted, TILE_HIGHLIGHT);
 
 	      cursor_mode = SUBTILE_MOVEMENT;
@@ -1315,9 +1264,12 @@ void loop()
 	  }
 	  else {
 	    // check whether piece must jump
-	    if (check_must_jump(active_checker)) {
+	    if (move_destinations(&player_moves, active_square)) {
 	      // select the checker and highlight its jumps
-	      highlight_jumps(active_checker);
+	      active_moves = compute_checker_jumps(&board, active_square, 0);
+	      active_chain = compute_chain(&board, active_square, 0);
+	      highlight_chain(active_chain);
+	      highlight_jumps(active_moves);
 	      highlight_tile(tile_highlighted, TILE_HIGHLIGHT);
 	      signal_redraw = 1;
 
@@ -1332,19 +1284,22 @@ void loop()
 
 	  // Sub0.506: move selection
 
-	  if (selection_matches_move(subtile_highlighted, active_checker, 
-				     no_fjumps)) {
+	  if (selection_matches_move(subtile_highlighted, active_moves)) {
 	    // move checker
-	    move_checker(tile_array, active_checker, 
-			 tile_highlighted, subtile_highlighted);
-	    clear_draw(tile_array, active_checker, red_checkers, 
-		       blue_checkers, tile_highlighted, subtile_highlighted);
+	    move_checker(&board, active_square, 
+			 tile_to_square(subtile_highlighted));
+	    update_move_state(&board, &move_state, SQUARE_BIT(active_square) |
+			      SQUARE_BIT(tile_to_square(subtile_highlighted)));
+	    play_move_sound();
+	    clear_draw(&board, &move_state, active_moves | active_chain,
+		       tile_highlighted, subtile_highlighted);
+	    record_turn(tile_to_square(subtile_highlighted));
 	    turn_change = 1;
 	    highlight_tile(tile_highlighted, player_turn);
 	  }
 	  else if(!checker_locked){
-	    clear_draw(tile_array, active_checker, red_checkers, 
-	               blue_checkers, tile_highlighted, subtile_highlighted);
+	    clear_draw(&board, &move_state, active_moves | active_chain,
+		       tile_highlighted, subtile_highlighted);
 	    highlight_tile(tile_highlighted, player_turn);
 
 	  }
@@ -1354,70 +1309,48 @@ void loop()
 
 	  // Sub0.507: jump selection
 
-	  if(selection_matches_move(subtile_highlighted, active_checker, 
-				    no_fjumps)) {
-	    // jump checker
-	    rm_tile = jump_checker(tile_array, active_checker, 
-				   tile_highlighted, subtile_highlighted);
-
-
-	    // get rid of the checker we just jumped; messy, so seperated
-	    // ***************************************************************
-	    if ((player_turn) == TURN_RED) {
-	      blue_checkers[tile_array[rm_tile].checker_num].in_play = 0;
-	      for (uint8_t i = 0; i < POSSIBLE_MOVES; i++){
-		blue_checkers[tile_array[rm_tile].checker_num].moves[i] = 
-		  VOID_TILE;
-		blue_checkers[(tile_array[rm_tile].checker_num)].jumps[i] = 
-		  VOID_TILE;
-	      }
-	    }
-	    else {
-	      red_checkers[tile_array[rm_tile].checker_num].in_play = 0;
-	      for (uint8_t i = 0; i < POSSIBLE_MOVES; i++){
-		red_checkers[tile_array[rm_tile].checker_num].moves[i] = 
-		  VOID_TILE;
-		red_checkers[tile_array[rm_tile].checker_num].jumps[i] = 
-		  VOID_TILE;
-	      }
-	    }
-	    
-	    tile_array[rm_tile].has_checker = 0;
-	    tile_array[rm_tile].checker_num = 13;
+	  if(selection_matches_move(subtile_highlighted, active_moves)) {
+	    // jump checker, taking the checker it jumps off the board
+	    rm_square = jump_checker(&board, active_square, 
+				     tile_to_square(subtile_highlighted));
+	    update_move_state(&board, &move_state, SQUARE_BIT(active_square) |
+			      SQUARE_BIT(rm_square) |
+			      SQUARE_BIT(tile_to_square(subtile_highlighted)));
+	    active_square = tile_to_square(subtile_highlighted);
+	    play_jump_sound();
 
-	    clear_draw(tile_array, active_checker, red_checkers, 
-		       blue_checkers, tile_highlighted, subtile_highlighted);
+	    clear_draw(&board, &move_state, active_moves | active_chain,
+		       tile_highlighted, subtile_highlighted);
 
 	    // nullify the jumping checkers moves and jumps, for now
-	    for (uint8_t i = 0; i < POSSIBLE_MOVES; i++){
-	      active_checker->moves[i] = VOID_TILE;
-	      active_checker->jumps[i] = VOID_TILE;
-	    }
-
-	    //****************************************************************
+	    active_moves = 0;
+	    active_chain = 0;
 
 	    (*player_dead) = (*player_dead) + 1;
 	    populate_graveyard(*player_dead, player_turn);
 
 	    checker_locked = 0;
 	    // now handle double jumping:
-	    if (active_checker->y_tile != 0 && active_checker->y_tile != 7) {
+	    if (subtile_highlighted / 8 != 0 && subtile_highlighted / 8 != 7) {
 	      // recompute the jumping checker's jumps
-	      compute_checker_jumps(tile_array, active_checker,
-				    (-1) * player_turn, 1);
-	      if (check_must_jump(active_checker)) { // if the piece can jump
+	      active_moves = compute_checker_jumps(&board, active_square, 1);
+	      if (active_moves) { // if the piece can jump
 		tile_highlighted = subtile_highlighted;
 		highlight_tile(subtile_highlighted, TILE_HIGHLIGHT);
-		highlight_jumps(active_checker);
+		active_chain = compute_chain(&board, active_square, 1);
+		highlight_chain(active_chain);
+		highlight_jumps(active_moves);
 		checker_locked = 1;
 	      }
 	      else { // else change turn
+		record_turn(active_square);
 		turn_change = 1;
 		cursor_mode = TILE_MOVEMENT;
 		highlight_tile(tile_highlighted, player_turn);
 	      }
 	    }
 	    else { // else change turn
+	      record_turn(active_square);
 	      turn_change = 1;
 	      cursor_mode = TILE_MOVEMENT;
 	      highlight_tile(tile_highlighted, player_turn);
@@ -1425,8 +1358,8 @@ void loop()
 
 	  }
 	  else if(!checker_locked) {
-	    clear_draw(tile_array, active_checker, red_checkers, 
-		       blue_checkers, tile_highlighted, subtile_highlighted);
+	    clear_draw(&board, &move_state, active_moves | active_chain,
+		       tile_highlighted, subtile_highlighted);
 	    cursor_mode = TILE_MOVEMENT;
 	    highlight_tile(tile_highlighted, player_turn);
 	    
@@ -1436,8 +1369,12 @@ void loop()
     } // end button press if
 
     // Sub0.508: debug prompt
-    else if (digitalRead(DEBUG_BUTTON) == LOW){print_all_data(tile_array,
-			    red_checkers, blue_checkers, player_checkers);}
+    else if (digitalRead(DEBUG_BUTTON) == LOW){print_all_data(&board);}
+
+    // while the player chooses their move, with the joystick at rest as
+    // much as not, the computer ponders a slice at a time between reads
+    // of it; a slice is short enough that the next read is not held up
+    ponder(&search, PONDER_SLICE);
   }
 }
 
@@ -0,0 +1,1008 @@
+/*
+  The rules of the game: setting up the board, computing the moves and jumps
+  of the checkers, and moving and jumping them.
+
+  Moves and jumps are computed with shifts and masks over the bitboards in
+  Board, for every checker of a player at once; those of a single checker
+  come from neighbor and landing square tables generated at compile time
+  and kept in flash.
+
+  Nothing in here touches the TFT, the SD card or Serial, so this file
+  builds both into the sketch and on the host (see host/Makefile).
+*/
+
+#include <stddef.h>
+#include <string.h>
+#include "progmem.h"
+#include "rules.h"
+
+// the squares on the even (0, 2, 4, 6) and odd (1, 3, 5, 7) rows
+#define EVEN_ROWS 0x0F0F0F0FUL
+#define ODD_ROWS 0xF0F0F0F0UL
+
+// the squares on the leftmost and rightmost columns
+#define LEFT_EDGE 0x10101010UL
+#define RIGHT_EDGE 0x08080808UL
+
+// the first and last rows, where checkers are kinged
+#define KING_ROWS 0xF000000FUL
+
+// the squares of both players' checkers at the start of a game
+#define RED_START 0x00000FFFUL
+#define BLUE_START 0xFFF00000UL
+
+
+// diagonal steps: each of these moves every square in a set one step in
+// its direction, dropping the squares that would leave the board; going
+// "down" is towards row 7.  Depending on the parity of its row, a step
+// down-left from square s lands on s+4 or s+3, and so on.
+
+static uint32_t down_left(uint32_t set)
+{
+  return ((set & EVEN_ROWS) << 4) | ((set & ODD_ROWS & ~LEFT_EDGE) << 3);
+}
+
+static uint32_t down_right(uint32_t set)
+{
+  return ((set & EVEN_ROWS & ~RIGHT_EDGE) << 5) | ((set & ODD_ROWS) << 4);
+}
+
+static uint32_t up_left(uint32_t set)
+{
+  return ((set & EVEN_ROWS) >> 4) | ((set & ODD_ROWS & ~LEFT_EDGE) >> 5);
+}
+
+static uint32_t up_right(uint32_t set)
+{
+  return ((set & EVEN_ROWS & ~RIGHT_EDGE) >> 3) | ((set & ODD_ROWS) >> 4);
+}
+
+
+// square tables: the square a given number of steps away from each square
+// in each direction, or NO_SQUARE off the board, worked out by the compiler
+
+// the tile column and row of a square
+static constexpr int square_x(int square)
+{
+  return (2*(square % 4)) + (((square / 4) + 1) % 2);
+}
+
+static constexpr int square_y(int square)
+{
+  return square / 4;
+}
+
+// the square at tile column x and row y, which must be a dark tile
+static constexpr uint8_t coord_to_square(int x, int y)
+{
+  return (x < 0 || x > 7 || y < 0 || y > 7) ? NO_SQUARE : (4*y) + (x/2);
+}
+
+static constexpr uint8_t step_square(int square, int direction, int steps)
+{
+  return coord_to_square(square_x(square) + 
+			 ((direction == DOWN_RIGHT || direction == UP_RIGHT) ?
+			  steps : -steps),
+			 square_y(square) + 
+			 ((direction == DOWN_LEFT || direction == DOWN_RIGHT) ?
+			  steps : -steps));
+}
+
+#define SQUARE_STEPS(square, steps) { step_square(square, 0, steps), \
+      step_square(square, 1, steps), step_square(square, 2, steps),	\
+      step_square(square, 3, steps) }
+#define ROW_STEPS(row, steps) SQUARE_STEPS(4*(row), steps),		\
+    SQUARE_STEPS(4*(row) + 1, steps), SQUARE_STEPS(4*(row) + 2, steps), \
+    SQUARE_STEPS(4*(row) + 3, steps)
+#define BOARD_STEPS(steps) ROW_STEPS(0, steps), ROW_STEPS(1, steps),	\
+    ROW_STEPS(2, steps), ROW_STEPS(3, steps), ROW_STEPS(4, steps),	\
+    ROW_STEPS(5, steps), ROW_STEPS(6, steps), ROW_STEPS(7, steps)
+
+// the diagonal neighbors of each square
+static const uint8_t NEIGHBOR_SQUARES[NUM_SQUARES][NUM_DIRECTIONS] PROGMEM =
+  { BOARD_STEPS(1) };
+
+// where a jump from each square lands
+static const uint8_t LANDING_SQUARES[NUM_SQUARES][NUM_DIRECTIONS] PROGMEM =
+  { BOARD_STEPS(2) };
+
+// zobrist keys: a random 64-bit key for each kind of checker on each
+// square, worked out by the compiler with splitmix64
+
+static constexpr uint64_t mix_bits(uint64_t z, int shift, uint64_t factor)
+{
+  return (z ^ (z >> shift)) * factor;
+}
+
+static constexpr uint64_t random_key(int index)
+{
+  return mix_bits(mix_bits(mix_bits(0x9E3779B97F4A7C15ULL * (index + 1),
+				    30, 0xBF58476D1CE4E5B9ULL),
+			   27, 0x94D049BB133111EBULL), 31, 1);
+}
+
+// the kinds of checker, indexing the second dimension of ZOBRIST_KEYS
+#define RED_MAN 0
+#define RED_KING 1
+#define BLUE_MAN 2
+#define BLUE_KING 3
+#define NUM_PIECES 4
+
+#define SQUARE_KEYS(square) { random_key(4*(square)),			\
+      random_key(4*(square) + 1), random_key(4*(square) + 2),		\
+      random_key(4*(square) + 3) }
+#define ROW_KEYS(row) SQUARE_KEYS(4*(row)), SQUARE_KEYS(4*(row) + 1),	\
+    SQUARE_KEYS(4*(row) + 2), SQUARE_KEYS(4*(row) + 3)
+
+static const uint64_t ZOBRIST_KEYS[NUM_SQUARES][NUM_PIECES] PROGMEM = {
+  ROW_KEYS(0), ROW_KEYS(1), ROW_KEYS(2), ROW_KEYS(3),
+  ROW_KEYS(4), ROW_KEYS(5), ROW_KEYS(6), ROW_KEYS(7)
+};
+
+// toggled into the key of a position when blue is to move
+#define BLUE_TO_MOVE_KEY random_key(NUM_SQUARES * NUM_PIECES)
+
+static void toggle_key(Board* board, uint8_t square)
+{
+  // adds the checker on a square to the key of the board, or takes it out
+  uint32_t bit = SQUARE_BIT(square);
+  uint8_t piece = ((board->blue & bit) ? BLUE_MAN : RED_MAN) +
+    ((board->kings & bit) ? 1 : 0);
+  uint64_t key;
+
+  memcpy_P(&key, &ZOBRIST_KEYS[square][piece], sizeof(key));
+  board->key ^= key;
+}
+
+uint8_t neighbor_square(uint8_t square, uint8_t direction)
+{
+  // the square one step from a square in the given direction, or NO_SQUARE
+  return pgm_read_byte(&NEIGHBOR_SQUARES[square][direction]);
+}
+
+uint8_t landing_square(uint8_t square, uint8_t direction)
+{
+  // the square two steps from a square in the given direction, or NO_SQUARE
+  return pgm_read_byte(&LANDING_SQUARES[square][direction]);
+}
+
+
+// tile -> coordinate // coordinate -> tile maps
+
+uint8_t* tile_to_coord(uint8_t tile_num)
+{
+  /*
+     maps a tile number to x,y coordinate, where:
+
+     tile_num - the tile index of the tile array
+  */
+  static uint8_t x_y[2];
+  x_y[0] = tile_num % 8;
+  x_y[1] = tile_num / 8;
+  return x_y;
+}
+
+uint8_t tile_to_square(uint8_t tile_num)
+{
+  // maps a tile to its square on the board, or NO_SQUARE for a light tile
+  uint8_t x = tile_num % 8;
+  uint8_t y = tile_num / 8;
+
+  if (tile_num >= NUM_TILES || !((x + y) % 2)){
+    return NO_SQUARE;
+  }
+  return coord_to_square(x, y);
+}
+
+uint8_t square_to_tile(uint8_t square)
+{
+  // maps a square on the board to its tile
+  return (8*square_y(square)) + square_x(square);
+}
+
+
+// board setup
+
+void setup_board(Board* board)
+{
+  // places both players' checkers in their starting positions
+  board->red = RED_START;
+  board->blue = BLUE_START;
+  board->kings = 0;
+  board->key = compute_key(board);
+}
+
+uint64_t compute_key(const Board* board)
+{
+  // works out the zobrist key of the checkers on a board from scratch
+  Board scratch = *board;
+  uint32_t checkers = board->red | board->blue;
+
+  scratch.key = 0;
+  while (checkers){
+    uint8_t square = FIRST_SQUARE(checkers);
+    toggle_key(&scratch, square);
+    checkers &= ~SQUARE_BIT(square);
+  }
+  return scratch.key;
+}
+
+uint64_t position_key(const Board* board, int8_t turn)
+{
+  /*
+    the zobrist key of a position, which is the checkers on the board and
+    the player to move, where:
+
+    board: the checker board
+    turn: the player to move, TURN_RED or TURN_BLUE
+   */
+  return (turn == TURN_BLUE) ? (board->key ^ BLUE_TO_MOVE_KEY) : board->key;
+}
+
+int8_t checker_color(const Board* board, uint8_t square)
+{
+  /*
+    the color of the checker on a square, where:
+
+    board: the checker board
+    square: the square in question, which may be NO_SQUARE
+  */
+  if (square >= NUM_SQUARES){
+    return 0;
+  }
+  if (board->red & SQUARE_BIT(square)){
+    return TURN_RED;
+  }
+  if (board->blue & SQUARE_BIT(square)){
+    return TURN_BLUE;
+  }
+  return 0;
+}
+
+
+// move and jump computing
+
+uint32_t compute_checker_jumps(const Board* board, uint8_t square,
+			       uint8_t djump)
+{
+  /*
+    computes the landing squares of the jumps available to the checker on a
+    square, checking the two forward diagonals (all four if the checker is
+    kinged, or if it is partway through a double jump), where:
+
+    board: the checker board
+    square: the square of the checker in which we are interested
+    djump: whether we are checking for double jumps
+   */
+  uint32_t checker = SQUARE_BIT(square);
+  uint32_t empty = ~(board->red | board->blue);
+  uint32_t opp = (board->red & checker) ? board->blue : board->red;
+  uint8_t all_ways = djump || (board->kings & checker);
+  uint32_t jumps = 0;
+
+  // red's forward directions come first and blue's last, so the directions
+  // to check are a contiguous range
+  uint8_t first = ((board->red & checker) || all_ways) ? DOWN_LEFT : UP_LEFT;
+  uint8_t last = ((board->blue & checker) || all_ways) ? UP_RIGHT : DOWN_RIGHT;
+
+  for (uint8_t direction = first; direction <= last; direction++){
+    // a jump is a step onto an opponent, then a step onto an empty square;
+    // any jump that stays on the board steps over a square on the board
+    uint8_t landing = landing_square(square, direction);
+    if (landing != NO_SQUARE && 
+	(opp & SQUARE_BIT(neighbor_square(square, direction))) &&
+	(empty & SQUARE_BIT(landing))){
+      jumps |= SQUARE_BIT(landing);
+    }
+  }
+  return jumps;
+}
+
+uint32_t compute_checker_moves(const Board* board, uint8_t square)
+{
+  /*
+    computes the squares the checker on a square can move to, checking the
+    two forward diagonals (all four if the checker is kinged), where:
+
+    board: the checker board
+    square: the square of the checker in which we are interested
+  */
+  uint32_t checker = SQUARE_BIT(square);
+  uint32_t empty = ~(board->red | board->blue);
+  uint8_t kinged = (board->kings & checker) != 0;
+  uint32_t moves = 0;
+
+  uint8_t first = ((board->red & checker) || kinged) ? DOWN_LEFT : UP_LEFT;
+  uint8_t last = ((board->blue & checker) || kinged) ? UP_RIGHT : DOWN_RIGHT;
+
+  for (uint8_t direction = first; direction <= last; direction++){
+    uint8_t neighbor = neighbor_square(square, direction);
+    if (neighbor != NO_SQUARE && (empty & SQUARE_BIT(neighbor))){
+      moves |= SQUARE_BIT(neighbor);
+    }
+  }
+  return moves;
+}
+
+uint8_t compute_moves(const Board* board, int8_t turn,
+		      uint32_t* movers, uint32_t* jumpers)
+{
+  /*
+    computes which of a player's checkers can move and which can jump, for
+    all of them at once, where:
+
+    board: the checker board
+    turn: the player we are computing for, TURN_RED or TURN_BLUE
+    movers: set to the squares of the checkers with a move
+    jumpers: set to the squares of the checkers with a jump
+
+    this runs each step backwards from the target squares: a checker can
+    move down-left if the square down-left of it is empty, which is to say
+    it sits up-right of an empty square
+   */
+  uint32_t empty = ~(board->red | board->blue);
+  uint32_t own = (turn == TURN_RED) ? board->red : board->blue;
+  uint32_t opp = (turn == TURN_RED) ? board->blue : board->red;
+  uint32_t down = (turn == TURN_RED) ? own : (own & board->kings);
+  uint32_t up = (turn == TURN_BLUE) ? own : (own & board->kings);
+
+  *movers = (down & (up_right(empty) | up_left(empty))) |
+    (up & (down_right(empty) | down_left(empty)));
+
+  *jumpers = (down & (up_right(up_right(empty) & opp) |
+		      up_left(up_left(empty) & opp))) |
+    (up & (down_right(down_right(empty) & opp) |
+	   down_left(down_left(empty) & opp)));
+
+  return (*jumpers == 0); // no force jumps unless someone can jump
+}
+
+
+// move state
+
+void init_move_state(const Board* board, MoveState* state)
+{
+  /*
+    computes the moves and jumps of both players from scratch, and marks
+    every square dirty, where:
+
+    board: the checker board
+    state: the move state to fill in
+   */
+  compute_moves(board, TURN_RED, &state->movers[PLAYER_INDEX(TURN_RED)],
+		&state->jumpers[PLAYER_INDEX(TURN_RED)]);
+  compute_moves(board, TURN_BLUE, &state->movers[PLAYER_INDEX(TURN_BLUE)],
+		&state->jumpers[PLAYER_INDEX(TURN_BLUE)]);
+  state->dirty = ~((uint32_t) 0);
+}
+
+void update_move_state(const Board* board, MoveState* state,
+		       uint32_t changed)
+{
+  /*
+    brings the moves and jumps of both players up to date after the squares
+    in changed have been emptied or filled, and marks those squares dirty,
+    where:
+
+    board: the checker board, after the change
+    state: the move state, as it was before the change
+    changed: the squares whose contents changed
+
+    both players are recomputed whole: compute_moves works on every checker
+    at once, so masking it down to the checkers near the change costs as
+    much as it saves
+   */
+  state->dirty |= changed;
+  compute_moves(board, TURN_RED, &state->movers[PLAYER_INDEX(TURN_RED)],
+		&state->jumpers[PLAYER_INDEX(TURN_RED)]);
+  compute_moves(board, TURN_BLUE, &state->movers[PLAYER_INDEX(TURN_BLUE)],
+		&state->jumpers[PLAYER_INDEX(TURN_BLUE)]);
+}
+
+
+// capture sequences
+
+static uint8_t add_capture(Move* list, uint8_t count, const Move* move)
+{
+  /*
+    appends a complete capture sequence to a list, unless an equal one (the
+    same checkers taken by another route) is already there or the list is
+    full, and returns the new length of the list
+   */
+  for (uint8_t i = 0; i < count; i++){
+    if (list[i].from == move->from && list[i].to == move->to &&
+	list[i].captured == move->captured){
+      return count;
+    }
+  }
+  if (count < MAX_MOVES){
+    list[count++] = *move;
+  }
+  return count;
+}
+
+static uint8_t extend_capture(uint32_t occupied, uint32_t opp,
+			      uint8_t first, uint8_t last, const Move* move,
+			      Move* list, uint8_t count)
+{
+  /*
+    extends a capture sequence by every hop available from where it has got
+    to, adding each sequence to the list once it can go no further, where:
+
+    occupied: the squares holding a checker, not counting the one jumping
+      or those already taken
+    opp: the squares holding an opponent's checker still on the board
+    first, last: the range of directions the next hop may take
+    move: the sequence so far
+    list, count: the list of sequences found, and its length
+
+    returns the new length of the list
+   */
+  uint8_t extended = 0;
+
+  // landing on the first or last row ends the sequence
+  if (!move->captured || !(SQUARE_BIT(move->to) & KING_ROWS)){
+    for (uint8_t direction = first; direction <= last; direction++){
+      uint8_t landing = landing_square(move->to, direction);
+      uint32_t over = SQUARE_BIT(neighbor_square(move->to, direction));
+
+      if (landing != NO_SQUARE && (opp & over) &&
+	  !(occupied & SQUARE_BIT(landing))){
+	// taken checkers leave the board at once, and after the first hop
+	// the checker may jump in any direction
+	Move next = { move->from, landing, move->captured | over };
+	count = extend_capture(occupied & ~over, opp & ~over, DOWN_LEFT,
+			       UP_RIGHT, &next, list, count);
+	extended = 1;
+      }
+    }
+  }
+  if (!extended && move->captured){
+    count = add_capture(list, count, move);
+  }
+  return count;
+}
+
+uint8_t generate_checker_captures(const Board* board, uint8_t square,
+				  uint8_t djump, Move* list, uint8_t count)
+{
+  /*
+    adds every complete capture sequence of the checker on a square to a
+    list, where:
+
+    board: the checker board
+    square: the square of the checker in which we are interested
+    djump: whether the checker is partway through a double jump, and so
+      may jump in any direction
+    list, count: the list to add to, and its length so far
+   */
+  uint32_t checker = SQUARE_BIT(square);
+  uint32_t opp = (board->red & checker) ? board->blue : board->red;
+  uint8_t all_ways = djump || (board->kings & checker);
+  uint8_t first = ((board->red & checker) || all_ways) ? DOWN_LEFT : UP_LEFT;
+  uint8_t last = ((board->blue & checker) || all_ways) ? UP_RIGHT : DOWN_RIGHT;
+  Move start = { square, square, 0 };
+
+  return extend_capture((board->red | board->blue) & ~checker, opp, first,
+			last, &start, list, count);
+}
+
+uint8_t generate_captures(const Board* board, int8_t turn, Move* list)
+{
+  /*
+    lists every complete capture sequence of a player, where:
+
+    board: the checker board
+    turn: the player we are computing for, TURN_RED or TURN_BLUE
+    list: filled with the sequences, at most MAX_MOVES of them
+   */
+  uint32_t movers;
+  uint32_t jumpers;
+  uint8_t count = 0;
+
+  compute_moves(board, turn, &movers, &jumpers);
+  while (jumpers){
+    uint8_t square = FIRST_SQUARE(jumpers);
+    count = generate_checker_captures(board, square, 0, list, count);
+    jumpers &= ~SQUARE_BIT(square);
+  }
+  return count;
+}
+
+// move lists
+
+static uint8_t add_steps(uint32_t targets, uint8_t direction, Move* list,
+			 uint8_t count)
+{
+  /*
+    appends the simple moves onto a set of empty squares, each made by a
+    checker one step back from its target, against direction, and returns
+    the new length of the list
+   */
+  uint8_t back = (NUM_DIRECTIONS - 1) - direction; // the opposite direction
+
+  while (targets){
+    uint8_t to = FIRST_SQUARE(targets);
+    list[count].from = neighbor_square(to, back);
+    list[count].to = to;
+    list[count].captured = 0;
+    count++;
+    targets &= ~SQUARE_BIT(to);
+  }
+  return count;
+}
+
+uint8_t list_moves(const Board* board, int8_t turn, Move* moves,
+		   uint8_t* count)
+{
+  /*
+    lists every legal move of a player: their complete capture sequences if
+    any checker can jump, since jumps are forced, or else their simple
+    moves, where:
+
+    board: the checker board
+    turn: the player we are computing for, TURN_RED or TURN_BLUE
+    moves: filled with the moves, at most MAX_MOVES of them
+    count: set to the number of moves
+   */
+  uint32_t movers;
+  uint32_t jumpers;
+
+  if (!compute_moves(board, turn, &movers, &jumpers)){
+    *count = generate_captures(board, turn, moves);
+    return 0;
+  }
+
+  // the steps forward are taken by every checker that can move, and the
+  // steps back only by kings; each of a checker's steps is to an empty
+  // square, so no two of these can be the same move
+  uint32_t empty = ~(board->red | board->blue);
+  uint32_t down = (turn == TURN_RED) ? movers : (movers & board->kings);
+  uint32_t up = (turn == TURN_BLUE) ? movers : (movers & board->kings);
+
+  *count = add_steps(down_left(down) & empty, DOWN_LEFT, moves, 0);
+  *count = add_steps(down_right(down) & empty, DOWN_RIGHT, moves, *count);
+  *count = add_steps(up_left(up) & empty, UP_LEFT, moves, *count);
+  *count = add_steps(up_right(up) & empty, UP_RIGHT, moves, *count);
+  return 1;
+}
+
+uint8_t generate_moves(const Board* board, int8_t turn, MoveList* list)
+{
+  /*
+    lists every legal move of a player into a move list (see list_moves),
+    where:
+
+    board: the checker board
+    turn: the player we are computing for, TURN_RED or TURN_BLUE
+    list: filled with the moves and their count
+   */
+  return list_moves(board, turn, list->moves, &list->count);
+}
+
+uint32_t move_destinations(const MoveList* list, uint8_t square)
+{
+  /*
+    the squares the moves in a list take the checker on a square to, where:
+
+    list: the move list
+    square: the square of the checker in which we are interested
+   */
+  uint32_t destinations = 0;
+
+  for (uint8_t i = 0; i < list->count; i++){
+    if (list->moves[i].from == square){
+      destinations |= SQUARE_BIT(list->moves[i].to);
+    }
+  }
+  return destinations;
+}
+
+static uint8_t trace_capture(uint32_t occupied, uint32_t remaining,
+			     uint8_t square, uint8_t first, uint8_t last,
+			     uint8_t to, uint8_t* path, uint8_t hops)
+{
+  /*
+    searches for a route from square to to taking exactly the checkers in
+    remaining, writing its landing squares into path from hops on, and
+    returns the total number of hops, or 0 if there is no such route
+   */
+  if (!remaining){
+    return (square == to) ? hops : 0;
+  }
+  if (hops && (SQUARE_BIT(square) & KING_ROWS)){
+    return 0;
+  }
+  for (uint8_t direction = first; direction <= last; direction++){
+    uint8_t landing = landing_square(square, direction);
+    uint32_t over = SQUARE_BIT(neighbor_square(square, direction));
+
+    if (landing != NO_SQUARE && (remaining & over) &&
+	!(occupied & SQUARE_BIT(landing))){
+      path[hops] = landing;
+      uint8_t found = trace_capture(occupied & ~over, remaining & ~over,
+				    landing, DOWN_LEFT, UP_RIGHT, to, path,
+				    hops + 1);
+      if (found){
+	return found;
+      }
+    }
+  }
+  return 0;
+}
+
+uint8_t capture_path(const Board* board, const Move* move, uint8_t* path)
+{
+  /*
+    works out the squares a capture sequence lands on, in order, where:
+
+    board: the checker board, before the sequence is played
+    move: the capture sequence
+    path: filled with the landing squares, at most CHECKERS_PER_SIDE
+   */
+  uint32_t checker = SQUARE_BIT(move->from);
+  uint8_t kinged = (board->kings & checker) != 0;
+  uint8_t first = ((board->red & checker) || kinged) ? DOWN_LEFT : UP_LEFT;
+  uint8_t last = ((board->blue & checker) || kinged) ? UP_RIGHT : DOWN_RIGHT;
+
+  return trace_capture((board->red | board->blue) & ~checker, move->captured,
+		       move->from, first, last, move->to, path, 0);
+}
+
+
+// move & jump verification
+
+uint8_t selection_matches_move(uint8_t selection, uint32_t destinations)
+{
+  /*
+    determines whether the tile selected is one of a checker's destinations,
+    where:
+
+    selection: the tile selected
+    destinations: the squares the checker can move or jump to
+   */
+  uint8_t square = tile_to_square(selection);
+
+  if (square == NO_SQUARE){
+    return 0;
+  }
+  return (destinations & SQUARE_BIT(square)) != 0;
+}
+
+uint8_t player_has_move(const Board* board, int8_t turn)
+{
+  // determines whether the given player has a checker with a move or a jump
+  uint32_t movers;
+  uint32_t jumpers;
+
+  compute_moves(board, turn, &movers, &jumpers);
+  return (movers | jumpers) != 0;
+}
+
+
+// checker jumping & movement
+
+uint8_t move_checker(Board* board, uint8_t active_square,
+		     uint8_t destination_square)
+{
+  /*
+    move a checker from its current position to new position at destination
+    square, kinging it if it lands on the first or last row; we don't have
+    to worry about whether this move is valid, since this is already checked
+    before calling this procedure, where:
+
+    board: the checker board
+    active_square: the square of the checker being moved
+    destination_square: the square to which the checker is moving
+
+   */
+  uint32_t from = SQUARE_BIT(active_square);
+  uint32_t to = SQUARE_BIT(destination_square);
+  uint8_t kinged = 0;
+
+  toggle_key(board, active_square);
+  if (board->red & from){
+    board->red ^= from | to;
+  }
+  else {
+    board->blue ^= from | to;
+  }
+
+  if (board->kings & from){
+    board->kings ^= from | to;
+  }
+  else if (to & KING_ROWS){
+    // king the checker if it moved into the 0th or 7th row
+    board->kings |= to;
+    kinged = 1;
+  }
+  toggle_key(board, destination_square);
+  return kinged;
+}
+
+
+uint8_t jump_checker(Board* board, uint8_t active_square,
+		     uint8_t destination_square)
+{
+  /*
+     jump a checker to the destination square, taking the checker it jumps
+     off the board, and return the square of the checker just jumped; we
+     don't need to worry about whether this jump is valid, since this is
+     checked in another procedure, where:
+
+     board: the checker board
+     active_square: the square from which the checker is jumping
+     destination_square: the square to which to checker is jumping
+   */
+
+  // the square jumped is the one between the active and destination squares
+  uint8_t rm_square = NO_SQUARE;
+  for (uint8_t direction = 0; direction < NUM_DIRECTIONS; direction++){
+    if (landing_square(active_square, direction) == destination_square){
+      rm_square = neighbor_square(active_square, direction);
+    }
+  }
+  uint32_t captured = ~SQUARE_BIT(rm_square);
+
+  toggle_key(board, rm_square);
+  board->red &= captured;
+  board->blue &= captured;
+  board->kings &= captured;
+
+  move_checker(board, active_square, destination_square);
+  return rm_square;
+}
+
+
+// make & unmake
+
+void make_move(Board* board, const Move* move, MoveRecord* record)
+{
+  /*
+    plays a whole move, taking the checkers it captures off the board and
+    kinging the checker if it finishes on the first or last row, and fills
+    in the record needed to take it back, where:
+
+    board: the checker board
+    move: the move to play, simple or a complete capture sequence
+    record: filled in for unmake_move
+   */
+  uint32_t from = SQUARE_BIT(move->from);
+  uint32_t to = SQUARE_BIT(move->to);
+
+  record->move = *move;
+  record->captured_kings = board->kings & move->captured;
+  record->promoted = !(board->kings & from) && (to & KING_ROWS);
+  record->irreversible = move->captured || !(board->kings & from);
+
+  uint32_t captured = move->captured;
+  while (captured){
+    uint8_t square = FIRST_SQUARE(captured);
+    toggle_key(board, square);
+    captured &= ~SQUARE_BIT(square);
+  }
+  toggle_key(board, move->from);
+
+  board->red &= ~move->captured;
+  board->blue &= ~move->captured;
+  board->kings &= ~move->captured;
+
+  // a capture sequence may finish where it started, so clear then set
+  if (board->red & from){
+    board->red = (board->red & ~from) | to;
+  }
+  else {
+    board->blue = (board->blue & ~from) | to;
+  }
+  if ((board->kings & from) || record->promoted){
+    board->kings = (board->kings & ~from) | to;
+  }
+  toggle_key(board, move->to);
+}
+
+void unmake_move(Board* board, const MoveRecord* record)
+{
+  /*
+    takes back a move played by make_move, putting the board back exactly
+    as it was, where:
+
+    board: the checker board, as make_move left it
+    record: the record make_move filled in
+   */
+  uint32_t from = SQUARE_BIT(record->move.from);
+  uint32_t to = SQUARE_BIT(record->move.to);
+
+  toggle_key(board, record->move.to);
+  if (record->promoted){
+    board->kings &= ~to;
+  }
+  if (board->kings & to){
+    board->kings = (board->kings & ~to) | from;
+  }
+
+  if (board->red & to){
+    board->red = (board->red & ~to) | from;
+    board->blue |= record->move.captured;
+  }
+  else {
+    board->blue = (board->blue & ~to) | from;
+    board->red |= record->move.captured;
+  }
+  board->kings |= record->captured_kings;
+
+  toggle_key(board, record->move.from);
+  uint32_t captured = record->move.captured;
+  while (captured){
+    uint8_t square = FIRST_SQUARE(captured);
+    toggle_key(board, square);
+    captured &= ~SQUARE_BIT(square);
+  }
+}
+
+void clear_moves(MoveStack* stack)
+{
+  // empties a move stack, forgetting the moves made and undone
+  stack->made = 0;
+  stack->top = 0;
+}
+
+void push_move(MoveStack* stack, Board* board, const Move* move)
+{
+  /*
+    plays a move and pushes its record, forgetting any moves undone; if the
+    stack is full the oldest record is dropped, where:
+
+    stack: the move stack
+    board: the checker board
+    move: the move to play
+   */
+  if (stack->made == MAX_HISTORY){
+    memmove(&stack->records[0], &stack->records[1],
+	    (MAX_HISTORY - 1) * sizeof(MoveRecord));
+    stack->made--;
+  }
+  make_move(board, move, &stack->records[stack->made]);
+  stack->made++;
+  stack->top = stack->made;
+}
+
+const MoveRecord* undo_move(MoveStack* stack, Board* board)
+{
+  /*
+    takes back the last move made, keeping it to be redone, where:
+
+    stack: the move stack
+    board: the checker board
+
+    returns the record of the move taken back, or NULL if there is none
+   */
+  if (!stack->made){
+    return NULL;
+  }
+  stack->made--;
+  unmake_move(board, &stack->records[stack->made]);
+  return &stack->records[stack->made];
+}
+
+const MoveRecord* redo_move(MoveStack* stack, Board* board)
+{
+  /*
+    plays again the last move taken back, where:
+
+    stack: the move stack
+    board: the checker board
+
+    returns the record of the move played, or NULL if there is none
+   */
+  if (stack->made == stack->top){
+    return NULL;
+  }
+  MoveRecord* record = &stack->records[stack->made];
+  make_move(board, &record->move, record);
+  stack->made++;
+  return record;
+}
+
+
+// repetition & draws
+
+void clear_keys(KeyHistory* history)
+{
+  // empties a key history, as at the start of a game
+  memset(history, 0, sizeof(KeyHistory));
+}
+
+void push_key(KeyHistory* history, uint64_t key, uint8_t irreversible)
+{
+  /*
+    records the key of a position just reached, overwriting the oldest key
+    once the ring is full, where:
+
+    history: the key history
+    key: the key of the position, from position_key
+    irreversible: whether the move that reached it can never be undone by
+      the players (a capture, or a man moving), so that no earlier position
+      can come again
+   */
+  uint8_t index = history->head & (KEY_HISTORY - 1);
+
+  if (history->count == KEY_HISTORY){
+    history->filter[history->keys[index] & (KEY_FILTER - 1)]--;
+  }
+  else {
+    history->count++;
+  }
+
+  uint8_t last = (history->head - 1) & (KEY_HISTORY - 1);
+  history->reversible[index] =
+    (irreversible || history->count == 1) ? 0 :
+    (history->reversible[last] < 255) ? history->reversible[last] + 1 : 255;
+  history->keys[index] = key;
+  history->filter[key & (KEY_FILTER - 1)]++;
+  history->head++;
+}
+
+void pop_key(KeyHistory* history)
+{
+  // forgets the key of the last position recorded, as its move is unmade
+  if (!history->count){
+    return;
+  }
+  history->head--;
+  history->count--;
+  history->filter[history->keys[history->head & (KEY_HISTORY - 1)] &
+		  (KEY_FILTER - 1)]--;
+}
+
+uint8_t position_repeats(const KeyHistory* history)
+{
+  /*
+    counts how many times the last position recorded was reached before,
+    looking back only as far as the last irreversible move, where:
+
+    history: the key history
+   */
+  if (!history->count){
+    return 0;
+  }
+  uint8_t last = (history->head - 1) & (KEY_HISTORY - 1);
+  uint64_t key = history->keys[last];
+
+  // the filter counts the keys in the ring by their low bits, so a lone
+  // entry means the position is new without looking any further
+  if (history->filter[key & (KEY_FILTER - 1)] < 2){
+    return 0;
+  }
+
+  // the same player is to move only every other position
+  uint8_t back = history->reversible[last];
+  uint8_t repeats = 0;
+  if (back > history->count - 1){
+    back = history->count - 1;
+  }
+  for (uint8_t plies = 2; plies <= back; plies += 2){
+    if (history->keys[(history->head - 1 - plies) & (KEY_HISTORY - 1)] ==
+	key){
+      repeats++;
+    }
+  }
+  return repeats;
+}
+
+uint8_t position_drawn(const KeyHistory* history)
+{
+  /*
+    determines whether the game is drawn at the last position recorded:
+    when it has come up for the third time, or when DRAW_PLIES moves have
+    been played without a capture or a man moving, where:
+
+    history: the key history
+   */
+  if (!history->count){
+    return 0;
+  }
+  uint8_t last = (history->head - 1) & (KEY_HISTORY - 1);
+
+  return history->reversible[last] >= DRAW_PLIES ||
+    position_repeats(history) >= 2;
+}
@@ -0,0 +1,552 @@
+#ifndef _RULES_H
+#define _RULES_H
+
+/*
+  The rules of the game, kept free of the TFT, SD card and Serial so that
+  the same code builds for the mega2560 sketch and on the host (see host/).
+
+  The board is stored as bitboards over the 32 dark squares, the only ones
+  a checker can ever stand on.  Square s is on row s/4 (the tile row), and
+  squares count left to right along each row:
+
+         col: 0  1  2  3  4  5  6  7
+     row 0:   .  0  .  1  .  2  .  3      red starts on squares 0-11
+     row 1:   4  .  5  .  6  .  7  .
+     row 2:   .  8  .  9  . 10  . 11
+       ...
+     row 7:  28  . 29  . 30  . 31  .      blue starts on squares 20-31
+
+  Red moves down the board (towards row 7) and blue moves up.
+*/
+
+#include <stdint.h>
+
+// checkers settings
+#define CHECKERS_PER_SIDE 12 // 12 pieces per side, as per game rules
+#define NUM_TILES 64 // standard 8x8 board
+#define NUM_SQUARES 32 // the dark tiles, which are the only ones played on
+
+// turn mapping; also the colors returned by checker_color
+#define TURN_RED 1
+#define TURN_BLUE -1
+
+// square settings
+#define NO_SQUARE 32 // a light tile, or off the board
+
+// diagonal directions, as seen on the screen; red's checkers move down the
+// board and blue's move up it, so each color's forward directions are a
+// contiguous pair
+#define DOWN_LEFT 0
+#define DOWN_RIGHT 1
+#define UP_LEFT 2
+#define UP_RIGHT 3
+#define NUM_DIRECTIONS 4
+
+// the set containing only the given square
+#define SQUARE_BIT(square) (((uint32_t) 1) << (square))
+
+// the lowest square in a non-empty set of squares
+#define FIRST_SQUARE(set) ((uint8_t) __builtin_ctzl(set))
+
+/*
+  Struct for the checker board, where:
+
+  red:   the squares holding a red checker
+  blue:  the squares holding a blue checker
+  kings: the squares holding a kinged checker, of either color
+  key:   the zobrist key of the checkers, kept up to date by every function
+         that moves them (see position_key)
+
+  for a total of 20 bytes, against 128 for the old Tile[64] plus 312 for
+  the two Checker[12] arrays it replaces
+*/
+typedef struct {
+  uint32_t red;
+  uint32_t blue;
+  uint32_t kings;
+  uint64_t key;
+} Board;
+
+// the index of a player in the arrays of MoveState
+#define PLAYER_INDEX(turn) ((turn) == TURN_RED ? 0 : 1)
+
+/*
+  Struct for the moves of both players, kept up to date as checkers move
+  and jump (see update_move_state), where:
+
+  movers:  for each player, the squares of their checkers that can move
+  jumpers: for each player, the squares of their checkers that can jump
+  dirty:   the squares whose contents have changed since the renderer last
+           cleared it, and so need redrawing
+
+  the player arrays are indexed by PLAYER_INDEX
+*/
+typedef struct {
+  uint32_t movers[2];
+  uint32_t jumpers[2];
+  uint32_t dirty;
+} MoveState;
+
+// the most moves a move list holds; a side has at most 12 checkers with 4
+// moves each, and far fewer distinct capture sequences in any real game
+#define MAX_MOVES (CHECKERS_PER_SIDE * NUM_DIRECTIONS)
+
+/*
+  Struct for a whole move, a simple move or a complete capture sequence,
+  where:
+
+  from:     the square the checker starts on
+  to:       the square it finishes on
+  captured: the squares of the checkers it takes, if any
+
+  which is all it takes to play the move; the squares landed on along the
+  way can be worked out with capture_path
+*/
+typedef struct {
+  uint8_t from;
+  uint8_t to;
+  uint32_t captured;
+} Move;
+
+/*
+  Struct for the legal moves of the player to move, listed in one array
+  shared by all their checkers, where:
+
+  moves: the moves, simple moves or complete capture sequences
+  count: the number of moves listed, 0 if the player cannot move
+*/
+typedef struct {
+  Move moves[MAX_MOVES];
+  uint8_t count;
+} MoveList;
+
+/*
+  Struct for what it takes to take a move back exactly, where:
+
+  move:           the move played
+  captured_kings: which of the checkers it captured were kinged
+  promoted:       whether it kinged the checker that moved
+  irreversible:   whether it captured or moved a man, so that no position
+                  before it can come again
+*/
+typedef struct {
+  Move move;
+  uint32_t captured_kings;
+  uint8_t promoted;
+  uint8_t irreversible;
+} MoveRecord;
+
+// the most moves a move stack remembers, which bounds the depth of a
+// search and how far back a game can be undone
+#define MAX_HISTORY 64
+
+/*
+  Struct for a fixed-capacity stack of moves that can be taken back and
+  played again, where:
+
+  records: the records of the moves, oldest first
+  made:    the number of moves made and not taken back
+  top:     the number of records kept, counting those taken back, which
+           can be redone until another move is pushed
+*/
+typedef struct {
+  MoveRecord records[MAX_HISTORY];
+  uint8_t made;
+  uint8_t top;
+} MoveStack;
+
+// the number of recent position keys kept, and of counters in the filter
+// over them; both must be powers of two
+#define KEY_HISTORY 32
+#define KEY_FILTER 64
+
+// the moves without a capture or a man moving after which a game is drawn,
+// 40 for each player
+#define DRAW_PLIES 80
+
+/*
+  Struct for a ring buffer of the keys of the positions reached recently,
+  for spotting repetitions and draws, where:
+
+  keys:       the keys, the newest at head - 1
+  reversible: for each key, the moves played since the last irreversible
+              one, up to 255
+  filter:     how many of the keys have each value of their low bits
+  count:      the number of keys in the ring
+  head:       where the next key goes, counting up without wrapping
+*/
+typedef struct {
+  uint64_t keys[KEY_HISTORY];
+  uint8_t reversible[KEY_HISTORY];
+  uint8_t filter[KEY_FILTER];
+  uint8_t count;
+  uint8_t head;
+} KeyHistory;
+
+
+/*
+   maps a tile number to x,y coordinate, where:
+
+   tile_num - the tile index of the tile array
+
+   the returned array is overwritten by the next call
+*/
+uint8_t* tile_to_coord(uint8_t tile_num);
+
+
+// maps a tile to its square on the board, or NO_SQUARE for a light tile
+uint8_t tile_to_square(uint8_t tile_num);
+
+
+// maps a square on the board to its tile
+uint8_t square_to_tile(uint8_t square);
+
+
+/*
+  the square one step from a square in the given direction, read from a
+  table in flash, where:
+
+  square: the square we are stepping from
+  direction: DOWN_LEFT, DOWN_RIGHT, UP_LEFT or UP_RIGHT
+
+  returns NO_SQUARE if the step leaves the board
+*/
+uint8_t neighbor_square(uint8_t square, uint8_t direction);
+
+
+/*
+  the square two steps from a square in the given direction, which is
+  where a jump that way lands, read from a table in flash, where:
+
+  square: the square we are jumping from
+  direction: DOWN_LEFT, DOWN_RIGHT, UP_LEFT or UP_RIGHT
+
+  returns NO_SQUARE if the jump would leave the board
+*/
+uint8_t landing_square(uint8_t square, uint8_t direction);
+
+
+// places both players' checkers in their starting positions
+void setup_board(Board* board);
+
+
+// works out the zobrist key of the checkers on a board from scratch
+uint64_t compute_key(const Board* board);
+
+
+/*
+  the zobrist key of a position, which is the checkers on the board and the
+  player to move, where:
+
+  board: the checker board
+  turn: the player to move, TURN_RED or TURN_BLUE
+*/
+uint64_t position_key(const Board* board, int8_t turn);
+
+
+/*
+  the color of the checker on a square, where:
+
+  board: the checker board
+  square: the square in question, which may be NO_SQUARE
+
+  returns TURN_RED, TURN_BLUE, or 0 for an empty square
+*/
+int8_t checker_color(const Board* board, uint8_t square);
+
+
+/*
+  computes the landing squares of the jumps available to the checker on a
+  square, checking the two forward diagonals (all four if the checker is
+  kinged, or if it is partway through a double jump), where:
+
+  board: the checker board
+  square: the square of the checker in which we are interested
+  djump: whether we are checking for double jumps
+
+  returns the set of landing squares
+*/
+uint32_t compute_checker_jumps(const Board* board, uint8_t square,
+			       uint8_t djump);
+
+
+/*
+  computes the squares the checker on a square can move to, checking the
+  two forward diagonals (all four if the checker is kinged), where:
+
+  board: the checker board
+  square: the square of the checker in which we are interested
+
+  returns the set of destination squares
+*/
+uint32_t compute_checker_moves(const Board* board, uint8_t square);
+
+
+/*
+  computes which of a player's checkers can move and which can jump, for
+  all of them at once, where:
+
+  board: the checker board
+  turn: the player we are computing for, TURN_RED or TURN_BLUE
+  movers: set to the squares of the checkers with a move
+  jumpers: set to the squares of the checkers with a jump
+
+  returns 1 if none of the checkers are forced to jump
+*/
+uint8_t compute_moves(const Board* board, int8_t turn,
+		      uint32_t* movers, uint32_t* jumpers);
+
+
+/*
+  computes the moves and jumps of both players from scratch, and marks
+  every square dirty, where:
+
+  board: the checker board
+  state: the move state to fill in
+*/
+void init_move_state(const Board* board, MoveState* state);
+
+
+/*
+  brings the moves and jumps of both players up to date after the squares
+  in changed have been emptied or filled (by move_checker or jump_checker),
+  and marks the changed squares dirty, where:
+
+  board: the checker board, after the change
+  state: the move state, as it was before the change
+  changed: the squares whose contents changed
+*/
+void update_move_state(const Board* board, MoveState* state,
+		       uint32_t changed);
+
+
+/*
+  adds every complete capture sequence of the checker on a square to a
+  list, following each chain of jumps until the checker can jump no more or
+  lands on the first or last row, without allocating, where:
+
+  board: the checker board
+  square: the square of the checker in which we are interested
+  djump: whether the checker is partway through a double jump, and so may
+    jump in any direction
+  list: the list to add to, which holds at most MAX_MOVES
+  count: the number of sequences already in the list
+
+  sequences taking the same checkers to the same square by different routes
+  are listed once; returns the new number of sequences in the list
+*/
+uint8_t generate_checker_captures(const Board* board, uint8_t square,
+				  uint8_t djump, Move* list, uint8_t count);
+
+
+/*
+  lists every complete capture sequence of a player (see
+  generate_checker_captures), where:
+
+  board: the checker board
+  turn: the player we are computing for, TURN_RED or TURN_BLUE
+  list: filled with the sequences, at most MAX_MOVES of them
+
+  returns the number of sequences listed
+*/
+uint8_t generate_captures(const Board* board, int8_t turn, Move* list);
+
+
+/*
+  lists every legal move of a player: their complete capture sequences if
+  any checker can jump, since jumps are forced, or else their simple moves,
+  where:
+
+  board: the checker board
+  turn: the player we are computing for, TURN_RED or TURN_BLUE
+  moves: filled with the moves, which needs room for MAX_MOVES of them
+  count: set to the number of moves
+
+  returns 1 if none of the moves are forced jumps (as compute_moves)
+*/
+uint8_t list_moves(const Board* board, int8_t turn, Move* moves,
+		   uint8_t* count);
+
+
+/*
+  lists every legal move of a player into one compact list: their complete
+  capture sequences if any checker can jump, since jumps are forced, or
+  else their simple moves, where:
+
+  board: the checker board
+  turn: the player we are computing for, TURN_RED or TURN_BLUE
+  list: filled with the moves and their count
+
+  returns 1 if none of the moves are forced jumps (as compute_moves)
+*/
+uint8_t generate_moves(const Board* board, int8_t turn, MoveList* list);
+
+
+/*
+  the squares the moves in a list take the checker on a square to, which
+  for a capture sequence is where it finishes, where:
+
+  list: the move list
+  square: the square of the checker in which we are interested
+*/
+uint32_t move_destinations(const MoveList* list, uint8_t square);
+
+
+/*
+  works out the squares a capture sequence lands on, in order, so that the
+  whole chain can be shown or played hop by hop, where:
+
+  board: the checker board, before the sequence is played
+  move: the capture sequence
+  path: filled with the landing squares, at most CHECKERS_PER_SIDE of them
+
+  returns the number of hops, the last landing on move->to
+*/
+uint8_t capture_path(const Board* board, const Move* move, uint8_t* path);
+
+
+/*
+  determines whether the tile selected is one of a checker's destinations,
+  where:
+
+  selection: the tile selected
+  destinations: the squares the checker can move or jump to
+*/
+uint8_t selection_matches_move(uint8_t selection, uint32_t destinations);
+
+
+// determines whether the given player has a checker with a move or a jump
+uint8_t player_has_move(const Board* board, int8_t turn);
+
+
+
+/*
+  move a checker from its current position to new position at destination
+  square, kinging it if it lands on the first or last row; we don't have to
+  worry about whether this move is valid, since this is already checked
+  before calling this procedure, where:
+
+  board: the checker board
+  active_square: the square of the checker being moved
+  destination_square: the square to which the checker is moving
+
+  returns 1 if the checker was kinged by the move
+*/
+uint8_t move_checker(Board* board, uint8_t active_square,
+		     uint8_t destination_square);
+
+
+
+/*
+   jump a checker to the destination square, taking the checker it jumps
+   off the board, and return the square of the checker just jumped; we
+   don't need to worry about whether this jump is valid, since this is
+   checked in another procedure, where:
+
+   board: the checker board
+   active_square: the square from which the checker is jumping
+   destination_square: the square to which to checker is jumping
+*/
+uint8_t jump_checker(Board* board, uint8_t active_square,
+		     uint8_t destination_square);
+
+
+/*
+  plays a whole move, taking the checkers it captures off the board and
+  kinging the checker if it finishes on the first or last row, where:
+
+  board: the checker board
+  move: the move to play, simple or a complete capture sequence
+  record: filled in with what unmake_move needs to take it back
+*/
+void make_move(Board* board, const Move* move, MoveRecord* record);
+
+
+/*
+  takes back a move played by make_move, putting the board back exactly as
+  it was, where:
+
+  board: the checker board, as make_move left it
+  record: the record make_move filled in
+*/
+void unmake_move(Board* board, const MoveRecord* record);
+
+
+// empties a move stack, forgetting the moves made and undone
+void clear_moves(MoveStack* stack);
+
+
+/*
+  plays a move and pushes its record, forgetting any moves undone; if the
+  stack is full the oldest record is dropped, where:
+
+  stack: the move stack
+  board: the checker board
+  move: the move to play
+*/
+void push_move(MoveStack* stack, Board* board, const Move* move);
+
+
+/*
+  takes back the last move made, keeping it to be redone, where:
+
+  stack: the move stack
+  board: the checker board
+
+  returns the record of the move taken back, or NULL if there is none
+*/
+const MoveRecord* undo_move(MoveStack* stack, Board* board);
+
+
+/*
+  plays again the last move taken back, where:
+
+  stack: the move stack
+  board: the checker board
+
+  returns the record of the move played, or NULL if there is none
+*/
+const MoveRecord* redo_move(MoveStack* stack, Board* board);
+
+
+// empties a key history, as at the start of a game
+void clear_keys(KeyHistory* history);
+
+
+/*
+  records the key of a position just reached, overwriting the oldest key
+  once the ring is full, where:
+
+  history: the key history
+  key: the key of the position, from position_key
+  irreversible: whether the move that reached it captured or moved a man
+    (see MoveRecord), or 1 for the first position of a game
+*/
+void push_key(KeyHistory* history, uint64_t key, uint8_t irreversible);
+
+
+// forgets the key of the last position recorded, as its move is unmade
+void pop_key(KeyHistory* history);
+
+
+/*
+  counts how many times the last position recorded was reached before,
+  looking back only as far as the last irreversible move; a position that
+  is new, the usual case, is answered from the filter without looking
+  through the keys, where:
+
+  history: the key history
+*/
+uint8_t position_repeats(const KeyHistory* history);
+
+
+/*
+  determines whether the game is drawn at the last position recorded: when
+  it has come up for the third time, or when DRAW_PLIES moves have been
+  played without a capture or a man moving, where:
+
+  history: the key history
+*/
+uint8_t position_drawn(const KeyHistory* history);
+
+#endif
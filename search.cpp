@@ -0,0 +1,663 @@
+/*
+  The computer player: an alpha-beta search in negamax form, deepened one
+  ply at a time against a clock (see search.h).
+
+  Whole moves are played with make_move and taken back with unmake_move, so
+  the search works on one board throughout; a capture sequence counts as a
+  single move.  Results are cached in the transposition table, if there is
+  one, and the best move it remembers for a position is searched first.
+*/
+
+#include <string.h>
+#include "rules.h"
+#include "search.h"
+#include "ttable.h"
+#include "eval.h"
+#include "bitbase.h"
+
+
+// making & unmaking moves
+
+static void search_make(Search* search, const Move* move, MoveRecord* record)
+{
+  // plays a move in the searched position, and hands over the turn
+  make_move(&search->board, move, record);
+  search->turn = -search->turn;
+  push_key(&search->keys, position_key(&search->board, search->turn),
+	   record->irreversible);
+}
+
+static void search_unmake(Search* search, const MoveRecord* record)
+{
+  // takes back a move played by search_make
+  pop_key(&search->keys);
+  search->turn = -search->turn;
+  unmake_move(&search->board, record);
+}
+
+static uint8_t out_of_time(Search* search)
+{
+  // checks the clock every so often, and stops the search at the deadline
+  // or when the halt function says to
+  if (!(search->nodes & CLOCK_CHECK) &&
+      ((int32_t) (search->clock() - search->deadline) >= 0 ||
+       (search->halt && search->halt()))){
+    search->stopped = 1;
+  }
+  return search->stopped;
+}
+
+
+// transposition table
+
+static int16_t score_to_table(int16_t score, uint8_t ply)
+{
+  // wins and losses are stored counting plies from the position, not from
+  // the root, so that they hold wherever the position comes up again
+  if (score > WIN_SCORE - MAX_PLY){
+    return score + ply;
+  }
+  if (score < MAX_PLY - WIN_SCORE){
+    return score - ply;
+  }
+  return score;
+}
+
+static int16_t score_from_table(int16_t score, uint8_t ply)
+{
+  // undoes score_to_table for a position the given plies from the root
+  if (score > WIN_SCORE - MAX_PLY){
+    return score - ply;
+  }
+  if (score < MAX_PLY - WIN_SCORE){
+    return score + ply;
+  }
+  return score;
+}
+
+
+// move ordering
+
+static uint8_t step_direction(uint8_t from, uint8_t to)
+{
+  // the direction of a simple move, from its squares (see rules.h)
+  uint8_t from_x = (2*(from % 4)) + (((from / 4) + 1) % 2);
+  uint8_t to_x = (2*(to % 4)) + (((to / 4) + 1) % 2);
+
+  return ((to < from) ? UP_LEFT : DOWN_LEFT) + ((to_x > from_x) ? 1 : 0);
+}
+
+static uint16_t order_score(const Search* search, const Move* move,
+			    uint16_t hash_move, uint8_t ply)
+{
+  /*
+    how promising a move looks before it is searched, higher first: the
+    move the table remembers, then captures (the more and the more kings
+    taken the better), then men reaching the last row, then the killers of
+    this ply, then the rest by their history, where:
+
+    search: the search
+    move: the move in question
+    hash_move: the packed move the table remembers, or NO_TABLE_MOVE
+    ply: the plies from the root
+   */
+  uint16_t packed = PACK_MOVE(*move);
+  uint8_t row = move->to / 4;
+
+  if (packed == hash_move){
+    return HASH_ORDER;
+  }
+  if (move->captured){
+    return CAPTURE_ORDER +
+      (16 * __builtin_popcountl(move->captured)) +
+      __builtin_popcountl(move->captured & search->board.kings);
+  }
+  if ((row == 0 || row == 7) &&
+      !(search->board.kings & SQUARE_BIT(move->from))){
+    return PROMOTION_ORDER;
+  }
+  if (packed == search->killers[ply][0]){
+    return KILLER_ORDER;
+  }
+  if (packed == search->killers[ply][1]){
+    return KILLER_ORDER - 1;
+  }
+  return search->history[move->from][step_direction(move->from, move->to)];
+}
+
+static void score_moves(Search* search, Move* moves, uint8_t count,
+			uint16_t hash_move, uint8_t ply)
+{
+  // scores moves for ordering, into the slots of the arena beside them
+  uint16_t* order = &search->order[moves - search->moves];
+
+  for (uint8_t i = 0; i < count; i++){
+    order[i] = order_score(search, &moves[i], hash_move, ply);
+  }
+}
+
+static void pick_move(Search* search, Move* moves, uint8_t first,
+		      uint8_t count)
+{
+  /*
+    swaps the most promising of the moves from first on into first, by the
+    scores of score_moves; the moves are picked one at a time, rather than
+    sorted, since a cutoff often comes before most of them are needed
+   */
+  uint16_t* order = &search->order[moves - search->moves];
+  uint8_t pick = first;
+
+  for (uint8_t i = first + 1; i < count; i++){
+    if (order[i] > order[pick]){
+      pick = i;
+    }
+  }
+  if (pick != first){
+    Move move = moves[pick];
+    uint16_t score = order[pick];
+    moves[pick] = moves[first];
+    order[pick] = order[first];
+    moves[first] = move;
+    order[first] = score;
+  }
+}
+
+static void reward_move(Search* search, const Move* move, uint8_t depth,
+			uint8_t ply)
+{
+  // remembers a simple move that caused a cutoff, as a killer of its ply
+  // and in its history
+  uint16_t packed = PACK_MOVE(*move);
+
+  if (move->captured){
+    return; // captures are forced, and ordered first anyway
+  }
+  if (search->killers[ply][0] != packed){
+    search->killers[ply][1] = search->killers[ply][0];
+    search->killers[ply][0] = packed;
+  }
+
+  uint16_t* history =
+    &search->history[move->from][step_direction(move->from, move->to)];
+  *history += depth * depth;
+  if (*history > HISTORY_MAX){
+    // keep the history below the killers, and its old lessons fading
+    for (uint8_t square = 0; square < NUM_SQUARES; square++){
+      for (uint8_t direction = 0; direction < NUM_DIRECTIONS; direction++){
+	search->history[square][direction] /= 2;
+      }
+    }
+  }
+}
+
+
+// quiescence
+
+static int16_t quiesce(Search* search, int16_t alpha, int16_t beta,
+		       uint8_t ply)
+{
+  /*
+    scores the searched position once the depth has run out, playing on
+    while there is a capture to make: jumps are forced, so a position with
+    one pending is not yet quiet enough to evaluate, where:
+
+    search: the search
+    alpha, beta: the window
+    ply: the plies from the root
+   */
+  uint32_t movers;
+  uint32_t jumpers;
+
+  search->nodes++;
+  if (out_of_time(search)){
+    return 0;
+  }
+  if (compute_moves(&search->board, search->turn, &movers, &jumpers)){
+    // nothing to capture: the position is quiet, unless it is lost
+    return movers ? evaluate(&search->board, search->turn) : ply - WIN_SCORE;
+  }
+  if (ply >= MAX_PLY){
+    return evaluate(&search->board, search->turn);
+  }
+
+  Move* moves = &search->moves[search->moves_used];
+  uint8_t count = generate_captures(&search->board, search->turn, moves);
+  if (search->moves_used + count > SEARCH_MOVES){
+    search->crowded++;
+    return evaluate(&search->board, search->turn);
+  }
+  int16_t best = -WIN_SCORE;
+  MoveRecord record;
+  search->moves_used += count;
+  score_moves(search, moves, count, NO_TABLE_MOVE, ply);
+
+  for (uint8_t i = 0; i < count; i++){
+    pick_move(search, moves, i, count);
+    search_make(search, &moves[i], &record);
+    int16_t score = -quiesce(search, -beta, -alpha, ply + 1);
+    search_unmake(search, &record);
+
+    if (search->stopped){
+      break;
+    }
+    if (score > best){
+      best = score;
+      if (score > alpha){
+	alpha = score;
+	if (alpha >= beta){
+	  break;
+	}
+      }
+    }
+  }
+  search->moves_used -= count;
+  return best;
+}
+
+
+// alpha-beta
+
+static int16_t alpha_beta(Search* search, int16_t alpha, int16_t beta,
+			  uint8_t depth, uint8_t ply)
+{
+  /*
+    scores the searched position, from the point of view of the player to
+    move, to the given depth, where:
+
+    search: the search
+    alpha, beta: the window; a score at or below alpha, or at or above
+      beta, need only be a bound
+    depth: the plies left to search
+    ply: the plies from the root
+
+    the first move is searched with the whole window and the rest with a
+    null window, to prove them no better, searching again only those that
+    are (principal variation search); returns 0 if the search has been
+    stopped
+   */
+  // coming back to a position is as good as a draw
+  if (position_repeats(&search->keys) || position_drawn(&search->keys)){
+    return DRAW_SCORE;
+  }
+  // endings the bitbase calls won need no searching, and score their
+  // evaluation on top so that trading down still pays; the rest, drawn or
+  // lost, are searched as ever, and their won replies found in it
+  if (__builtin_popcountl(search->board.red | search->board.blue) <=
+      BITBASE_KING_PIECES &&
+      probe_bitbase(&search->board, search->turn) == BITBASE_WIN){
+    return BITBASE_SCORE + evaluate(&search->board, search->turn);
+  }
+  if (!depth){
+    return quiesce(search, alpha, beta, ply);
+  }
+
+  search->nodes++;
+  if (out_of_time(search)){
+    return 0;
+  }
+  if (ply >= MAX_PLY){
+    return evaluate(&search->board, search->turn);
+  }
+
+  uint64_t key = position_key(&search->board, search->turn);
+  uint16_t hash_move = NO_TABLE_MOVE;
+  int16_t alpha_start = alpha;
+
+  if (search->table){
+    TableEntry entry;
+    search->probes++;
+    if (probe_table(search->table, key, &entry)){
+      search->hits++;
+      hash_move = entry.move;
+      if (entry.depth >= depth){
+	int16_t score = score_from_table(entry.score, ply);
+	uint8_t bound = ENTRY_BOUND(&entry);
+
+	if (bound == BOUND_EXACT ||
+	    (bound == BOUND_LOWER && score >= beta) ||
+	    (bound == BOUND_UPPER && score <= alpha)){
+	  return score;
+	}
+      }
+    }
+  }
+
+  Move* moves = &search->moves[search->moves_used];
+  uint8_t count;
+  list_moves(&search->board, search->turn, moves, &count);
+  if (!count){
+    return ply - WIN_SCORE; // no moves loses; the later the better
+  }
+  if (search->moves_used + count > SEARCH_MOVES){
+    // no room to keep the moves: score the position as it stands, and
+    // count it, since the iteration is shallower here than it says
+    search->crowded++;
+    return evaluate(&search->board, search->turn);
+  }
+
+  int16_t best = -WIN_SCORE;
+  uint16_t best_move = NO_TABLE_MOVE;
+  MoveRecord record;
+  search->moves_used += count;
+  score_moves(search, moves, count, hash_move, ply);
+
+  for (uint8_t i = 0; i < count; i++){
+    pick_move(search, moves, i, count);
+    search_make(search, &moves[i], &record);
+    int16_t score;
+    if (!i){
+      score = -alpha_beta(search, -beta, -alpha, depth - 1, ply + 1);
+    }
+    else {
+      score = -alpha_beta(search, -alpha - 1, -alpha, depth - 1, ply + 1);
+      if (score > alpha && score < beta){
+	score = -alpha_beta(search, -beta, -alpha, depth - 1, ply + 1);
+      }
+    }
+    search_unmake(search, &record);
+
+    if (search->stopped){
+      break;
+    }
+    if (score > best){
+      best = score;
+      if (score > alpha){
+	alpha = score;
+	best_move = PACK_MOVE(moves[i]);
+	if (alpha >= beta){
+	  reward_move(search, &moves[i], depth, ply);
+	  break;
+	}
+      }
+    }
+  }
+  search->moves_used -= count;
+
+  if (search->table && !search->stopped){
+    uint8_t bound = (best <= alpha_start) ? BOUND_UPPER :
+      (best >= beta) ? BOUND_LOWER : BOUND_EXACT;
+    store_table(search->table, key, depth, bound, score_to_table(best, ply),
+		best_move);
+  }
+  return best;
+}
+
+static int16_t search_root(Search* search, Move* moves, uint8_t count,
+			   uint8_t depth)
+{
+  /*
+    searches each of the root moves to the given depth within the window
+    of the iteration, from the first it has not searched yet, and moves the
+    best of them to the front of the list, where:
+
+    search: the search, whose root_done, root_best and window carry the
+      iteration from one call to the next
+    moves, count: the legal moves at the root
+    depth: the plies to search
+
+    returns the score of the best move, which is only a bound if it falls
+    outside the window, and meaningless if the search stopped; the root
+    move the search stopped in is searched again by the next call
+   */
+  int16_t beta = search->root_beta;
+  int16_t alpha = (search->root_best > search->root_alpha) ?
+    search->root_best : search->root_alpha;
+  MoveRecord record;
+
+  for (uint8_t i = search->root_done; i < count; i++){
+    search_make(search, &moves[i], &record);
+    int16_t score;
+    if (!i){
+      score = -alpha_beta(search, -beta, -alpha, depth - 1, 1);
+    }
+    else {
+      score = -alpha_beta(search, -alpha - 1, -alpha, depth - 1, 1);
+      if (score > alpha && score < beta){
+	score = -alpha_beta(search, -beta, -alpha, depth - 1, 1);
+      }
+    }
+    search_unmake(search, &record);
+
+    if (search->stopped){
+      break;
+    }
+    search->root_done = i + 1;
+    if (score > search->root_best){
+      search->root_best = score;
+    }
+    if (score > alpha){
+      alpha = score;
+      Move move = moves[i];
+      memmove(&moves[1], &moves[0], i * sizeof(Move));
+      moves[0] = move;
+      if (alpha >= beta){
+	break;
+      }
+    }
+  }
+  return search->root_best;
+}
+
+
+// iterative deepening
+
+void init_search(Search* search, uint32_t (*clock)(void), TransTable* table)
+{
+  /*
+    readies a search for use, where:
+
+    search: the search
+    clock: a function returning the time in milliseconds
+    table: the transposition table to use, or NULL for none
+   */
+  memset(search, 0, sizeof(Search));
+  search->clock = clock;
+  search->table = table;
+}
+
+static uint8_t settled(const Search* search)
+{
+  // whether more depth cannot change the move: there is at most one, or
+  // the search has found a forced win or loss
+  return search->moves_used < 2 || (search->depth &&
+    (search->score > WIN_SCORE - MAX_PLY ||
+     search->score < MAX_PLY - WIN_SCORE));
+}
+
+void begin_search(Search* search, const Board* board, int8_t turn,
+		  const KeyHistory* keys)
+{
+  /*
+    sets the root of a search to a position and lists its moves, leaving
+    the table as it is, where:
+
+    search: the search
+    board: the position to search
+    turn: the player to move, TURN_RED or TURN_BLUE
+    keys: the keys of the positions in the game so far, or NULL
+   */
+  if (keys){
+    search->keys = *keys;
+  }
+  else {
+    clear_keys(&search->keys);
+    push_key(&search->keys, position_key(board, turn), 1);
+  }
+  search->board = *board;
+  search->turn = turn;
+  search->nodes = 0;
+  search->probes = 0;
+  search->hits = 0;
+  search->crowded = 0;
+  search->depth = 0;
+  search->score = 0;
+  search->iterating = 0;
+
+  // the root moves live at the bottom of the arena, best first after each
+  // iteration, so that the next iteration searches the best move first
+  uint8_t count;
+  list_moves(board, turn, search->moves, &count);
+  search->moves_used = count;
+  if (count){
+    search->best = search->moves[0];
+  }
+
+  // the killers are for this search only, and the history fades
+  memset(search->killers, 0xFF, sizeof(search->killers));
+  for (uint8_t square = 0; square < NUM_SQUARES; square++){
+    for (uint8_t direction = 0; direction < NUM_DIRECTIONS; direction++){
+      search->history[square][direction] /= 4;
+    }
+  }
+}
+
+void deepen(Search* search, uint32_t budget, uint8_t max_depth)
+{
+  /*
+    searches the root one ply deeper at a time, carrying on from the
+    iteration in search->depth, until the budget runs out or max_depth is
+    reached, where:
+
+    search: the search
+    budget: the milliseconds to search for
+    max_depth: the deepest iteration to search
+
+    an iteration cut short by the deadline is carried on by the next call,
+    from the root move it stopped in
+   */
+  Move* moves = search->moves;
+  uint8_t count = search->moves_used;
+
+  search->deadline = search->clock() + budget;
+  search->stopped = 0;
+  while (search->depth < max_depth && !settled(search)){
+    uint8_t depth = search->depth + 1;
+
+    // look first in a window around the last iteration's score (the
+    // aspiration window), and again with the whole range if it misses
+    if (!search->iterating){
+      search->root_alpha = -WIN_SCORE;
+      search->root_beta = WIN_SCORE;
+      if (depth > 2){
+	search->root_alpha = search->score - ASPIRATION_WINDOW;
+	search->root_beta = search->score + ASPIRATION_WINDOW;
+      }
+      search->root_done = 0;
+      search->root_best = -WIN_SCORE;
+      search->iterating = 1;
+    }
+    int16_t score = search_root(search, moves, count, depth);
+    if (search->stopped){
+      break;
+    }
+    if ((score <= search->root_alpha || score >= search->root_beta) &&
+	(search->root_alpha != -WIN_SCORE || search->root_beta != WIN_SCORE)){
+      search->root_alpha = -WIN_SCORE;
+      search->root_beta = WIN_SCORE;
+      search->root_done = 0;
+      search->root_best = -WIN_SCORE;
+      continue;
+    }
+    search->iterating = 0;
+    search->best = moves[0];
+    search->score = score;
+    search->depth = depth;
+  }
+}
+
+uint8_t think(Search* search, const Board* board, int8_t turn,
+	      const KeyHistory* keys, uint32_t budget, uint8_t max_depth)
+{
+  /*
+    picks a move for the player to move by searching one ply deeper at a
+    time until the time budget runs out or max_depth is reached, carrying
+    on from the pondering if the position is the one pondered, where:
+
+    search: the search
+    board: the position to move from
+    turn: the player to move, TURN_RED or TURN_BLUE
+    keys: the keys of the positions in the game so far, or NULL
+    budget: the milliseconds to think for
+    max_depth: the deepest iteration to search, at most MAX_PLY
+   */
+  uint32_t start = search->clock();
+
+  if (!search->pondering || search->turn != turn ||
+      search->board.key != board->key){
+    if (search->table){
+      age_table(search->table);
+    }
+    begin_search(search, board, turn, keys);
+  }
+  search->pondering = 0;
+
+  deepen(search, budget, max_depth);
+  search->elapsed = search->clock() - start;
+  return search->moves_used;
+}
+
+uint8_t start_ponder(Search* search, const Board* board, int8_t turn,
+		     const KeyHistory* keys)
+{
+  /*
+    guesses the reply of the player to move, from the table, and readies
+    the search to think about the position it would leave while that player
+    chooses (see ponder), where:
+
+    search: the search
+    board: the position the player is choosing a move in
+    turn: the player to move, TURN_RED or TURN_BLUE
+    keys: the keys of the positions in the game so far, ending with board's
+   */
+  Move* moves = search->moves;
+  uint8_t count;
+  uint8_t guess = 0;
+
+  search->pondering = 0;
+  list_moves(board, turn, moves, &count);
+  if (!count){
+    return 0;
+  }
+
+  // the table remembers the best reply from the last think, if any
+  TableEntry entry;
+  if (search->table &&
+      probe_table(search->table, position_key(board, turn), &entry)){
+    for (uint8_t i = 0; i < count; i++){
+      if (PACK_MOVE(moves[i]) == entry.move){
+	guess = i;
+      }
+    }
+  }
+
+  Board next = *board;
+  MoveRecord record;
+  make_move(&next, &moves[guess], &record);
+  if (search->table){
+    age_table(search->table);
+  }
+  begin_search(search, &next, -turn, keys);
+  push_key(&search->keys, position_key(&next, -turn), record.irreversible);
+  search->pondering = 1;
+  return 1;
+}
+
+void ponder(Search* search, uint32_t slice)
+{
+  /*
+    thinks about the position readied by start_ponder for a slice of time,
+    picking up where the last slice left off, where:
+
+    search: the search
+    slice: the milliseconds to think for
+   */
+  if (search->pondering){
+    deepen(search, slice, MAX_PLY);
+  }
+}
+
+void stop_ponder(Search* search)
+{
+  // forgets the pondered position, as when the game is set up again
+  search->pondering = 0;
+}
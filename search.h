@@ -0,0 +1,226 @@
+#ifndef _SEARCH_H
+#define _SEARCH_H
+
+/*
+  The computer player: an alpha-beta search with iterative deepening over
+  the rules in rules.h, with principal variation search, aspiration
+  windows, a quiescence search of captures, and moves ordered by the
+  transposition table, captures, killers and history.  The positions it
+  stops at are scored by evaluate (see eval.h), and small endings are
+  looked up in the bitbase (see bitbase.h) rather than searched.  Like the
+  rules it is kept free of the TFT, the SD card and Serial, so the same
+  search runs in the sketch and on the host.
+
+  While the other player chooses a move, the search can ponder: it guesses
+  their reply and thinks about the position it would leave, a slice at a
+  time, in whatever time the caller has to spare; each slice picks up the
+  iteration at the root move the last one stopped in.  If the guess is right,
+  think carries on from where the pondering got to; if not, the table
+  still holds whatever the pondering found.
+
+  All of the memory a search uses is in the Search struct, which belongs to
+  the caller (a global, in the sketch), so nothing is allocated while the
+  computer thinks; moves are generated into an arena in the struct that
+  the plies share as a stack, each keeping only as many slots as it has
+  moves.
+*/
+
+#include <stdint.h>
+#include "rules.h"
+#include "ttable.h"
+
+// search settings; the Mega looks less deep, since each ply's recursion
+// takes stack, and the killers their SRAM, from its transposition table
+#ifdef __AVR__
+#define MAX_PLY 32       // the deepest the search will look
+#else
+#define MAX_PLY 48
+#endif
+#define SEARCH_MOVES 112 // room in the move arena shared by all the plies
+#define ASPIRATION_WINDOW 50 // half a man either side of the last score
+
+// the clock is read every CLOCK_CHECK + 1 nodes; often on the Mega, where it
+// is cheap to read and a late stop holds up the player's input
+#ifdef __AVR__
+#define CLOCK_CHECK 15
+#else
+#define CLOCK_CHECK 127
+#endif
+
+// move ordering, from the first tried down (see order_score)
+#define HASH_ORDER 0xFFFF
+#define CAPTURE_ORDER 0xF000
+#define PROMOTION_ORDER 0xE100
+#define KILLER_ORDER 0xE000
+#define HISTORY_MAX 0xD000
+
+// scores, from the point of view of the player to move
+#define WIN_SCORE 30000 // winning now; winning in n plies is WIN_SCORE - n
+#define BITBASE_SCORE 15000 // won, says the bitbase, in plies unknown
+#define DRAW_SCORE 0
+
+/*
+  Struct for everything a search needs, where:
+
+  board:      the position being searched, changed and restored as the
+              search makes and unmakes moves
+  turn:       the player to move in board
+  keys:       the keys of the positions leading to board, for repetitions
+  moves:      the move arena; each ply lists its moves above its parent's,
+              into the MAX_MOVES past the last used, and keeps them if
+              they fit within SEARCH_MOVES
+  moves_used: the number of moves in the arena
+  order:      the ordering score of each move in the arena
+  killers:    for each ply, the last two simple moves that caused a
+              cutoff there, packed by PACK_MOVE
+  history:    for each square and direction, how often and how deep a
+              simple move that way has caused a cutoff
+  clock:      returns the time in milliseconds
+  table:      the transposition table, or NULL to search without one
+  halt:       returns nonzero to stop the search early, or NULL; read as
+              often as the clock
+  deadline:   the clock reading at which to stop
+  stopped:    set once the deadline passes, abandoning the search
+  pondering:  set while board is the position after the guessed reply of a
+              player still choosing their move (see start_ponder)
+  nodes:      the number of positions searched
+  probes:     the number of table lookups
+  hits:       the number of those that found their position
+  crowded:    the number of positions scored as they stand, searched no
+              deeper, because their moves did not fit in the arena
+  elapsed:    the milliseconds the last think took
+  iterating:  set while an iteration stopped partway is to be carried on
+              by the next call of deepen
+  root_done:  the root moves that iteration has searched
+  root_alpha, root_beta: its window
+  root_best:  the best score among the root moves it has searched
+  depth:      the deepest iteration completed by the last think
+  score:      the score of best, from the point of view of the root player
+  best:       the best move found by the last think
+*/
+typedef struct {
+  Board board;
+  int8_t turn;
+  KeyHistory keys;
+  Move moves[SEARCH_MOVES + MAX_MOVES];
+  uint16_t moves_used;
+  uint16_t order[SEARCH_MOVES];
+  uint16_t killers[MAX_PLY][2];
+  uint16_t history[NUM_SQUARES][NUM_DIRECTIONS];
+  uint32_t (*clock)(void);
+  TransTable* table;
+  uint8_t (*halt)(void);
+  uint32_t deadline;
+  uint8_t stopped;
+  uint8_t pondering;
+  uint32_t nodes;
+  uint32_t probes;
+  uint32_t hits;
+  uint32_t crowded;
+  uint32_t elapsed;
+  uint8_t iterating;
+  uint8_t root_done;
+  int16_t root_alpha;
+  int16_t root_beta;
+  int16_t root_best;
+  uint8_t depth;
+  int16_t score;
+  Move best;
+} Search;
+
+
+/*
+  readies a search for use, where:
+
+  search: the search
+  clock: a function returning the time in milliseconds
+  table: the transposition table to use, or NULL for none
+*/
+void init_search(Search* search, uint32_t (*clock)(void), TransTable* table);
+
+
+/*
+  sets the root of a search to a position and lists its moves, leaving
+  the table as it is, where:
+
+  search: the search
+  board: the position to search
+  turn: the player to move, TURN_RED or TURN_BLUE
+  keys: the keys of the positions in the game so far, or NULL
+
+  think does this itself; it is for searches sharing a table, which is
+  aged once for all of them (see host/engine.cpp)
+*/
+void begin_search(Search* search, const Board* board, int8_t turn,
+		  const KeyHistory* keys);
+
+
+/*
+  searches the root one ply deeper at a time, carrying on from the
+  iteration in search->depth, until the budget runs out or max_depth is
+  reached, where:
+
+  search: the search
+  budget: the milliseconds to search for
+  max_depth: the deepest iteration to search, at most MAX_PLY
+
+  an iteration cut short by the deadline is carried on by the next call,
+  from the root move it stopped in, so that short calls (as when
+  pondering) still get deeper
+*/
+void deepen(Search* search, uint32_t budget, uint8_t max_depth);
+
+
+/*
+  picks a move for the player to move by searching one ply deeper at a
+  time until the time budget runs out or max_depth is reached, and leaves
+  the best move found by the last completed iteration in search->best;
+  if the position is the one being pondered, the search carries on from
+  the pondering, otherwise the nodes, probes, hits and crowded positions
+  are counted afresh, where:
+
+  search: the search
+  board: the position to move from
+  turn: the player to move, TURN_RED or TURN_BLUE
+  keys: the keys of the positions in the game so far, or NULL
+  budget: the milliseconds to think for
+  max_depth: the deepest iteration to search, at most MAX_PLY
+
+  returns the number of legal moves; with none, search->best is not set
+*/
+uint8_t think(Search* search, const Board* board, int8_t turn,
+	      const KeyHistory* keys, uint32_t budget, uint8_t max_depth);
+
+
+/*
+  guesses the reply of the player to move, from the table, and readies
+  the search to think about the position it would leave while that player
+  chooses (see ponder), where:
+
+  search: the search
+  board: the position the player is choosing a move in
+  turn: the player to move, TURN_RED or TURN_BLUE
+  keys: the keys of the positions in the game so far, ending with board's
+
+  returns 0, and does not ponder, if the player has no moves
+*/
+uint8_t start_ponder(Search* search, const Board* board, int8_t turn,
+		     const KeyHistory* keys);
+
+
+/*
+  thinks about the position readied by start_ponder for a slice of time,
+  picking up where the last slice left off, where:
+
+  search: the search
+  slice: the milliseconds to think for
+
+  does nothing if the search is not pondering
+*/
+void ponder(Search* search, uint32_t slice);
+
+
+// forgets the pondered position, as when the game is set up again
+void stop_ponder(Search* search);
+
+#endif
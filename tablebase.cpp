@@ -0,0 +1,237 @@
+/*
+  Probing the endgame database on the SD card, through the one block of it
+  kept in SRAM (see tablebase.h).
+*/
+
+#include <string.h>
+#include "rules.h"
+#include "endgame.h"
+#include "tablebase.h"
+
+
+// the kept block
+
+static const uint8_t* cached_block(Tablebase* tablebase, uint32_t block)
+{
+  /*
+    a block of the file, read unless it is the one kept already, where:
+
+    tablebase: the tablebase
+    block: the number of the block
+
+    returns NULL if the block could not be read
+   */
+  if (tablebase->block != block){
+    tablebase->reads++;
+    if (!tablebase->read_block(block, tablebase->data)){
+      tablebase->block = NO_CACHED_BLOCK;
+      return NULL;
+    }
+    tablebase->block = block;
+  }
+  return tablebase->data;
+}
+
+static uint8_t read_bytes(Tablebase* tablebase, uint32_t offset,
+			  void* bytes, uint16_t size)
+{
+  // copies bytes from the file, which may straddle two blocks, and returns
+  // 0 if they could not be read
+  uint8_t* out = (uint8_t*) bytes;
+
+  while (size){
+    const uint8_t* data = cached_block(tablebase, offset / ENDGAME_BLOCK);
+    uint16_t start = offset % ENDGAME_BLOCK;
+    uint16_t part = ENDGAME_BLOCK - start;
+    if (!data){
+      return 0;
+    }
+    if (part > size){
+      part = size;
+    }
+    memcpy(out, &data[start], part);
+    out += part;
+    offset += part;
+    size -= part;
+  }
+  return 1;
+}
+
+
+// probing
+
+uint8_t open_tablebase(Tablebase* tablebase,
+		       uint8_t (*read_block)(uint32_t block, uint8_t* data),
+		       TablebaseSlice* slices, uint16_t count, uint8_t* data)
+{
+  /*
+    opens a database file by reading its directory, where:
+
+    tablebase: the tablebase
+    read_block: reads a block of the file (see Tablebase)
+    slices: memory for the slices, which the tablebase keeps using
+    count: the number of slices it has room for
+    data: memory for the block kept, ENDGAME_BLOCK bytes
+   */
+  EndgameHeader header;
+
+  tablebase->read_block = read_block;
+  tablebase->slices = slices;
+  tablebase->num_slices = 0;
+  tablebase->pieces = 0;
+  tablebase->block = NO_CACHED_BLOCK;
+  tablebase->data = data;
+  tablebase->probes = 0;
+  tablebase->reads = 0;
+
+  if (!read_bytes(tablebase, 0, &header, sizeof(header)) ||
+      header.magic != ENDGAME_MAGIC || header.version != ENDGAME_VERSION ||
+      header.pieces > MAX_ENDGAME_PIECES ||
+      header.slices != count_slices(header.pieces)){
+    return 0;
+  }
+
+  // keep the smaller endings, as many of them as there is room for; this
+  // is the only time the directory is read
+  uint8_t pieces = header.pieces;
+  while (pieces > 1 && count_slices(pieces) > count){
+    pieces--;
+  }
+  for (uint16_t i = 0; i < count_slices(pieces); i++){
+    EndgameSlice entry;
+    uint8_t shift = 0;
+    if (!read_bytes(tablebase, sizeof(header) + (i * sizeof(entry)), &entry,
+		    sizeof(entry))){
+      return 0;
+    }
+    while (shift < 31 && (1UL << shift) < entry.index_positions){
+      shift++;
+    }
+    if ((1UL << shift) != entry.index_positions){
+      return 0; // tbgen only makes powers of two
+    }
+    slices[i].index_block = entry.index_block;
+    slices[i].index_shift = shift;
+  }
+  tablebase->num_slices = count_slices(pieces);
+  tablebase->pieces = pieces;
+  return 1;
+}
+
+void lend_tablebase_block(Tablebase* tablebase, uint8_t* data)
+{
+  /*
+    hands the tablebase the memory to keep its block in, forgetting the
+    block it held, where:
+
+    tablebase: the tablebase
+    data: the memory, ENDGAME_BLOCK bytes
+   */
+  tablebase->data = data;
+  tablebase->block = NO_CACHED_BLOCK;
+}
+
+uint8_t probe_tablebase(Tablebase* tablebase, const Board* board,
+			int8_t turn)
+{
+  /*
+    looks up a position, where:
+
+    tablebase: the tablebase, opened
+    board: the position
+    turn: the player to move, TURN_RED or TURN_BLUE
+   */
+  Board position = *board;
+  Material material;
+
+  if (turn == TURN_BLUE){
+    flip_board(&position); // the database only has red to move
+  }
+  if (!position.red){
+    return ENDGAME_VALUE(0); // the last checker was taken: lost
+  }
+  uint8_t total = board_material(&position, &material);
+  if (!position.blue || total > tablebase->pieces){
+    return TABLEBASE_UNKNOWN;
+  }
+  tablebase->probes++;
+
+  const TablebaseSlice* slice = &tablebase->slices[slice_number(&material)];
+  uint32_t index = endgame_index(&position, &material);
+  uint32_t positions = slice_positions(&material);
+  uint32_t first_block = slice->index_block +
+    ((positions - 1) >> slice->index_shift) + 1;
+
+  // the block of the index covering the position, then its data block;
+  // both are read into the same memory, so take what is needed from the
+  // first before reading the second
+  const uint8_t* index_block =
+    cached_block(tablebase, slice->index_block +
+		 (index >> slice->index_shift));
+  if (!index_block){
+    return TABLEBASE_UNKNOWN;
+  }
+  uint8_t entry = find_block(index_block, index);
+  uint32_t data_block = index_entry(index_block, 0) + entry - 1;
+  uint32_t first = index_entry(index_block, entry);
+
+  const uint8_t* data = cached_block(tablebase, first_block + data_block);
+  if (!data){
+    return TABLEBASE_UNKNOWN;
+  }
+  return block_value(data, index - first);
+}
+
+static int16_t value_order(uint8_t value)
+{
+  // orders the values of the positions a move may leave, best for the
+  // player making it first: the opponent losing soonest, a draw, then the
+  // opponent winning latest
+  if (ENDGAME_LOST(value)){
+    return MAX_ENDGAME_PLIES + 1 - ENDGAME_PLIES(value);
+  }
+  if (ENDGAME_WON(value)){
+    return ENDGAME_PLIES(value) - MAX_ENDGAME_PLIES - 1;
+  }
+  return 0;
+}
+
+uint8_t tablebase_move(Tablebase* tablebase, const Board* board,
+		       int8_t turn, Move* best)
+{
+  /*
+    chooses the move that wins soonest or loses latest, or failing those
+    draws, by looking up the position each move leaves, where:
+
+    tablebase: the tablebase, opened
+    board: the position
+    turn: the player to move, TURN_RED or TURN_BLUE
+    best: set to the move
+   */
+  MoveList list;
+  uint8_t best_value = TABLEBASE_UNKNOWN;
+
+  generate_moves(board, turn, &list);
+  for (uint8_t i = 0; i < list.count; i++){
+    Board child = *board;
+    MoveRecord record;
+    make_move(&child, &list.moves[i], &record);
+
+    uint8_t value = probe_tablebase(tablebase, &child, -turn);
+    if (value == TABLEBASE_UNKNOWN){
+      return TABLEBASE_UNKNOWN;
+    }
+    if (best_value == TABLEBASE_UNKNOWN ||
+	value_order(value) > value_order(best_value)){
+      best_value = value;
+      *best = list.moves[i];
+    }
+  }
+
+  // one ply more than the position the move leaves, with the result turned
+  // around for the player making it
+  if (best_value == TABLEBASE_UNKNOWN || best_value == ENDGAME_DRAW){
+    return best_value;
+  }
+  return ENDGAME_VALUE(ENDGAME_PLIES(best_value) + 1);
+}
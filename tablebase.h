@@ -0,0 +1,128 @@
+#ifndef _TABLEBASE_H
+#define _TABLEBASE_H
+
+/*
+  Probing the endgame database (see endgame.h) where it is kept on the SD
+  card, for endings with more checkers than the bitbase holds, and for the
+  number of plies to their end.
+
+  The file is read a block at a time through a function the caller gives,
+  so this is kept free of the card itself: the sketch reads raw blocks
+  of a contiguous file with Sd2Card, and the host reads a file.
+  open_tablebase reads the directory once, and keeps where the block
+  index of each slice starts, and how many positions a block of it
+  covers, in memory the caller gives.  After that a probe reads two
+  blocks at most: the block of the index that covers the position, then
+  the data block it points to.  Both go through the one block the
+  tablebase keeps, which is read again only when a probe needs a
+  different block, so a position close to the one probed before reads
+  none.
+*/
+
+#include <stdint.h>
+#include "rules.h"
+#include "endgame.h"
+
+#define TABLEBASE_UNKNOWN 0xFF // not in the database, or not readable
+#define NO_CACHED_BLOCK 0xFFFFFFFFUL
+
+/*
+  Struct for what a probe needs of a slice, 5 bytes on the Mega, where:
+
+  index_block: the block its block index starts in
+  index_shift: each block of the index covers 2 to the power of this
+               many positions
+*/
+typedef struct {
+  uint32_t index_block;
+  uint8_t index_shift;
+} TablebaseSlice;
+
+/*
+  Struct for an open database file, where:
+
+  read_block: reads a block of the file, counting from its start, and
+              returns nonzero if it could
+  slices:     the slices, in the order of slice_number
+  num_slices: the number of slices kept
+  pieces:     the most checkers in the slices kept
+  block:      the number of the block kept, or NO_CACHED_BLOCK
+  data:       the memory it is kept in, ENDGAME_BLOCK bytes
+  probes:     the number of probes
+  reads:      the number of blocks read by them
+*/
+typedef struct {
+  uint8_t (*read_block)(uint32_t block, uint8_t* data);
+  TablebaseSlice* slices;
+  uint16_t num_slices;
+  uint8_t pieces;
+  uint32_t block;
+  uint8_t* data;
+  uint32_t probes;
+  uint32_t reads;
+} Tablebase;
+
+
+/*
+  opens a database file by reading its directory, where:
+
+  tablebase: the tablebase
+  read_block: reads a block of the file (see Tablebase)
+  slices: memory for the slices, which the tablebase keeps using
+  count: the number of slices it has room for; with fewer than the file
+    has, only endings small enough for all of their slices to fit are
+    probed
+  data: memory for the block kept, ENDGAME_BLOCK bytes (see
+    lend_tablebase_block)
+
+  returns 0 if the file could not be read or is not a database
+*/
+uint8_t open_tablebase(Tablebase* tablebase,
+		       uint8_t (*read_block)(uint32_t block, uint8_t* data),
+		       TablebaseSlice* slices, uint16_t count, uint8_t* data);
+
+
+/*
+  hands the tablebase the memory to keep its block in, forgetting the
+  block it held, where:
+
+  tablebase: the tablebase
+  data: the memory, ENDGAME_BLOCK bytes
+
+  for memory that something else uses between probes, as the SD library's
+  block cache is in the sketch, this is called before each probe
+*/
+void lend_tablebase_block(Tablebase* tablebase, uint8_t* data);
+
+
+/*
+  looks up a position, where:
+
+  tablebase: the tablebase, opened
+  board: the position
+  turn: the player to move, TURN_RED or TURN_BLUE
+
+  returns the position's value for the player to move (see endgame.h), or
+  TABLEBASE_UNKNOWN
+*/
+uint8_t probe_tablebase(Tablebase* tablebase, const Board* board,
+			int8_t turn);
+
+
+/*
+  chooses the move that wins soonest or loses latest, or failing those
+  draws, by looking up the position each move leaves, where:
+
+  tablebase: the tablebase, opened
+  board: the position
+  turn: the player to move, TURN_RED or TURN_BLUE
+  best: set to the move
+
+  returns the position's value for the player to move, or
+  TABLEBASE_UNKNOWN if it has no moves or any of them leaves a position
+  that is not in the database
+*/
+uint8_t tablebase_move(Tablebase* tablebase, const Board* board,
+		       int8_t turn, Move* best);
+
+#endif
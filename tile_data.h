@@ -0,0 +1,1813 @@
+/*
+  The empty tiles of the board image (see draw_tile), written by
+  host/tilegen.cpp from checkerboard.lcd: do not edit.
+*/
+
+#ifndef _TILE_DATA_H
+#define _TILE_DATA_H
+
+// 64 tiles of 15 by 15 pixels, in the order of tile_to_coord, each row by row
+static const uint16_t TILE_PIXELS[14400] PROGMEM_FAR = {
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61A2, 0x8AE6, 0xAC0A, 0x61C2,
+  0x61C2, 0x59A2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61A2, 0x8AE6, 0xAC0A, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61A2, 0x61A2, 0x8AE6, 0xAC0A, 0x61E3, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61A2, 0x8AE6, 0xB40A, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61A2, 0x8AE6, 0xAC0A, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61A2, 0x61A2,
+  0x8AE6, 0xAC0A, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x59A2, 0x59A2, 0x59A2, 0x61C2, 0x61A2, 0x61A2, 0x82C6,
+  0xB42B, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C3, 0x61C2, 0x61C2, 0x61C2, 0x82C6, 0xB42B,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61A2, 0x61A2, 0x82C6, 0xB42B, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x59A2,
+  0x59A2, 0x61C2, 0x61C2, 0x61A2, 0x82C6, 0xB42B, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x82C6, 0xB42B, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x82C6, 0xB42B, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x82C6, 0xB42B, 0x9348, 0x8B07, 0x9327, 0x9327, 0x9347,
+  0x9348, 0x8B07, 0x9347, 0x9348, 0x8B07, 0x9348, 0x8B07, 0x8B07,
+  0x8AE6, 0x7AA5, 0xB44B, 0xAC0A, 0xB42B, 0xB42B, 0xB42B, 0xBC6C,
+  0xABEA, 0xB44B, 0xBC6C, 0xAC0A, 0xBC6C, 0xABEA, 0xB42B, 0x82E7,
+  0x61C2, 0xBC4B, 0xA3C9, 0xBC6C, 0xB42B, 0xBC8C, 0xAC0A, 0xB42B,
+  0xB42A, 0xAC0A, 0xAC0A, 0xBC6B, 0xB44B, 0xB42B, 0xB44B, 0x5981,
+  0xBC4C, 0xA3A9, 0xBC6C, 0xB42B, 0xBC8C, 0xAC0A, 0xB42A, 0xB42B,
+  0xAC0A, 0xAC0A, 0xBC4C, 0xB44B, 0xB42B, 0xB44B, 0x59A1, 0xBC4C,
+  0xA3A9, 0xBC6C, 0xB42B, 0xBC8C, 0xAC0A, 0xB40A, 0xB40B, 0xB40B,
+  0xAC0A, 0xBC4C, 0xB42B, 0xB42B, 0xB42B, 0x59A2, 0xBC4B, 0xA3C9,
+  0xBC6C, 0xB42A, 0xBC8C, 0xABEA, 0xB40A, 0xAC0A, 0xB42B, 0xAC0A,
+  0xBC4C, 0xB44B, 0xB42B, 0xB42B, 0x59A2, 0xBC4C, 0xA3C9, 0xBC6C,
+  0xAC2B, 0xBC8C, 0xABEA, 0xB40A, 0xABEA, 0xB42B, 0xAC0A, 0xBC6C,
+  0xB44B, 0xB42B, 0xB42B, 0x59A2, 0xBC6C, 0xA3A9, 0xBC6C, 0xAC2B,
+  0xBC6C, 0xABEA, 0xAC0A, 0xABEA, 0xB42A, 0xAC0A, 0xBC6C, 0xB42B,
+  0xB42B, 0xB42B, 0x5982, 0xBC6C, 0xA3A9, 0xBC6C, 0xAC0B, 0xBC6C,
+  0xABCA, 0xB40B, 0xABEA, 0xB42A, 0xAC0A, 0xBC6C, 0xB42B, 0xB42B,
+  0xB42B, 0x5982, 0xBC6C, 0xA3A9, 0xBC6C, 0xAC0A, 0xBC8C, 0xA3C9,
+  0xAC0A, 0xABEA, 0xB42B, 0xAC0A, 0xBC6C, 0xB42B, 0xB42B, 0xB42B,
+  0x5982, 0xBC4C, 0xA3A9, 0xBC6C, 0xAC0A, 0xBC6C, 0xA3C9, 0xAC0A,
+  0xABEA, 0xB42B, 0xAC0A, 0xBC6C, 0xB42B, 0xB42B, 0xB42B, 0x61A2,
+  0xB44B, 0xA3A9, 0xBC6C, 0xAC0A, 0xBC6C, 0xABEA, 0xABEA, 0xABEA,
+  0xB42B, 0xAC0A, 0xBC6C, 0xB42B, 0xB42B, 0xB42B, 0x61A2, 0xBC4B,
+  0xA3C9, 0xBC6C, 0xAC0A, 0xBC4B, 0xABEA, 0xABEA, 0xABEA, 0xB42B,
+  0xAC0A, 0xBC6C, 0xB42B, 0xB42B, 0xB42B, 0x61A1, 0xB44B, 0xA3C9,
+  0xBC6C, 0xABEA, 0xB44B, 0xABEA, 0xABEA, 0xAC0A, 0xB42A, 0xAC0A,
+  0xBC6C, 0xB42B, 0xB42A, 0xB40B, 0x61A1, 0xB42B, 0xA3C9, 0xBC6C,
+  0xABEA, 0xB44B, 0xAC0A, 0xABE9, 0xAC0A, 0xAC0A, 0xAC0A, 0xBC6C,
+  0xB42B, 0xAC0A, 0xAC0B, 0x61A1, 0x82C6, 0x7A85, 0x82C6, 0x7A85,
+  0x82A5, 0x7A85, 0x7A85, 0x7AA5, 0x7A85, 0x7AA5, 0x82C6, 0x7AA5,
+  0x7AA5, 0x7A85, 0x9B68, 0x61C2, 0x61A2, 0x61C2, 0x61A2, 0x61A2,
+  0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x59A2,
+  0x59A1, 0xBCAD, 0x59A2, 0x59C1, 0x59A2, 0x59A2, 0x59A2, 0x59A2,
+  0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x5981,
+  0x8B07, 0x59C2, 0x61C2, 0x61C2, 0x61A2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C3, 0x59C2, 0x61C3, 0x59A2, 0x8AE6,
+  0x59C2, 0x59C1, 0x61A2, 0x61A2, 0x59A2, 0x59A2, 0x59A2, 0x59A2,
+  0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x5982, 0x8AE6, 0x59C2,
+  0x61C2, 0x61C2, 0x61A2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x59C2, 0x59C2, 0x59A2, 0x8AE7, 0x59A2, 0x59C2,
+  0x61A2, 0x61A2, 0x61A2, 0x61C2, 0x61C2, 0x59C2, 0x59C2, 0x59C2,
+  0x59C2, 0x59C2, 0x59C2, 0x59A2, 0x8AE6, 0x59A2, 0x61C2, 0x61A2,
+  0x61A2, 0x61A2, 0x61A2, 0x61C2, 0x61C2, 0x61C2, 0x59C2, 0x59C2,
+  0x59C2, 0x59C2, 0x59A2, 0x8AE6, 0x61C2, 0x59C2, 0x61C2, 0x61A2,
+  0x61A2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x59C2, 0x59C2, 0x59C2,
+  0x59A2, 0x59A1, 0x8B06, 0x61C2, 0x61C2, 0x61C2, 0x61A2, 0x61A2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61A2, 0x8B06, 0x61A2, 0x59A2, 0x61A2, 0x61A2, 0x61A2, 0x59A2,
+  0x59A2, 0x59A2, 0x59C2, 0x59C2, 0x59A2, 0x59C2, 0x59A2, 0x61A2,
+  0x8B07, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x59C2, 0x61C2, 0x59A1, 0x8AE6,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61E2, 0x61C2, 0x61C3, 0x61C3, 0x61C3, 0x61C2, 0x8B07, 0x61C2,
+  0x59C2, 0x59C2, 0x61A2, 0x61A2, 0x61A2, 0x61C2, 0x61C2, 0x59C2,
+  0x61C2, 0x61C3, 0x61C3, 0x61C2, 0x61A2, 0x8B07, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61A2, 0x8AE7, 0x9368, 0x8AE7, 0x9327,
+  0x8B27, 0x9B68, 0x9347, 0x9347, 0x9327, 0x8B07, 0x9348, 0x8B07,
+  0x9348, 0x8AE6, 0x9348, 0x7AA5, 0xBC8C, 0xA3C9, 0xB42B, 0xAC0A,
+  0xBC6C, 0xB44B, 0xB44B, 0xB42B, 0xABEA, 0xB44B, 0xA3C9, 0xB42B,
+  0xA3C9, 0xB42B, 0x7A65, 0xB44C, 0xAC0A, 0xB42B, 0xAC0A, 0xAC0A,
+  0xABEA, 0xB42B, 0xABEA, 0xABEA, 0xB42B, 0xB44C, 0xB44C, 0xB42B,
+  0xB42B, 0xA3C9, 0xB44B, 0xAC0A, 0xB44B, 0xAC0A, 0xAC0A, 0xABEA,
+  0xB42B, 0xAC0A, 0xABEA, 0xB42B, 0xB44C, 0xBC6C, 0xB42B, 0xB42B,
+  0xA3C9, 0xB44C, 0xABEA, 0xB44B, 0xABEA, 0xAC0A, 0xABEA, 0xB42B,
+  0xAC0A, 0xABEA, 0xB42B, 0xB44B, 0xBC6C, 0xB42B, 0xB42B, 0xA3C9,
+  0xBC6C, 0xABEA, 0xB44B, 0xABEA, 0xAC0A, 0xABEA, 0xB42B, 0xAC0A,
+  0xAC0A, 0xB42B, 0xB44B, 0xBC4C, 0xB42B, 0xB44B, 0xA3CA, 0xBC6C,
+  0xABEA, 0xB44B, 0xABEA, 0xAC0A, 0xA3CA, 0xB44B, 0xAC0A, 0xAC0A,
+  0xB42B, 0xB42B, 0xBC6C, 0xB42B, 0xB44B, 0xA3C9, 0xB44C, 0xABEA,
+  0xB44C, 0xABEA, 0xAC0B, 0xA3CA, 0xB44B, 0xAC0B, 0xAC0A, 0xB42B,
+  0xB42B, 0xBC6C, 0xB42B, 0xB44B, 0xA3C9, 0xB44C, 0xABEA, 0xBC6C,
+  0xABEA, 0xAC0B, 0xA3C9, 0xB42B, 0xAC0B, 0xAC0A, 0xB42B, 0xB44B,
+  0xBC4C, 0xB42B, 0xB44B, 0xA3CA, 0xB42B, 0xABEA, 0xBC4C, 0xABEA,
+  0xAC0B, 0xA3C9, 0xB42B, 0xAC0B, 0xAC0B, 0xB42B, 0xB42B, 0xB44C,
+  0xB42B, 0xB44B, 0xA3CA, 0xB42B, 0xABEA, 0xBC6C, 0xABEA, 0xB40B,
+  0xA3C9, 0xB42B, 0xAC0B, 0xAC0B, 0xB42B, 0xB42B, 0xB44B, 0xB42B,
+  0xB44B, 0xA3C9, 0xB40B, 0xABEA, 0xBC6C, 0xABEA, 0xAC0B, 0xA3C9,
+  0xB42B, 0xB40B, 0xAC0A, 0xB42B, 0xB42B, 0xB44B, 0xB44B, 0xB44B,
+  0xA3C9, 0xAC0B, 0xABEA, 0xBC6C, 0xABCA, 0xB42B, 0xA3A9, 0xB44B,
+  0xB40B, 0xAC0B, 0xB42B, 0xB42B, 0xB42B, 0xB44B, 0xBC6C, 0xA3CA,
+  0xAC0A, 0xABEA, 0xBC6C, 0xABCA, 0xB42B, 0xA3A9, 0xB44B, 0xAC2B,
+  0xAC0A, 0xB42B, 0xB44B, 0xB42B, 0xB44B, 0xBC6C, 0xA3CA, 0xABEA,
+  0xABEA, 0xBC6C, 0xA3C9, 0xAC2B, 0xA3A9, 0xB44B, 0xAC0A, 0xAC0A,
+  0xAC2B, 0xB42B, 0xB42B, 0xB44C, 0xB46C, 0xA3CA, 0x7A85, 0x7A85,
+  0x82C6, 0x7A85, 0x7AA6, 0x7A65, 0x7AA6, 0x7AA6, 0x7AA6, 0x7AA6,
+  0x7AA6, 0x82A6, 0x82C6, 0x82C6, 0x7AA6, 0x61C2, 0x61C3, 0x61C3,
+  0x61C3, 0x61C3, 0x61C2, 0x59C3, 0x61C3, 0x59C3, 0x59A2, 0x59A2,
+  0x59A2, 0x59A2, 0x59A2, 0x6A03, 0x6A24, 0x61E3, 0x61E3, 0x61C3,
+  0x61C3, 0x59C3, 0x59C2, 0x59C2, 0x59A2, 0x59A2, 0x59A2, 0x59A2,
+  0x59A2, 0x59A2, 0x5982, 0x6A03, 0x59C3, 0x59C2, 0x59C3, 0x59C2,
+  0x59C2, 0x59C3, 0x61E3, 0x59C3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x59E3, 0x59C3, 0x61E3, 0x59A2, 0x59A2, 0x59C2, 0x59C2, 0x61C3,
+  0x61C3, 0x61C3, 0x61C3, 0x59C3, 0x59C2, 0x59C2, 0x59C2, 0x59A2,
+  0x59A2, 0x6A04, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61C3,
+  0x6A03, 0x59C3, 0x59C2, 0x59A2, 0x59C2, 0x59A2, 0x59A2, 0x59C2,
+  0x59A2, 0x61C2, 0x61E3, 0x61E3, 0x61C3, 0x61E3, 0x61E3, 0x6A03,
+  0x61C3, 0x59C2, 0x61C3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61C3, 0x59A2, 0x6A24, 0x61E3,
+  0x6203, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x59C2, 0x59A2, 0x5982,
+  0x5181, 0x5982, 0x5982, 0x59A2, 0x5982, 0x61E3, 0x59A2, 0x59A2,
+  0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x59C3, 0x61E3, 0x61E3, 0x6204,
+  0x6203, 0x61E3, 0x59C3, 0x59A2, 0x6A03, 0x61C3, 0x61C2, 0x61E3,
+  0x61C3, 0x61C3, 0x61E3, 0x61C3, 0x61C3, 0x59C2, 0x59A2, 0x61C3,
+  0x61C3, 0x61E3, 0x61C3, 0x61E3, 0x59A2, 0x59C2, 0x61A2, 0x61A2,
+  0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C2, 0x59A2,
+  0x59A2, 0x59A2, 0x6A44, 0x61E3, 0x6203, 0x6203, 0x6203, 0x6203,
+  0x6203, 0x6A03, 0x6A03, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A03,
+  0x61E3, 0x6A03, 0x59C2, 0x59C3, 0x61C3, 0x61C3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x7244, 0x6203, 0x6203, 0x61E3, 0x61E3, 0x61C3, 0x61C3, 0x61C3,
+  0x61C3, 0x61C3, 0x61E3, 0x61E3, 0x61C3, 0x61E3, 0x61C2, 0x9348,
+  0x8B27, 0x9327, 0x8B27, 0x9327, 0x9327, 0x9B68, 0x9327, 0x9348,
+  0x8B07, 0x9348, 0x8B07, 0x82E6, 0x9B69, 0x9348, 0xAC2B, 0xABEA,
+  0xAC2B, 0xAC0A, 0xAC0A, 0xAC0A, 0xBC6C, 0xAC2A, 0xB44B, 0x9B89,
+  0xB44C, 0xA3CA, 0xA3A9, 0xBC8C, 0xAC0B, 0x82E7, 0xBC4B, 0x9B68,
+  0xAC0A, 0xA3A9, 0xABEA, 0xABCA, 0xAC0B, 0x9B89, 0xA3CA, 0xA3CA,
+  0xA3C9, 0xABCA, 0x9B68, 0xB42B, 0x8B07, 0xB44B, 0x9B88, 0xAC0A,
+  0xA3C9, 0xABEA, 0xABCA, 0xAC0B, 0x9B89, 0xA3CA, 0xA3CA, 0xA3C9,
+  0xA3CA, 0x9B68, 0xB42B, 0x8AE7, 0xB44B, 0x9B68, 0xAC0A, 0xA3C9,
+  0xABEA, 0xABEA, 0xAC0B, 0x9B89, 0xA3CA, 0xA3C9, 0xA3C9, 0xA3CA,
+  0x9B68, 0xB42B, 0x8B07, 0xB42B, 0x9B88, 0xAC0A, 0xA3C9, 0xABEA,
+  0xABEA, 0xAC0B, 0x9B89, 0xA3C9, 0xA3C9, 0xA3C9, 0xA3CA, 0x9B89,
+  0xB42B, 0x8B07, 0xB42B, 0x9B88, 0xAC0A, 0xA3CA, 0xABCA, 0xABEA,
+  0xAC0B, 0x9B89, 0xA3A9, 0xA3A9, 0xA3C9, 0xA3CA, 0x9B69, 0xB42B,
+  0x8B07, 0xB42B, 0x9B88, 0xAC0A, 0xA3CA, 0xA3CA, 0xABEA, 0xAC0B,
+  0x9B89, 0xA3C9, 0xA3A9, 0xA3A9, 0xABCA, 0x9B69, 0xB40B, 0x8B07,
+  0xB42B, 0x9B88, 0xABEA, 0xA3CA, 0xABCA, 0xABEA, 0xAC0B, 0x9B89,
+  0xA3A9, 0xA3A9, 0xA3A9, 0xABC9, 0x9B69, 0xB40B, 0x8B07, 0xB42B,
+  0x9B88, 0xABEA, 0xA3EA, 0xA3CA, 0xABEA, 0xAC0B, 0x9B89, 0xA3CA,
+  0xA3A9, 0xA3A9, 0xABCA, 0x9B69, 0xB40B, 0x8B28, 0xB40B, 0x9B88,
+  0xAC0A, 0xA3EA, 0xA3CA, 0xABEA, 0xAC0B, 0x9B89, 0xA3CA, 0xA3A9,
+  0xA389, 0xABC9, 0xA389, 0xAC0A, 0x8B07, 0xB42B, 0x9B88, 0xAC0A,
+  0xA3EA, 0xABCA, 0xABEA, 0xAC0A, 0xA389, 0xA3CA, 0xA3A9, 0xA388,
+  0xA3A9, 0xA389, 0xABEA, 0x8B28, 0xB42B, 0x9B88, 0xAC0A, 0xABEA,
+  0xA3CA, 0xABEA, 0xABEB, 0xA389, 0xA3CA, 0xA3AA, 0x9B89, 0xA3A9,
+  0xA389, 0xABEA, 0x8B27, 0xAC2B, 0xA389, 0xAC0A, 0xABEA, 0xABCA,
+  0xABEA, 0xABEA, 0x9B89, 0xA3C9, 0xA3C9, 0x9B89, 0xA3A9, 0xA3A9,
+  0xABEA, 0x8B27, 0xB42B, 0x9B89, 0xABEA, 0xABEA, 0xA3CA, 0xABEA,
+  0xABEA, 0x9B88, 0xA3C9, 0xA3C9, 0x9B68, 0xA3A9, 0xA3C9, 0xA3CA,
+  0x82C6, 0x82C6, 0x7AA5, 0x82C6, 0x82A6, 0x82C6, 0x82A6, 0x82A6,
+  0x7A85, 0x82A6, 0x82A6, 0x82A5, 0x82C6, 0x82C6, 0x82C6, 0x7A65,
+  0x59A2, 0x59C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3,
+  0x61C3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x9B89, 0x6A04,
+  0x6A04, 0x6A03, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A24, 0x6A04,
+  0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x9368, 0x61E3, 0x6A03,
+  0x6A03, 0x61E3, 0x61E3, 0x61E3, 0x59C3, 0x59A3, 0x59C3, 0x59C3,
+  0x59C3, 0x61E3, 0x6204, 0x6204, 0x9B89, 0x59A2, 0x59C3, 0x59C3,
+  0x61E3, 0x61E3, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E4,
+  0x61E4, 0x61E4, 0x61E3, 0x9B89, 0x61C3, 0x61E4, 0x61E4, 0x61E4,
+  0x59C3, 0x59C3, 0x59C3, 0x59A3, 0x59A2, 0x5182, 0x5182, 0x5182,
+  0x5182, 0x5182, 0x9B89, 0x59A2, 0x59C3, 0x59C3, 0x59C3, 0x59C3,
+  0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59E4, 0x61E4, 0x61E4, 0x61E4,
+  0x6204, 0x9B89, 0x61C3, 0x61C3, 0x59A2, 0x59A2, 0x59A2, 0x59A3,
+  0x59A3, 0x59A3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59A3, 0x59C3,
+  0x9B89, 0x61E3, 0x6204, 0x6A24, 0x6204, 0x61E3, 0x61E4, 0x61E4,
+  0x61C3, 0x59C3, 0x59A3, 0x59A3, 0x51A3, 0x59C3, 0x59C4, 0xA3A9,
+  0x61E3, 0x61E3, 0x61C3, 0x61E3, 0x61E4, 0x61E4, 0x59C3, 0x59C3,
+  0x59C3, 0x61E4, 0x6204, 0x6204, 0x61E4, 0x59C4, 0xA3A9, 0x6A03,
+  0x6A04, 0x6203, 0x61E3, 0x59C3, 0x59A3, 0x59C3, 0x59C3, 0x59E3,
+  0x61E4, 0x61E4, 0x6204, 0x61E4, 0x61E4, 0xA3CA, 0x61E3, 0x6A04,
+  0x6A04, 0x6204, 0x61E4, 0x59C3, 0x51A3, 0x5182, 0x5182, 0x59A3,
+  0x59A2, 0x59C3, 0x6A24, 0x6A44, 0xA3A9, 0x61C2, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x6204, 0x6A04, 0x6A24, 0x6A25, 0x6A24, 0x6A04,
+  0x6A04, 0x61E3, 0x61E3, 0xA3CA, 0x61E3, 0x6A04, 0x6204, 0x61E4,
+  0x6A04, 0x6A04, 0x69E4, 0x6A04, 0x6A04, 0x6203, 0x6203, 0x6203,
+  0x6203, 0x6A03, 0xA3CA, 0x59C2, 0x61E3, 0x61E3, 0x6A04, 0x6A04,
+  0x6A24, 0x7245, 0x7244, 0x7244, 0x7265, 0x7265, 0x7265, 0x7264,
+  0x7244, 0x82E6, 0x8B27, 0x8B27, 0x8B07, 0x9348, 0x8B07, 0x9327,
+  0x8B07, 0x8B07, 0x8AE7, 0x8B07, 0x8AE7, 0x8B07, 0x8B07, 0x8B07,
+  0x7244, 0xA3CA, 0xA3EA, 0xA3C9, 0xAC0B, 0xABEA, 0xABEA, 0xABEA,
+  0xA3CA, 0xA3A9, 0xABEA, 0xA3A9, 0x9B89, 0xA389, 0xA3A9, 0x6204,
+  0x8B07, 0xABEA, 0xA3C9, 0xABEA, 0x9B68, 0xA389, 0x9B89, 0x9B68,
+  0xA389, 0xABEA, 0x9B88, 0xA3CA, 0x9B48, 0xAC0B, 0x6A24, 0x8B07,
+  0xABEA, 0xA3C9, 0xABCA, 0x9B88, 0x9B89, 0x9B89, 0x9B68, 0x9B89,
+  0xABEA, 0x9B68, 0xA3CA, 0x9B68, 0xAC0A, 0x61E4, 0x8AE7, 0xA3CA,
+  0xA3C9, 0xA3CA, 0x9B88, 0x9B88, 0x9B89, 0x9B68, 0xA389, 0xABEA,
+  0x9B68, 0xA3CA, 0x9B68, 0xAC0A, 0x5162, 0x82E7, 0xA3CA, 0xA3A9,
+  0xA3CA, 0x9B68, 0x9B68, 0xA389, 0x9B68, 0xA3A9, 0xABEA, 0x9B68,
+  0xA3C9, 0x9B68, 0xAC0A, 0x61E4, 0x8B08, 0xA3CA, 0xA3A9, 0xA3AA,
+  0x9B68, 0x9B68, 0x9B89, 0x9B68, 0xA3A9, 0xABEA, 0x9B68, 0xA3C9,
+  0x9B88, 0xAC0A, 0x59C3, 0x8B07, 0xA3CA, 0xA3C9, 0xA3A9, 0x9B69,
+  0x9B68, 0x9B89, 0x9B68, 0xA3A9, 0xABEA, 0x9B68, 0xA3A9, 0x9B88,
+  0xAC0A, 0x59A3, 0x82E7, 0xA3CA, 0xA3C9, 0xA3A9, 0x9B68, 0x9B68,
+  0x9B89, 0x9B68, 0xA3A9, 0xABEA, 0x9B68, 0xA3A9, 0x9B88, 0xAC0A,
+  0x59C4, 0x8B08, 0xA3C9, 0xA3C9, 0xA3A9, 0x9B68, 0x9B68, 0x9B89,
+  0x9B68, 0xA3A9, 0xABCA, 0x9B69, 0xA3A9, 0x9B89, 0xAC0A, 0x59C3,
+  0x8AE7, 0xA3A9, 0xA3C9, 0x9B89, 0x9B69, 0x9B68, 0x9B89, 0x9B68,
+  0xA389, 0xABEA, 0x9B69, 0xA3A9, 0x9B89, 0xAC0B, 0x7245, 0x9328,
+  0xA3A9, 0xA3C9, 0x9B89, 0x9B68, 0x9B68, 0x9B89, 0x9B68, 0xA389,
+  0xABCA, 0x9B69, 0xA3A9, 0xA3A9, 0xAC0A, 0x61E3, 0x8AE7, 0xA3A9,
+  0xA3C9, 0x9B69, 0x9B69, 0x9B89, 0x9B89, 0x9B68, 0xA389, 0xABEA,
+  0x9B89, 0xA3A9, 0xA3A9, 0xAC0A, 0x6A04, 0x8B08, 0xA3A9, 0xA3C9,
+  0x9B69, 0x9B68, 0x9B88, 0x9B88, 0x9B68, 0xA3A9, 0xABEA, 0x9B68,
+  0xA3A9, 0xA3A9, 0xAC0A, 0x6A04, 0x8B07, 0xA3A9, 0xA3AA, 0x9B68,
+  0x9B68, 0x9B88, 0x9B89, 0x9B68, 0xA3A9, 0xA3CA, 0x9B68, 0xA389,
+  0xA3A9, 0xAC0A, 0x8AE7, 0x82A6, 0x7A86, 0x7A65, 0x7A65, 0x82C6,
+  0x7AA6, 0x7265, 0x7265, 0x7AA6, 0x7AA6, 0x7265, 0x7A86, 0x7A86,
+  0x82C7, 0xA3CA, 0x7285, 0x59A3, 0x5983, 0x59C3, 0x61E4, 0x6A25,
+  0x7265, 0x6224, 0x59A3, 0x5182, 0x59A3, 0x5183, 0x5182, 0x59A3,
+  0xB44C, 0xAC0B, 0xAC0B, 0xB42B, 0xAC0B, 0xBC4C, 0xABEA, 0xB42B,
+  0xB44C, 0xABEA, 0xBC4B, 0xABEA, 0xB42B, 0x82E7, 0x59A2, 0xB44B,
+  0xAC0B, 0xAC0B, 0xB42B, 0xABEA, 0xB44C, 0xABEA, 0xB42B, 0xB44B,
+  0xABEA, 0xBC6C, 0xABEA, 0xB42B, 0x8AE6, 0x61C2, 0xB44B, 0xB42B,
+  0xAC0A, 0xB42B, 0xABEA, 0xB42B, 0xAC0A, 0xB42B, 0xB42B, 0xAC0B,
+  0xBC6C, 0xABEA, 0xB42B, 0x8AE6, 0x61A2, 0xB42B, 0xB44B, 0xABEA,
+  0xB44B, 0xA3CA, 0xB42B, 0xB42B, 0xB42B, 0xB42B, 0xB42B, 0xB44B,
+  0xABEA, 0xB42B, 0x8AE6, 0x61C2, 0xB42B, 0xBC6C, 0xA3CA, 0xB44B,
+  0xA3CA, 0xB42B, 0xB40B, 0xB42B, 0xB42B, 0xB42B, 0xB44B, 0xABEA,
+  0xB42B, 0x8B07, 0x61C2, 0xB42B, 0xBC6C, 0xA3C9, 0xBC4C, 0xA3C9,
+  0xB42B, 0xAC0B, 0xAC0B, 0xB42B, 0xB42B, 0xB44B, 0xABEA, 0xB40B,
+  0x8B07, 0x61C2, 0xB40B, 0xBC6C, 0xA3C9, 0xBC4C, 0xA3A9, 0xB42B,
+  0xAC0B, 0xABEA, 0xB42B, 0xB44B, 0xB44B, 0xABEA, 0xAC0B, 0x8B07,
+  0x61C2, 0xB40B, 0xBC8C, 0xA3C9, 0xB44C, 0xA3C9, 0xB42B, 0xB40B,
+  0xABEA, 0xB42B, 0xB42B, 0xB44B, 0xABEA, 0xAC0B, 0x8B07, 0x61C2,
+  0xAC0B, 0xBC8C, 0xA3CA, 0xB42B, 0xABCA, 0xB42B, 0xB42B, 0xA3CA,
+  0xB42B, 0xB42B, 0xB42B, 0xABEA, 0xAC0B, 0x8B07, 0x61C2, 0xAC0B,
+  0xBC8C, 0xABEA, 0xB42B, 0xABCA, 0xB44B, 0xB40B, 0xA3CA, 0xB42B,
+  0xB42B, 0xB42B, 0xAC0A, 0xAC0B, 0x8AE6, 0x61C2, 0xAC0B, 0xBC6C,
+  0xABEA, 0xAC0B, 0xABEA, 0xB44B, 0xAC0B, 0xABEA, 0xB42B, 0xB42B,
+  0xB42B, 0xAC0A, 0xAC0B, 0x8AE6, 0x61C2, 0xB40B, 0xBC6C, 0xAC0A,
+  0xABEA, 0xABEA, 0xB42B, 0xAC0A, 0xABEA, 0xB42B, 0xB42B, 0xB42B,
+  0xAC0B, 0xAC0B, 0x8AE6, 0x61C2, 0xB42B, 0xB44C, 0xB42B, 0xABEA,
+  0xAC0B, 0xB42B, 0xAC0B, 0xABEA, 0xB42B, 0xB44B, 0xB42B, 0xB42B,
+  0xB42B, 0x82E6, 0x61C2, 0xA3A9, 0xABEA, 0xA3A9, 0x9B68, 0xA3A9,
+  0xA3CA, 0xA3A9, 0x9B89, 0xA3C9, 0xA3CA, 0xA3A9, 0xA3A9, 0xA3AA,
+  0x82C6, 0x6A23, 0x61A2, 0x61A2, 0x61A2, 0x61C2, 0x61A2, 0x61C2,
+  0x61A2, 0x61A2, 0x61A2, 0x61A2, 0x61A2, 0x61C2, 0x61A2, 0x82C6,
+  0xAC0B, 0x61E3, 0x59C2, 0x59C2, 0x61C2, 0x61C2, 0x61C2, 0x59C2,
+  0x59C2, 0x59C2, 0x59C2, 0x59C2, 0x59C2, 0x59C2, 0x59A1, 0xBC8D,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x59A1, 0xBC8C, 0x61C2,
+  0x59C2, 0x61C2, 0x61C2, 0x59A2, 0x59A2, 0x59A2, 0x61C2, 0x59A2,
+  0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x59A1, 0xBC8C, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0xBCAC, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x59A1, 0xBC8C, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0xBC8C, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0xBC8C, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x59A1,
+  0xBC8C, 0x61C2, 0x61E3, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61E3, 0x61E3, 0x61E3, 0x61C2, 0xBC8C,
+  0x61E3, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61E3, 0x61C2, 0xBC8C, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x59A2, 0xBC8C, 0x61E3, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x59A2, 0xBC6C, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0xBC6C, 0x7244, 0x6A23, 0x7223, 0x7223,
+  0x7223, 0x6A03, 0x7223, 0x6A23, 0x6A23, 0x6A23, 0x6A23, 0x6A23,
+  0x6A23, 0x6A03, 0xABEA, 0xBC8D, 0xAC0A, 0xB42B, 0xB42B, 0xB44C,
+  0xA3CA, 0xB44C, 0xB44C, 0xAC0B, 0xAC0B, 0xAC0B, 0xB42B, 0xB42B,
+  0xAC0B, 0x5981, 0xBC6C, 0xA3A9, 0xB40B, 0xAC0A, 0xBC6C, 0xB42B,
+  0xB42B, 0xB42B, 0xABCA, 0xB44B, 0xA3C9, 0xB42B, 0xA3A9, 0xB42B,
+  0x7265, 0xBC6C, 0xA3A9, 0xB40B, 0xABEA, 0xBC6C, 0xB42B, 0xB42B,
+  0xAC0B, 0xABCA, 0xB44B, 0xA3A9, 0xB42B, 0xA3A9, 0xB42B, 0x7A64,
+  0xBC6C, 0xA3A9, 0xB42B, 0xABEA, 0xB44B, 0xB42B, 0xB42B, 0xAC0B,
+  0xA3CA, 0xB44B, 0xA3A9, 0xB42B, 0xA3A9, 0xB42B, 0x7A65, 0xBC6C,
+  0xA3A9, 0xB40B, 0xAC0A, 0xB44B, 0xB42B, 0xB42B, 0xB40B, 0xA3CA,
+  0xB44B, 0xA3A9, 0xB42B, 0xA3A9, 0xB42A, 0x7A65, 0xBC6C, 0xABC9,
+  0xB40B, 0xAC0A, 0xBC6B, 0xB42B, 0xB42B, 0xB40B, 0xA3CA, 0xB44C,
+  0xA3A9, 0xB40B, 0xA3A9, 0xB42B, 0x7A85, 0xBC6B, 0xABC9, 0xB40B,
+  0xAC0A, 0xBC6B, 0xB42B, 0xB42B, 0xB40B, 0xA3CA, 0xBC6C, 0xA3A9,
+  0xAC0B, 0xABCA, 0xAC0A, 0x7A65, 0xBC6B, 0xABC9, 0xB40B, 0xAC0A,
+  0xB44B, 0xB42B, 0xB42B, 0xB40B, 0xA3C9, 0xBC6C, 0xA3A9, 0xABEB,
+  0xABEA, 0xAC0A, 0x7A65, 0xBC6C, 0xABCA, 0xAC0B, 0xABEA, 0xB46B,
+  0xB42B, 0xAC0B, 0xAC0B, 0xA3CA, 0xBC6C, 0xA3A9, 0xABEA, 0xAC0A,
+  0xAC0A, 0x7A85, 0xBC6C, 0xA3CA, 0xB40B, 0xAC0A, 0xBC6C, 0xAC2B,
+  0xAC0B, 0xAC0B, 0xA3C9, 0xBC6C, 0xA3A9, 0xABEA, 0xAC0B, 0xAC0A,
+  0x7A65, 0xBC6C, 0xA3A9, 0xB40B, 0xAC0A, 0xB46B, 0xAC0B, 0xAC0A,
+  0xAC0B, 0xA3CA, 0xB44B, 0xA3C9, 0xA3CA, 0xB42B, 0xAC0A, 0x7A85,
+  0xBC6C, 0xA3A9, 0xAC0B, 0xABEA, 0xB46B, 0xAC0A, 0xAC0A, 0xB40B,
+  0xA3CA, 0xB42B, 0xA3CA, 0xA3CA, 0xB44B, 0xAC0A, 0x7264, 0xBC6B,
+  0xA3A9, 0xAC0B, 0xAC0A, 0xB46B, 0xAC0A, 0xAC0A, 0xB42B, 0xA3CA,
+  0xB42B, 0xA3CA, 0xA3CA, 0xB44B, 0xABEA, 0x7A85, 0xBC6C, 0xA3A9,
+  0xAC0B, 0xAC0A, 0xBC6C, 0xAC0B, 0xAC0A, 0xB42B, 0xABCA, 0xB42B,
+  0xABEA, 0xA3CA, 0xBC6C, 0xAC0A, 0x7AA5, 0xA3EA, 0x9B68, 0xA3A9,
+  0xA3A9, 0xABEA, 0xA3A9, 0x9B89, 0xA3A9, 0x9B89, 0xA3A9, 0x9B89,
+  0x9B88, 0xA3EA, 0x9BA9, 0x7A65, 0x59A1, 0x59A1, 0x59A1, 0x59A2,
+  0x5981, 0x59A2, 0x5981, 0x59A2, 0x61A2, 0x59A2, 0x59A1, 0x59A2,
+  0x59A1, 0x5981, 0x8AE7, 0x59A2, 0x59C2, 0x59C2, 0x59C2, 0x59C2,
+  0x61C2, 0x59C2, 0x59C2, 0x59C2, 0x59C2, 0x59C2, 0x61C3, 0x59E3,
+  0x61C3, 0x6A03, 0x59A2, 0x59C2, 0x59C2, 0x59C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61E3, 0x61C2, 0x61C3,
+  0x6A03, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x59C2, 0x59C2, 0x59A2,
+  0x59A2, 0x59C2, 0x59A2, 0x59C2, 0x61C2, 0x61C2, 0x61C3, 0x6A03,
+  0x61C2, 0x61C3, 0x61C3, 0x61C2, 0x61C3, 0x61E3, 0x61E3, 0x61C3,
+  0x61C3, 0x61C3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x6A03, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x6A03, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x6A24, 0x61C2, 0x59C2,
+  0x59C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C3, 0x61C2, 0x61C2,
+  0x61C2, 0x61E2, 0x61E3, 0x61E3, 0x6A04, 0x59A2, 0x59C2, 0x61C2,
+  0x61C2, 0x61C2, 0x59C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x6A03, 0x61C3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61C3, 0x61C2,
+  0x61E3, 0x61C3, 0x6A03, 0x61C2, 0x61C3, 0x61E3, 0x61C3, 0x61C3,
+  0x61C3, 0x61C2, 0x61C2, 0x61C3, 0x61C3, 0x61C2, 0x61E3, 0x61E2,
+  0x61C3, 0x6A04, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61C3, 0x61C3, 0x61C3, 0x61E2, 0x61C3,
+  0x6A24, 0x5981, 0x59A2, 0x59A2, 0x5982, 0x59A2, 0x59A2, 0x5982,
+  0x5982, 0x59A2, 0x59A2, 0x59A2, 0x61C2, 0x61C2, 0x61C2, 0x6A24,
+  0x61C2, 0x61C2, 0x61C3, 0x61C3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x7224, 0x61E3,
+  0x61E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x7224, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A23, 0x6A23, 0x6A23, 0x7244,
+  0x7224, 0x7244, 0x7244, 0x6A24, 0x7A85, 0xA3EA, 0xAC0B, 0xAC0B,
+  0xB42B, 0xAC0B, 0xAC0B, 0xB44B, 0xB42B, 0xA3C9, 0xB44B, 0xAC0A,
+  0xB42B, 0xBC6C, 0xB42B, 0xA3CA, 0xAC2B, 0xABEA, 0xB42B, 0xAC0A,
+  0xABEA, 0xAC0A, 0xBC6C, 0xAC0A, 0xB42B, 0x9B88, 0xBC4C, 0xA3A9,
+  0xA3A9, 0xBC6C, 0xAC0B, 0xAC2B, 0xABEA, 0xB42B, 0xAC0A, 0xABEA,
+  0xAC0B, 0xB44C, 0xB42B, 0xB42B, 0x9B88, 0xBC6C, 0xA3A9, 0xA3C9,
+  0xBC6C, 0xABEA, 0xAC2B, 0xABEA, 0xB42B, 0xAC0A, 0xABEA, 0xAC0A,
+  0xB44B, 0xB42B, 0xAC2B, 0x9B89, 0xBC6C, 0xA3A9, 0xABEA, 0xBC6C,
+  0xABEA, 0xAC2B, 0xABEA, 0xB42B, 0xAC0A, 0xABEA, 0xAC0A, 0xB44B,
+  0xB42B, 0xAC0B, 0xA389, 0xBC6C, 0xA389, 0xAC0A, 0xBC6C, 0xABEA,
+  0xAC2B, 0xABEA, 0xB42B, 0xAC0A, 0xA3EA, 0xAC0A, 0xB44B, 0xB42B,
+  0xAC0B, 0xA3A9, 0xBC6C, 0xA3A9, 0xAC0B, 0xBC6C, 0xABEA, 0xAC2B,
+  0xABEA, 0xB42B, 0xAC0A, 0xABEA, 0xAC0B, 0xB44B, 0xB44B, 0xAC0A,
+  0xA3C9, 0xB44C, 0xA389, 0xB42B, 0xBC6C, 0xA3CA, 0xAC2B, 0xABEA,
+  0xB40B, 0xAC0A, 0xABEA, 0xAC0B, 0xB42B, 0xB44B, 0xAC0B, 0xABCA,
+  0xB44C, 0x9B88, 0xB42B, 0xBC6C, 0xABCA, 0xAC0B, 0xABEA, 0xB40B,
+  0xAC0A, 0xABEA, 0xB42B, 0xB40B, 0xBC4C, 0xAC0A, 0xABEA, 0xB44C,
+  0x9B88, 0xB44B, 0xBC8C, 0xA3CA, 0xAC2B, 0xABEA, 0xB40B, 0xAC0A,
+  0xABEA, 0xB42B, 0xAC0A, 0xBC6C, 0xAC0A, 0xAC0A, 0xB44B, 0x9B68,
+  0xBC6C, 0xBC8C, 0xA3CA, 0xAC0B, 0xABEA, 0xAC0B, 0xAC0A, 0xABEA,
+  0xB42B, 0xAC0A, 0xBC6C, 0xAC0A, 0xAC0A, 0xB42B, 0x9B88, 0xBC6C,
+  0xBC8C, 0xA3C9, 0xAC0B, 0xABEA, 0xB40B, 0xAC0B, 0xABEA, 0xB42B,
+  0xABEA, 0xBC6C, 0xAC0A, 0xAC0A, 0xB42B, 0x9B88, 0xBC6C, 0xBC6C,
+  0xA3CA, 0xAC0A, 0xAC0A, 0xB40B, 0xAC0A, 0xABEA, 0xB42B, 0xABEA,
+  0xBC6C, 0xABEA, 0xB40B, 0xB42B, 0x9B68, 0xBC8C, 0xBC6C, 0xA3CA,
+  0xAC0B, 0xAC0B, 0xAC0B, 0xABEA, 0xAC0A, 0xB42B, 0xAC0A, 0xBC6C,
+  0xAC0A, 0xB42B, 0xB42B, 0x9B68, 0xBC8C, 0xBC8C, 0xA3CA, 0x9B89,
+  0x9BA9, 0x9BA9, 0x9B89, 0x9B89, 0xA3A9, 0x9B89, 0xABEA, 0x9B89,
+  0xA3A9, 0xA3CA, 0x9327, 0xAC0B, 0xB42B, 0x9B89, 0x61C2, 0x59A2,
+  0x59C2, 0x59C2, 0x61C2, 0x59C2, 0x59A2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x59A2, 0x59A2, 0x5981, 0x7265, 0x59A2, 0x59C3,
+  0x59A3, 0x59A3, 0x59A3, 0x59A2, 0x59A2, 0x59C2, 0x59C3, 0x59C3,
+  0x59C3, 0x59C3, 0x59C3, 0x61C3, 0x7AA5, 0x61E3, 0x6204, 0x6204,
+  0x6204, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6204,
+  0x61E4, 0x61E4, 0x61E4, 0x7AA6, 0x6203, 0x61E3, 0x61E3, 0x61C3,
+  0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x61E3, 0x59E3, 0x61C3, 0x59C3,
+  0x59C3, 0x59C3, 0x7A85, 0x59C3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E4, 0x6204, 0x6204,
+  0x6204, 0x7A85, 0x59C3, 0x61C3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61C3, 0x61C3, 0x61C3, 0x59C3, 0x59C3,
+  0x7AA6, 0x6204, 0x6204, 0x6A03, 0x6204, 0x6204, 0x69E4, 0x6A04,
+  0x6A04, 0x6A04, 0x61E4, 0x61E4, 0x61E4, 0x61E3, 0x61E3, 0x7A85,
+  0x59C3, 0x59C3, 0x61C2, 0x61C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3,
+  0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x7AA6, 0x61E3,
+  0x6203, 0x61E3, 0x61E3, 0x6204, 0x6204, 0x6204, 0x6204, 0x6204,
+  0x6A04, 0x61E4, 0x61E4, 0x61E4, 0x61E3, 0x7A85, 0x59C3, 0x59C3,
+  0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3,
+  0x61C3, 0x61E3, 0x61E3, 0x61E3, 0x7A85, 0x59C3, 0x59C3, 0x61C3,
+  0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3,
+  0x59C3, 0x59C3, 0x59C3, 0x7A85, 0x61E3, 0x61E3, 0x61E3, 0x6204,
+  0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x6A04, 0x6A04, 0x6A04,
+  0x6204, 0x6204, 0x7A85, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E3, 0x61E4, 0x6204,
+  0x61E4, 0x7A85, 0x59A2, 0x59C3, 0x59A2, 0x59A2, 0x59C3, 0x59C3,
+  0x59C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61E3, 0x61E3,
+  0x7AA6, 0x6A23, 0x6A24, 0x6A24, 0x6A24, 0x6A44, 0x6A44, 0x7244,
+  0x7244, 0x6A44, 0x7244, 0x7244, 0x7244, 0x7224, 0x7224, 0x8B27,
+  0xBC6C, 0xABEA, 0xAC2B, 0xA3EA, 0xAC0A, 0xABCA, 0xB42B, 0xA3CA,
+  0xABCA, 0xABCA, 0xA3C9, 0xAC0B, 0x9B8A, 0xA3CA, 0x7224, 0xA3A9,
+  0xABEA, 0xA3A9, 0xABEA, 0xA3CA, 0xA3A9, 0xABCA, 0xABEA, 0xA3A9,
+  0xABEA, 0xA3A9, 0x9B89, 0xA389, 0xA389, 0x7245, 0x9BA9, 0xABEA,
+  0xA3A9, 0xABEA, 0xA3CA, 0xA3A9, 0xABCA, 0xABEA, 0xA3A9, 0xAC0A,
+  0xA3A9, 0x9B89, 0x9B89, 0xA3A9, 0x7245, 0x9BA9, 0xABEA, 0xA3A9,
+  0xABEA, 0xABEA, 0xA389, 0xA3CA, 0xAC0A, 0xA3A9, 0xAC0B, 0xA3A9,
+  0x9B89, 0x9B89, 0xA3A9, 0x7265, 0x9B88, 0xABEA, 0xA3A9, 0xABCA,
+  0xABEA, 0x9B88, 0xA3CA, 0xAC0B, 0xA3A9, 0xAC0A, 0xA3A9, 0xA389,
+  0x9B89, 0xA389, 0x7224, 0xA3A9, 0xABEA, 0xA3A9, 0xA3CA, 0xABEA,
+  0x9B68, 0xA3CA, 0xB40B, 0xA3A9, 0xABEA, 0xA3C9, 0xA3A9, 0x9B88,
+  0xA3A9, 0x7245, 0xA3C9, 0xABCA, 0xA3A9, 0xA3CA, 0xABEA, 0x9B68,
+  0xABCA, 0xB42B, 0xA3A9, 0xABEA, 0xA3C9, 0xA3A9, 0x9B89, 0xA389,
+  0x6A24, 0xA3CA, 0xA3CA, 0xA3A9, 0xA3C9, 0xABEA, 0x9B68, 0xABEA,
+  0xB42B, 0xA389, 0xA3CA, 0xA3C9, 0xA3C9, 0x9B88, 0xA389, 0x7244,
+  0xABEA, 0xA3A9, 0xA3A9, 0xA3A9, 0xABEA, 0x9B89, 0xABEA, 0xB42B,
+  0xA389, 0xA3CA, 0xA3A9, 0xA3A9, 0x9B89, 0xA3A9, 0x7244, 0xABEA,
+  0xA3A9, 0xA3C9, 0xA389, 0xABEA, 0xA3A9, 0xA3CA, 0xB40B, 0xA3A9,
+  0xA3C9, 0xA3A9, 0xA3CA, 0x9B89, 0xA3A9, 0x6A24, 0xAC0A, 0xA3A9,
+  0xA3CA, 0x9B89, 0xABEA, 0xA3C9, 0xA3CA, 0xB40B, 0xA3A9, 0xA3A9,
+  0xA3A9, 0xABCA, 0x9B68, 0xABC9, 0x7265, 0xAC0B, 0x9B89, 0xABEA,
+  0x9B68, 0xABEA, 0xA3A9, 0xA3CA, 0xB40B, 0xA3A9, 0xA3A9, 0xA3A9,
+  0xABEA, 0x9B68, 0xA3A9, 0x7265, 0xB42B, 0x9B89, 0xABEA, 0x9B88,
+  0xABEA, 0xA3C9, 0xA3CA, 0xAC0A, 0xA3A9, 0xA3A9, 0xA3A9, 0xABEA,
+  0x9B68, 0xA3A9, 0x6A44, 0xB42C, 0xA389, 0xABEA, 0x9B88, 0xABEA,
+  0xA3CA, 0xA3CA, 0xAC0A, 0xA3A9, 0xA3A9, 0xA3C9, 0xABEA, 0x9B89,
+  0xA3CA, 0x7A85, 0xA3CA, 0x9327, 0x9B88, 0x9327, 0x9B89, 0x9B89,
+  0x9B89, 0xA3AA, 0x9B69, 0x9B69, 0x9B69, 0x9B69, 0x8B07, 0x9328,
+  0x9B89, 0x59A2, 0x61E4, 0x6204, 0x6204, 0x61E3, 0x61E3, 0x61E4,
+  0x61E3, 0x61E3, 0x61E3, 0x61C3, 0x61E3, 0x61E3, 0x61C4, 0xA3CA,
+  0x61E3, 0x5163, 0x5183, 0x59E3, 0x59C3, 0x5982, 0x5982, 0x61E3,
+  0x7245, 0x7266, 0x6225, 0x6A45, 0x6A45, 0x6205, 0xA3C9, 0x7A65,
+  0x6A04, 0x6A25, 0x7245, 0x7265, 0x7A85, 0x7245, 0x7245, 0x7265,
+  0x6A45, 0x6A25, 0x6204, 0x61E3, 0x61C3, 0xA3CA, 0x7A65, 0x6A04,
+  0x6A24, 0x6A24, 0x6A24, 0x7224, 0x7A85, 0x61E3, 0x5161, 0x5182,
+  0x59C3, 0x6203, 0x6224, 0x6A24, 0xA3CA, 0x7A85, 0x6A25, 0x7225,
+  0x7244, 0x6A24, 0x6A24, 0x6A24, 0x7245, 0x6A25, 0x61C4, 0x6A04,
+  0x7A66, 0x7245, 0x7245, 0xA3CA, 0x7245, 0x61C4, 0x61E4, 0x6A24,
+  0x6A04, 0x6A24, 0x6A24, 0x7266, 0x59C3, 0x51A3, 0x6204, 0x5182,
+  0x5182, 0x51A3, 0xA3CA, 0x7265, 0x61E4, 0x61E4, 0x59A2, 0x59A3,
+  0x61C3, 0x61E3, 0x5182, 0x4962, 0x6205, 0x6A46, 0x6A46, 0x61E4,
+  0x61E4, 0xA3EA, 0x7245, 0x59C4, 0x6204, 0x6A45, 0x6A24, 0x6A25,
+  0x6A25, 0x59E4, 0x5183, 0x4142, 0x4121, 0x4942, 0x59C4, 0x6A25,
+  0xA3EA, 0x6A24, 0x51A3, 0x51A3, 0x59A3, 0x61C3, 0x61E3, 0x6204,
+  0x61E4, 0x59C4, 0x59C4, 0x51A3, 0x4962, 0x4982, 0x4962, 0xA3CA,
+  0x7265, 0x6204, 0x6204, 0x6204, 0x6A04, 0x6A04, 0x6204, 0x6A04,
+  0x6A24, 0x6A25, 0x6A25, 0x6A25, 0x6A25, 0x6A45, 0xA3CA, 0x7244,
+  0x61E4, 0x61E4, 0x61E3, 0x61E4, 0x59C3, 0x59C3, 0x61C3, 0x61E3,
+  0x61E4, 0x69E3, 0x61E3, 0x61C3, 0x59A3, 0xABCA, 0x7244, 0x61E3,
+  0x69E4, 0x6A04, 0x6204, 0x6A45, 0x7245, 0x7245, 0x7245, 0x7245,
+  0x6A24, 0x6A04, 0x61E4, 0x6A24, 0xA3EA, 0x7A85, 0x7245, 0x7245,
+  0x7265, 0x7245, 0x7245, 0x7245, 0x7245, 0x6A25, 0x6A45, 0x7265,
+  0x7266, 0x6A25, 0x7265, 0xA3CA, 0x7A85, 0x6A04, 0x6A24, 0x6A04,
+  0x69E4, 0x61E3, 0x61E3, 0x61E3, 0x6204, 0x6204, 0x59E4, 0x61E4,
+  0x6204, 0x61E4, 0x9369, 0x7264, 0x6A03, 0x61E3, 0x6A04, 0x6A24,
+  0x7265, 0x7265, 0x7265, 0x7265, 0x7A65, 0x7A65, 0x7265, 0x7A65,
+  0x7A66, 0x61C3, 0x9369, 0xA3CA, 0x9BA9, 0xA3C9, 0xA389, 0xA3CA,
+  0xA3C9, 0x9B89, 0xA3A9, 0xA3A9, 0xA3CA, 0x9B88, 0xA3A9, 0xB42B,
+  0x61C2, 0x61C2, 0x61C3, 0x61C2, 0x61E3, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x82C6, 0xABEA, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61C2, 0x61C2, 0x61C2, 0x61C3, 0x61E3,
+  0x61E3, 0x61E3, 0x61C3, 0x61C2, 0x82C6, 0xABEA, 0x61C2, 0x61C2,
+  0x61E3, 0x61E3, 0x61C3, 0x61C3, 0x69E3, 0x69E3, 0x69E3, 0x69E3,
+  0x61E3, 0x61E3, 0x61E2, 0x82C6, 0xABEA, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C3, 0x61C3, 0x61E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3,
+  0x69E3, 0x69E3, 0x82C6, 0xABEA, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61C3, 0x61E3, 0x61E3, 0x61C3, 0x61E3, 0x61C3,
+  0x69E3, 0x82C6, 0xABEA, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C3, 0x61C3, 0x69E3, 0x69E3, 0x69E3, 0x69E3,
+  0x82C6, 0xAC0A, 0x61C2, 0x61C2, 0x61E3, 0x61E3, 0x61E3, 0x69E3,
+  0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x61E3, 0x61C2, 0x82C6,
+  0xABEA, 0x6A03, 0x6A03, 0x61E3, 0x6A03, 0x69E3, 0x69E3, 0x69E3,
+  0x69E3, 0x61E3, 0x61C3, 0x61C3, 0x61E3, 0x69E3, 0x8AE6, 0xABEA,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x69E3, 0x69E3,
+  0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x61E3, 0x8AE6, 0xABEA, 0x6A03,
+  0x61E3, 0x69E3, 0x61E3, 0x69E3, 0x6A03, 0x69E3, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x8AE6, 0xAC0A, 0x61E3, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x69E3, 0x61E3, 0x61E3, 0x61E2, 0x61C3,
+  0x61C3, 0x61C3, 0x61C2, 0x82C6, 0xAC0B, 0x61E3, 0x69E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x82C6, 0xB40B, 0x61E3, 0x61C2, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E2, 0x82C6, 0xB42B, 0x61C2, 0x61A2, 0x61A2, 0x61C2, 0x61A2,
+  0x61C2, 0x61E2, 0x61E2, 0x61E2, 0x61E2, 0x61C2, 0x61C2, 0x61C2,
+  0x82A5, 0xB44C, 0xA3A9, 0xA3A9, 0xABEA, 0xA3A9, 0xA3A9, 0xA3A9,
+  0xAC0B, 0xA3A9, 0xA3A9, 0xA3CA, 0xA3A9, 0xABEA, 0xA3A9, 0x8AE6,
+  0x6A24, 0xBC6C, 0xABEA, 0xABEA, 0xAC0A, 0xB42B, 0xA3A9, 0xB42B,
+  0xB42B, 0xABEA, 0xABEA, 0xABEA, 0xB40B, 0xAC0B, 0xA3EA, 0x59A1,
+  0xBC6C, 0xABEA, 0xABEA, 0xAC0A, 0xB42B, 0xA3A9, 0xB44B, 0xB42B,
+  0xABEA, 0xABEA, 0xABEA, 0xAC0A, 0xB42A, 0xABEA, 0x59C2, 0xBC8C,
+  0xABEA, 0xABEA, 0xAC0A, 0xB42B, 0xA3A9, 0xB42B, 0xB42B, 0xAC0A,
+  0xA3C9, 0xABEA, 0xAC0A, 0xB42B, 0xABEA, 0x61C2, 0xBC8C, 0xABEA,
+  0xABEA, 0xAC0A, 0xB42B, 0xA3C9, 0xB42B, 0xB42B, 0xAC0A, 0xA3CA,
+  0xABEA, 0xABEA, 0xB42B, 0xABEA, 0x59A1, 0xBC6C, 0xA3CA, 0xABEA,
+  0xABEA, 0xB42B, 0xABCA, 0xAC0B, 0xB42B, 0xAC0B, 0xA3CA, 0xABEA,
+  0xABEA, 0xB42B, 0xABEA, 0x61C2, 0xBC6C, 0xA3CA, 0xAC0A, 0xABEA,
+  0xB42B, 0xABEA, 0xAC0A, 0xB42B, 0xAC0A, 0xA3C9, 0xAC0A, 0xABCA,
+  0xAC0B, 0xABCA, 0x61A2, 0xBC6C, 0xA3CA, 0xAC0B, 0xABEA, 0xB42B,
+  0xABEA, 0xABEA, 0xB42B, 0xAC0B, 0xA3A9, 0xAC0A, 0xABEA, 0xAC0B,
+  0xABEA, 0x69E3, 0xBC6C, 0xA3CA, 0xAC0A, 0xABEA, 0xB40B, 0xABEA,
+  0xABEA, 0xB42B, 0xAC0B, 0xA3A9, 0xAC0A, 0xABEA, 0xB40B, 0xABEA,
+  0x61C2, 0xBC4C, 0xABCA, 0xABEA, 0xAC0A, 0xAC0A, 0xAC0A, 0xABEA,
+  0xB42B, 0xAC0B, 0xA3A9, 0xAC0A, 0xABCA, 0xAC0A, 0xABEA, 0x61A2,
+  0xB44B, 0xABEA, 0xABEA, 0xAC0A, 0xAC0A, 0xAC0A, 0xA3CA, 0xB42B,
+  0xAC0B, 0xA3A9, 0xAC0A, 0xA3CA, 0xAC0A, 0xABEA, 0x61C2, 0xB44B,
+  0xABEA, 0xABEA, 0xB42B, 0xABEA, 0xAC0A, 0xA3EA, 0xB42B, 0xAC0B,
+  0xA3A9, 0xAC0A, 0xA3C9, 0xAC0A, 0xAC0A, 0x61C2, 0xB42B, 0xABEA,
+  0xABEA, 0xB44B, 0xABEA, 0xAC0A, 0xABEA, 0xB42B, 0xAC0A, 0xA3C9,
+  0xAC0A, 0xA3C9, 0xAC0A, 0xB42B, 0x61C2, 0xAC0A, 0xABEA, 0xABEA,
+  0xB42B, 0xA3C9, 0xAC0A, 0xABEA, 0xB42B, 0xAC0A, 0xA3A9, 0xAC0A,
+  0xABCA, 0xABEA, 0xB42B, 0x61C2, 0xAC0B, 0xABEA, 0xABEA, 0xB44C,
+  0xA3CA, 0xAC0B, 0xABEA, 0xB42B, 0xB42B, 0xA3C9, 0xB42B, 0xABEA,
+  0xAC0B, 0xB44C, 0x59A1, 0x6A03, 0x6A03, 0x6A23, 0x7244, 0x6A23,
+  0x7244, 0x7223, 0x7244, 0x7244, 0x6A23, 0x7244, 0x6A23, 0x7223,
+  0x7223, 0x9BA9, 0x59C2, 0x59A2, 0x59C2, 0x59A2, 0x59C2, 0x59C2,
+  0x59C2, 0x59A2, 0x59C2, 0x59A2, 0x59C2, 0x59C2, 0x59A2, 0x59A2,
+  0x8AE7, 0x59C2, 0x61E3, 0x59C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3,
+  0x61C3, 0x61C3, 0x61C3, 0x59C3, 0x59C3, 0x61C3, 0x59A2, 0x8AE6,
+  0x61E3, 0x61E3, 0x61E2, 0x61E2, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x59A2, 0x59A2, 0x8B06, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x8B07, 0x61C2, 0x61C2,
+  0x61C2, 0x61C3, 0x61C2, 0x61C2, 0x61C3, 0x61C3, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x8B07, 0x61A2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61E3,
+  0x61E3, 0x61E3, 0x61C2, 0x8AE7, 0x61E3, 0x61E3, 0x61C2, 0x61C3,
+  0x61C3, 0x61C3, 0x61C3, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x59C2, 0x59A2, 0x8AE6, 0x61E3, 0x61E2, 0x61E3, 0x61E3, 0x61E3,
+  0x61C3, 0x61C3, 0x61C3, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x8AE6, 0x61C3, 0x61E2, 0x61C3, 0x61C3, 0x61C3, 0x61C3,
+  0x61E3, 0x61E3, 0x61E3, 0x61C2, 0x61E3, 0x61E3, 0x61C2, 0x61C2,
+  0x8AE7, 0x61E3, 0x61E3, 0x61E3, 0x69E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x6203, 0x61E3, 0x61E3, 0x61E2, 0x8B07,
+  0x61C2, 0x61E3, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61E3, 0x61E3,
+  0x61E3, 0x61E2, 0x61E2, 0x61E3, 0x61E3, 0x61C2, 0x8AE6, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61C2, 0x8AE6, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61C2, 0x8B07, 0x59C2, 0x59C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61A2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x59A1, 0x8B07, 0xA3EA, 0x9B89, 0x9B68, 0xA3A9,
+  0xA3CA, 0x9BA9, 0x9B89, 0xA3CA, 0xA3CA, 0x9B89, 0xA3CA, 0x9B68,
+  0xA3A9, 0xA3AA, 0x8B07, 0xA3C9, 0xABEA, 0xABEA, 0xABEA, 0xABEA,
+  0xABEA, 0xB42B, 0xAC0A, 0xA3C9, 0xB42A, 0xA3C9, 0xAC0A, 0xB44B,
+  0xABEA, 0xA3A9, 0xA3A9, 0xABCA, 0xABEA, 0xABEA, 0xABEA, 0xABEA,
+  0xB40B, 0xAC0A, 0xA3A9, 0xB42B, 0xA3CA, 0xABEA, 0xB44B, 0xABEA,
+  0x9B89, 0xA3C9, 0xABEA, 0xABEA, 0xAC0A, 0xABEA, 0xABEA, 0xB42B,
+  0xAC0A, 0xA3C9, 0xAC0B, 0xA3C9, 0xAC0A, 0xB44B, 0xABEA, 0x9B89,
+  0xA3A9, 0xA3CA, 0xABEA, 0xAC0A, 0xA3CA, 0xAC0A, 0xB42B, 0xABEA,
+  0xA3A9, 0xAC0A, 0xA3C9, 0xABEA, 0xB44B, 0xABEA, 0x9B89, 0xA3A9,
+  0xA3CA, 0xABEA, 0xAC0A, 0xA3CA, 0xAC0A, 0xB42B, 0xABEA, 0xA3A9,
+  0xAC0B, 0xA3CA, 0xABEA, 0xB44B, 0xABEA, 0x9B68, 0xA3A9, 0xABCA,
+  0xABEA, 0xAC0A, 0xA3C9, 0xAC0A, 0xB42B, 0xABEA, 0xA3A9, 0xAC0A,
+  0xA3CA, 0xABEA, 0xB44B, 0xABEA, 0x9B68, 0xA3A9, 0xA3CA, 0xABEA,
+  0xAC0A, 0xA3C9, 0xAC0B, 0xB42B, 0xABEA, 0xA3A9, 0xAC0A, 0xA3CA,
+  0xABEA, 0xB44B, 0xABEA, 0x9B68, 0xA3A9, 0xA3C9, 0xABEA, 0xAC0A,
+  0xA3C9, 0xAC0B, 0xB40B, 0xABCA, 0xA3C9, 0xAC0A, 0xA3CA, 0xABEA,
+  0xB44B, 0xABEA, 0x9B68, 0xA3A9, 0xABCA, 0xABEA, 0xABEA, 0xA3A9,
+  0xB42B, 0xAC0B, 0xA3CA, 0xA3C9, 0xAC0A, 0xA3CA, 0xABEA, 0xB44B,
+  0xAC0A, 0x9B68, 0xA3A9, 0xABCA, 0xABEA, 0xABEA, 0xA3A9, 0xB42B,
+  0xAC0A, 0xA3CA, 0xA3C9, 0xABEA, 0xA3C9, 0xABEA, 0xB44B, 0xAC0B,
+  0x9B48, 0xA3A9, 0xABEA, 0xABEA, 0xABCA, 0xA3A9, 0xB42B, 0xAC0A,
+  0xA3CA, 0xA3C9, 0xABEA, 0xA3CA, 0xABCA, 0xB42B, 0xAC0B, 0x9348,
+  0xA3A9, 0xABEA, 0xABEA, 0xA3C9, 0xA3A9, 0xB44B, 0xABEA, 0xA3A9,
+  0xA3CA, 0xABEA, 0xA3CA, 0xABCA, 0xB42B, 0xB40A, 0x9B68, 0xA3A9,
+  0xABEA, 0xABEA, 0xA3C9, 0xA3A9, 0xB44B, 0xABEA, 0xA3C9, 0xA3CA,
+  0xABEA, 0xA3C9, 0xA3C9, 0xB42B, 0xAC0A, 0x9B68, 0x9BA9, 0xAC0A,
+  0xAC0A, 0xA3CA, 0x9BA9, 0xB46C, 0xAC0B, 0xA3CA, 0xA3EA, 0xAC0B,
+  0xA3EA, 0xA3EA, 0xAC2B, 0xAC2B, 0x9B89, 0x7AA5, 0x82A6, 0x82A6,
+  0x7AA5, 0x82A6, 0x82C6, 0x82A6, 0x7A85, 0x82A6, 0x82A6, 0x82A6,
+  0x82A5, 0x82C6, 0x82C6, 0x82C6, 0x6A03, 0x6203, 0x6203, 0x6203,
+  0x6203, 0x61E3, 0x61E3, 0x6203, 0x61E3, 0x6A03, 0x6A04, 0x6A04,
+  0x6A04, 0x6A04, 0x6A03, 0x61C2, 0x59C2, 0x61C2, 0x61C2, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x69E3, 0x69E3, 0x61E3, 0x61C3,
+  0x61E3, 0x61C3, 0x7224, 0x6A24, 0x6A24, 0x6A24, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x6A04, 0x6A03, 0x6A03, 0x6A04, 0x6A03,
+  0x69E3, 0x6A03, 0x61C3, 0x59C2, 0x59C2, 0x59C2, 0x59C2, 0x59C3,
+  0x59C3, 0x59C3, 0x59C3, 0x61E3, 0x61C3, 0x61E3, 0x61E3, 0x59C3,
+  0x6203, 0x59C3, 0x59C2, 0x59C3, 0x59C3, 0x59A3, 0x59A3, 0x59A3,
+  0x59C3, 0x59C3, 0x59A2, 0x59A2, 0x59A2, 0x5182, 0x5182, 0x6A03,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x59C3,
+  0x61E3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C2, 0x61E3, 0x59C2,
+  0x61C2, 0x61C2, 0x59C2, 0x61C3, 0x61C3, 0x59C3, 0x59A2, 0x59A2,
+  0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x6A24, 0x6A04, 0x6A04,
+  0x6A24, 0x6A03, 0x6A03, 0x6A03, 0x6A04, 0x6A04, 0x6A03, 0x6A24,
+  0x6A24, 0x6A04, 0x6A04, 0x6A03, 0x6A24, 0x6A04, 0x6A03, 0x6A03,
+  0x6A24, 0x6A04, 0x6A04, 0x6A03, 0x6A04, 0x6A03, 0x6A04, 0x6A04,
+  0x6A24, 0x6A03, 0x6A03, 0x6A24, 0x61E3, 0x61C3, 0x61E3, 0x61C3,
+  0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x59C3, 0x59A2,
+  0x59A2, 0x5182, 0x61E3, 0x59A2, 0x59C2, 0x59C3, 0x59C2, 0x61C3,
+  0x61C3, 0x61C3, 0x61C3, 0x59C3, 0x59C3, 0x59E3, 0x61E3, 0x61E3,
+  0x61E3, 0x7244, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x6A04, 0x6A03, 0x6A03, 0x6A03, 0x6A03,
+  0x6A03, 0x61C2, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x6203, 0x69E3, 0x6A44,
+  0x6203, 0x6203, 0x6203, 0x6204, 0x6203, 0x61E3, 0x61C2, 0x61E3,
+  0x61C3, 0x61E3, 0x61C3, 0x61E3, 0x61C3, 0x61C2, 0x8B07, 0x8B07,
+  0x9348, 0x9369, 0x9348, 0x9368, 0x9348, 0x9328, 0x9328, 0x9B69,
+  0x8B07, 0x8B28, 0x8B07, 0x9348, 0x8B07, 0x9348, 0xB44B, 0xABEA,
+  0xABEA, 0xA3C9, 0xABCA, 0xA3C9, 0xAC0A, 0xA3A9, 0xA3A9, 0xA3C9,
+  0xA3A8, 0xABEA, 0x9B69, 0xA3AA, 0x9328, 0xB44B, 0xABEA, 0xAC0B,
+  0xA3AA, 0xABEA, 0xA3C9, 0xAC0B, 0xA3A9, 0xA3A9, 0xA3CA, 0xA3A9,
+  0xABEA, 0xA389, 0xA3A9, 0x9328, 0xB44B, 0xAC0A, 0xABEA, 0xA3A9,
+  0xABEA, 0xA3A9, 0xAC0B, 0x9B89, 0xA3AA, 0xA3CA, 0xA3A9, 0xABEA,
+  0xA369, 0xA3A9, 0x8B27, 0xB44B, 0xAC0A, 0xABEA, 0xA3A9, 0xABEA,
+  0xA3A9, 0xB42B, 0x9B88, 0xA3C9, 0xA3A9, 0xA3A9, 0xABCA, 0x9B69,
+  0xA389, 0x8327, 0xB44B, 0xAC0A, 0xABEA, 0xA3A9, 0xABEA, 0xA3A9,
+  0xB42B, 0x9B89, 0xA3A9, 0xA3C9, 0xA3A9, 0xABCA, 0x9B89, 0xA389,
+  0x8B27, 0xB44B, 0xAC0A, 0xABEA, 0xA3A9, 0xABEA, 0xA389, 0xB42B,
+  0x9B68, 0xA3A9, 0xA3A9, 0xA3A9, 0xA3CA, 0x9B89, 0xA389, 0x8B07,
+  0xB44B, 0xAC0A, 0xABEA, 0xA3A9, 0xABEA, 0x9B89, 0xB42B, 0x9B68,
+  0xA3A9, 0xA3A9, 0xA3C9, 0xA3CA, 0x9B89, 0xA388, 0x9348, 0xBC4B,
+  0xAC0A, 0xABEA, 0xA3A9, 0xAC0A, 0x9B89, 0xAC0B, 0x9B89, 0xA3A9,
+  0xA3A9, 0xA3C9, 0xA3CA, 0x9B89, 0x9B68, 0x9328, 0xBC4B, 0xAC0A,
+  0xABEA, 0xA3A9, 0xAC0B, 0x9B89, 0xABEA, 0xA3A9, 0xA3A9, 0xA389,
+  0xA3C9, 0xA3A9, 0x9B89, 0x9B88, 0x8B07, 0xBC4B, 0xB40A, 0xABEA,
+  0x9B89, 0xB40B, 0x9B89, 0xABEA, 0xA3A9, 0xA3A9, 0xA389, 0xA3CA,
+  0xA3A9, 0xA389, 0x9B68, 0x8B28, 0xB44C, 0xB3EA, 0xABCA, 0x9B89,
+  0xB40B, 0x9B89, 0xABCA, 0xA3A9, 0xA3C9, 0x9B89, 0xA3CA, 0xA3A9,
+  0xA389, 0x9B68, 0x8B08, 0xBC4C, 0xB40A, 0xABCA, 0x9B89, 0xAC0A,
+  0xA388, 0xABCA, 0xABC9, 0xABC9, 0x9B88, 0xA3C9, 0xA389, 0xA3A9,
+  0x9B68, 0x8B07, 0xBC6B, 0xAC0A, 0xA3C9, 0x9B88, 0xABEA, 0xA389,
+  0xA3C9, 0xABEA, 0xA3C9, 0x9B68, 0xA3A9, 0xA388, 0xA3A9, 0x9B68,
+  0x8B06, 0xBC6B, 0xAC2B, 0xA3CA, 0x9BA9, 0xABEA, 0xA3A9, 0xA3CA,
+  0xAC0B, 0xA3CA, 0x9B89, 0xA3CA, 0x9B89, 0xA3A9, 0x9B68, 0x7A85,
+  0x6A24, 0x6A24, 0x6A04, 0x6A03, 0x6A03, 0x6A03, 0x6A24, 0x6A24,
+  0x6A04, 0x6A04, 0x7224, 0x6A04, 0x7244, 0x7224, 0x9369, 0x5162,
+  0x5182, 0x5182, 0x5182, 0x59A3, 0x61C3, 0x61E4, 0x6A04, 0x6A04,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A25, 0x9369, 0x61E4, 0x6204,
+  0x6A04, 0x6A04, 0x61E4, 0x61E3, 0x69E4, 0x6A04, 0x69E3, 0x6203,
+  0x6A04, 0x6A04, 0x6A04, 0x6A24, 0x9B68, 0x61C3, 0x59C3, 0x59A2,
+  0x59A2, 0x59A2, 0x59C3, 0x61E3, 0x61E4, 0x6A24, 0x6A24, 0x7244,
+  0x7245, 0x7244, 0x7244, 0x9B69, 0x59C3, 0x59C3, 0x59C3, 0x61E3,
+  0x61E3, 0x6204, 0x6204, 0x6204, 0x59E4, 0x59C3, 0x59A3, 0x51A2,
+  0x59A3, 0x59A3, 0x9B89, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3,
+  0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x51A3,
+  0x51A3, 0x9B89, 0x59A3, 0x59C3, 0x59A3, 0x59C3, 0x59C3, 0x59C3,
+  0x59C3, 0x61E3, 0x61E3, 0x61E4, 0x61E3, 0x61E4, 0x61E4, 0x6204,
+  0x9B89, 0x59C3, 0x61E3, 0x61E3, 0x61E3, 0x61E4, 0x61E3, 0x61E3,
+  0x6204, 0x6A04, 0x6A04, 0x6204, 0x6204, 0x6204, 0x61E4, 0xA3A9,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A04, 0x6204,
+  0x6204, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A24, 0xA389, 0x6203,
+  0x6204, 0x6A04, 0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x6204,
+  0x6204, 0x6204, 0x6A04, 0x6A04, 0x6204, 0x9B89, 0x5182, 0x5162,
+  0x5161, 0x5162, 0x5162, 0x5162, 0x5162, 0x5162, 0x5182, 0x5182,
+  0x5182, 0x59A3, 0x59A3, 0x59C3, 0xA3AA, 0x7224, 0x6A45, 0x7245,
+  0x7245, 0x7245, 0x7245, 0x7245, 0x7245, 0x6A45, 0x6A45, 0x6A45,
+  0x6A25, 0x6A24, 0x6A24, 0xA3AA, 0x6A04, 0x6A04, 0x6A24, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A04, 0x6A04,
+  0x6A04, 0x6204, 0x9BA9, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x6203,
+  0x61E3, 0x61E3, 0x61E3, 0x61E4, 0x61E4, 0x6204, 0x6204, 0x6A04,
+  0x6A24, 0x9BA9, 0x69E3, 0x6A04, 0x6A24, 0x6A24, 0x6A24, 0x6204,
+  0x6204, 0x61E3, 0x61E3, 0x61C3, 0x59C3, 0x59C3, 0x59C3, 0x59A2,
+  0x7A85, 0xABEA, 0xA3CA, 0x9328, 0xABEA, 0x9B89, 0x9B89, 0xA3A9,
+  0x9BA9, 0x9368, 0x9B89, 0xA3CA, 0x9328, 0x9B68, 0x9BA9, 0x6A24,
+  0x9348, 0xA3A9, 0xA3A9, 0xA389, 0xA389, 0xA3A9, 0xA3A9, 0x9B68,
+  0xA388, 0x9B88, 0xA3C9, 0x9B68, 0xA389, 0xAC0A, 0x6A03, 0x9348,
+  0xA389, 0xA3A9, 0xA389, 0xA3A9, 0xA3CA, 0xA3A9, 0x9B69, 0x9B89,
+  0x9B68, 0xA3A9, 0x9B68, 0xA389, 0xAC0B, 0x7224, 0x9348, 0xA3A9,
+  0xA3CA, 0x9B89, 0xA3A9, 0xA3A9, 0xA3A9, 0x9B69, 0xA389, 0x9B69,
+  0xA3A9, 0x9B68, 0x9B89, 0xAC0B, 0x61C3, 0x9328, 0x9BA9, 0xA3C9,
+  0x9B68, 0xA3A9, 0xA3A9, 0xA3A9, 0x9B68, 0xA389, 0x9B68, 0x9BA9,
+  0x9B88, 0x9B88, 0xAC0B, 0x5182, 0x8B08, 0x9B89, 0xABCA, 0x9B68,
+  0xA3C9, 0xA3A9, 0xA3A9, 0x9B68, 0x9B89, 0x9B88, 0x9B89, 0x9B89,
+  0x9B68, 0xAC0B, 0x61E4, 0x8B08, 0x9BA9, 0xABEA, 0x9B68, 0xA3CA,
+  0xA3A9, 0xA3A9, 0x9B68, 0x9B89, 0x9B88, 0x9B89, 0xA3A9, 0x9B68,
+  0xAC0B, 0x61E4, 0x8B28, 0x9BA9, 0xABEA, 0x9B68, 0xABCA, 0xA3A9,
+  0xA3A9, 0x9B68, 0x9B89, 0x9B68, 0x9B88, 0xA3A9, 0x9348, 0xAC0B,
+  0x6A25, 0x9328, 0x9B89, 0xABEA, 0x9B48, 0xABEA, 0xA3A9, 0xA3C9,
+  0x9B68, 0x9B89, 0x9B68, 0x9B68, 0xA3A9, 0x9B48, 0xAC0A, 0x6A04,
+  0x8B07, 0x9BA9, 0xABEA, 0x9B68, 0xA3CA, 0xA3A9, 0xA3A9, 0x9B68,
+  0xA389, 0x9B68, 0x9B88, 0xA3A9, 0x9B68, 0xABEA, 0x61C3, 0x8B07,
+  0xA3A9, 0xABEA, 0x9B69, 0xA3CA, 0xA3A9, 0xA3A9, 0x9B68, 0xA3A9,
+  0x9348, 0x9B89, 0xA3A9, 0x9B68, 0xABCA, 0x6A24, 0x8B07, 0xA3A9,
+  0xABCA, 0x9B69, 0xA3CA, 0xA3A9, 0xA3A9, 0x9B68, 0xA3A9, 0x9348,
+  0x9B89, 0xA3A9, 0x9B68, 0xA3CA, 0x6204, 0x8B07, 0xA3A9, 0xA3C9,
+  0xA389, 0xA3A9, 0xA3A9, 0xA3A9, 0x9B68, 0xA3A9, 0x9B48, 0xA389,
+  0xABCA, 0x9B69, 0xA3AA, 0x6204, 0x8B28, 0xA3A9, 0xA3C9, 0xA389,
+  0xA389, 0xA3A9, 0xA3A9, 0x9B68, 0xA3A9, 0x9B48, 0x9B89, 0xABCA,
+  0x9B68, 0xA3A9, 0x61C3, 0x8B07, 0x9BA9, 0xA3CA, 0x9B89, 0xA3A9,
+  0xA3A9, 0xA3CA, 0x9B68, 0xA3CA, 0x9B68, 0x9BA9, 0xABEA, 0x9B68,
+  0xA3A9, 0x8B28, 0x82C7, 0x7245, 0x6A44, 0x6A25, 0x6A24, 0x6A24,
+  0x6A24, 0x6A24, 0x7245, 0x7265, 0x7A85, 0x7AA6, 0x7AA6, 0x7AA6,
+  0xABEA, 0xABEA, 0xB44C, 0xAC0B, 0xABEA, 0xABEA, 0xBC4C, 0xAC0A,
+  0xABEA, 0xAC0A, 0xABEA, 0xB42B, 0xABEA, 0x8AE7, 0x61A2, 0xABEA,
+  0xABEA, 0xB44B, 0xAC0B, 0xABEA, 0xABEA, 0xB44C, 0xABEA, 0xAC0A,
+  0xAC0A, 0xABEA, 0xB42B, 0xABEA, 0x8AE7, 0x61E3, 0xABEA, 0xABEA,
+  0xB44B, 0xAC0B, 0xABEA, 0xABEA, 0xB44B, 0xABEA, 0xAC0A, 0xABEA,
+  0xABEA, 0xB42B, 0xA3CA, 0x8B07, 0x69E3, 0xABEA, 0xABEA, 0xB44B,
+  0xAC0A, 0xAC0A, 0xABEA, 0xB44B, 0xABEA, 0xAC0A, 0xABEA, 0xABEA,
+  0xB42B, 0xA3C9, 0x8AE7, 0x61E3, 0xABEA, 0xABEA, 0xB44B, 0xABEA,
+  0xAC0A, 0xABEA, 0xB44B, 0xABEA, 0xAC0A, 0xABEA, 0xA3C9, 0xB42B,
+  0xA3A9, 0x8AE7, 0x61C2, 0xA3CA, 0xABEA, 0xB44B, 0xABEA, 0xAC0A,
+  0xABEA, 0xB44B, 0xABEA, 0xAC0B, 0xABEA, 0xA3C9, 0xB42B, 0xA3A9,
+  0x8AE7, 0x61C2, 0xA3CA, 0xABEA, 0xB44B, 0xABEA, 0xAC0A, 0xABEA,
+  0xB44B, 0xABEA, 0xAC0B, 0xABEA, 0xA3CA, 0xB42B, 0x9B89, 0x8B07,
+  0x6A03, 0xA3CA, 0xABEA, 0xB44B, 0xA3CA, 0xAC0B, 0xABEA, 0xB42B,
+  0xABEA, 0xAC0A, 0xABEA, 0xA3CA, 0xB42B, 0x9B89, 0x8B07, 0x69E3,
+  0xA3CA, 0xAC0A, 0xB42B, 0xA3CA, 0xB42B, 0xABEA, 0xB42B, 0xABEA,
+  0xAC0A, 0xABEA, 0xA3C9, 0xB40B, 0xA3A9, 0x8B07, 0x6A03, 0xABCA,
+  0xABEA, 0xB42B, 0xA3C9, 0xB42B, 0xABEA, 0xB42B, 0xABEA, 0xAC0A,
+  0xABCA, 0xA3CA, 0xAC0B, 0xA3A9, 0x8B07, 0x69E3, 0xA3CA, 0xABEA,
+  0xB42B, 0xA3A9, 0xB42B, 0xABEA, 0xB42B, 0xABEA, 0xAC0A, 0xABCA,
+  0xA3C9, 0xABEA, 0xA3C9, 0x8B06, 0x69E3, 0xA3CA, 0xABEA, 0xB42B,
+  0xA3A9, 0xB42B, 0xABCA, 0xB42B, 0xABEA, 0xAC0A, 0xA3CA, 0xA3C9,
+  0xABEA, 0xABEA, 0x8AE6, 0x6A03, 0xA3C9, 0xABEA, 0xB42B, 0xA389,
+  0xB44B, 0xA3C9, 0xB42B, 0xABEA, 0xAC0A, 0xA3C9, 0xA3A9, 0xABCA,
+  0xABEA, 0x82E6, 0x61E3, 0xA3A9, 0xABEA, 0xB40B, 0x9B89, 0xB44C,
+  0xA3C9, 0xB42B, 0xA3CA, 0xAC0B, 0xA3CA, 0xA3C9, 0xABCA, 0xAC0B,
+  0x82C6, 0x61E2, 0x9328, 0x9B89, 0x9B68, 0x9327, 0xA3A9, 0x9348,
+  0x9B89, 0x9B69, 0x9B89, 0x9348, 0x9348, 0x9368, 0x9B68, 0x82E6,
+  0x7244, 0x61E3, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61E2, 0x61E2, 0x61E2, 0x61E3, 0x61C2, 0xAC0B,
+  0x69E3, 0x69E3, 0x69E3, 0x61E3, 0x61C3, 0x61C3, 0x61C3, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61E3, 0x61E3, 0x61C2, 0xAC0A, 0x6A03,
+  0x69E3, 0x69E3, 0x69E3, 0x61E3, 0x69E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61C2, 0xAC0A, 0x69E3, 0x69E3,
+  0x69E3, 0x69E3, 0x69E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61C2, 0xAC0B, 0x61C2, 0x61C2, 0x61C3,
+  0x61C3, 0x61C3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61C2, 0xAC2B, 0x61C3, 0x61C3, 0x61E3, 0x69E3,
+  0x69E3, 0x69E3, 0x69E3, 0x61E3, 0x6A03, 0x6A03, 0x6A03, 0x61E3,
+  0x6A03, 0x61E2, 0xAC0B, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x61E3,
+  0x69E3, 0x69E3, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03,
+  0x6A03, 0xAC0B, 0x69E3, 0x6A03, 0x6A03, 0x69E3, 0x69E3, 0x69E3,
+  0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x61E3, 0x61E3, 0x61C3, 0x61C3,
+  0xAC0A, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x69E3, 0xAC0B,
+  0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x69E3, 0x69E3, 0x6A03, 0x69E3,
+  0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x61E3, 0xAC0A, 0x69E3,
+  0x61E3, 0x69E3, 0x69E3, 0x6A03, 0x69E3, 0x69E3, 0x69E3, 0x6A03,
+  0x69E3, 0x6A03, 0x69E3, 0x69E3, 0x61E3, 0xAC0A, 0x7224, 0x6A03,
+  0x69E3, 0x61C2, 0x61A2, 0x61A2, 0x61C2, 0x61C2, 0x61C2, 0x61E3,
+  0x69E3, 0x69E3, 0x69E3, 0x69E3, 0xAC0A, 0x61E3, 0x61E3, 0x69E3,
+  0x69E3, 0x6A03, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x6A03, 0x6A03,
+  0x69E3, 0x69E3, 0x6A03, 0xAC0A, 0x61E3, 0x69E3, 0x69E3, 0x61E3,
+  0x69E3, 0x69E3, 0x6A03, 0x6A03, 0x69E3, 0x61E3, 0x61C2, 0x69E3,
+  0x6A03, 0x61E2, 0xABEB, 0x7244, 0x7264, 0x7A85, 0x7A65, 0x7244,
+  0x7244, 0x7244, 0x7A64, 0x7A84, 0x7A64, 0x7A85, 0x7A85, 0x7A64,
+  0x7264, 0x9B69, 0xAC0B, 0xABCA, 0xA3A9, 0xABEA, 0xAC0B, 0xA3CA,
+  0xA3A9, 0xB42B, 0xB42B, 0xA3C9, 0xAC0A, 0xA3A9, 0xABEA, 0xAC0B,
+  0x8AE7, 0xB42B, 0xABCA, 0xA3A9, 0xAC0A, 0xAC0B, 0xABCA, 0xA3A9,
+  0xB42B, 0xB42B, 0xA3C9, 0xAC2A, 0xA3A9, 0xABEA, 0xAC0A, 0x82E7,
+  0xB42B, 0xABCA, 0xA3A9, 0xAC0A, 0xAC0A, 0xA3CA, 0xA3A9, 0xB42B,
+  0xAC0B, 0xA3C9, 0xAC2B, 0xA3A9, 0xABEA, 0xAC0A, 0x8B07, 0xB42B,
+  0xA3CA, 0xA3A9, 0xABEA, 0xABEA, 0xA3CA, 0xA3A9, 0xB42B, 0xAC0A,
+  0xA3C9, 0xAC2A, 0xA3A9, 0xABEA, 0xAC0A, 0x8B07, 0xB42A, 0xA3CA,
+  0xA3A9, 0xABEA, 0xABEA, 0xABCA, 0xA3A9, 0xB42B, 0xAC0A, 0xA3C9,
+  0xAC0A, 0xA3A9, 0xABEA, 0xABEA, 0x8B07, 0xAC0A, 0xA3CA, 0x9BA9,
+  0xABEA, 0xABEA, 0xABCA, 0xA3A9, 0xB42B, 0xAC0A, 0xA3C9, 0xB42B,
+  0xA3A9, 0xABEA, 0xAC0A, 0x8B07, 0xAC0A, 0xABCA, 0xA389, 0xABEA,
+  0xABEA, 0xABCA, 0xA3C9, 0xB42B, 0xAC0A, 0xA3C9, 0xB42B, 0xA3A9,
+  0xABEA, 0xABEA, 0x8B07, 0xB40A, 0xA3C9, 0xA389, 0xABEA, 0xABEA,
+  0xABCA, 0xA3A9, 0xB42B, 0xABEA, 0xA3C9, 0xB42B, 0xA3A9, 0xABEA,
+  0xABEA, 0x8AE7, 0xB40A, 0xA3A9, 0xA3A9, 0xABEA, 0xABEA, 0xA3C9,
+  0xA3A9, 0xB42B, 0xABEA, 0xA3C9, 0xB42B, 0xA3A9, 0xABEA, 0xABEA,
+  0x8B07, 0xAC0A, 0xA3A9, 0xA3A9, 0xABEA, 0xABEA, 0xA3C9, 0xA3A9,
+  0xB42B, 0xABCA, 0xA3C9, 0xB42B, 0xA389, 0xABEA, 0xA3EA, 0x8B07,
+  0xAC0A, 0xA3A9, 0xA3A9, 0xAC0A, 0xABEA, 0xA3C9, 0xA3A9, 0xB42B,
+  0xABCA, 0xA3C9, 0xB42B, 0xA389, 0xABEA, 0xA3EA, 0x8AE7, 0xB40A,
+  0xA389, 0xA3A9, 0xAC0A, 0xABEA, 0xA3C9, 0xA3A9, 0xB42B, 0xA3CA,
+  0xA3C9, 0xB42B, 0x9B89, 0xABEA, 0xA3EA, 0x8B07, 0xB40B, 0x9B88,
+  0xA3A9, 0xAC0B, 0xABEA, 0xA3A9, 0xA3A9, 0xB42B, 0xA3C9, 0xA3C9,
+  0xB42B, 0x9B88, 0xABEA, 0xA3EA, 0x8AE7, 0xAC0B, 0x9B68, 0xA3A9,
+  0xAC0B, 0xABEA, 0xA3C9, 0xA3A9, 0xB42B, 0xA3C9, 0xA3CA, 0xB42B,
+  0xA389, 0xABEA, 0xA3EA, 0x8B07, 0x9B69, 0x8B27, 0x9327, 0x9B89,
+  0x9B68, 0x9348, 0x9348, 0x9B89, 0x9348, 0x9368, 0x9B89, 0x9327,
+  0x9368, 0x9369, 0x82E7, 0x59A2, 0x59C2, 0x59C3, 0x61C3, 0x61C3,
+  0x61C3, 0x61C3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x6A03, 0x6203,
+  0x6A03, 0x6A03, 0x59A2, 0x59A3, 0x59A3, 0x59A3, 0x59A3, 0x59A2,
+  0x59C2, 0x59C2, 0x59C3, 0x59E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x6A03, 0x61E3, 0x6204, 0x61E3, 0x61E3, 0x61E4, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61C3, 0x61C3, 0x59C3, 0x59C3, 0x59C3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E4, 0x61E3, 0x61E3, 0x61E3,
+  0x6204, 0x61E3, 0x61E4, 0x61E3, 0x59E3, 0x59E3, 0x6A04, 0x59C2,
+  0x59C3, 0x59C2, 0x61C2, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3,
+  0x59C3, 0x59C3, 0x61C3, 0x59C3, 0x61C3, 0x6204, 0x61E3, 0x61E4,
+  0x6203, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A04,
+  0x6A04, 0x6A04, 0x6203, 0x6204, 0x6A04, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E3, 0x61E4,
+  0x61E4, 0x61E3, 0x61E3, 0x6A04, 0x59C2, 0x59C3, 0x59C2, 0x59A2,
+  0x59A3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59A3, 0x59A3,
+  0x59C3, 0x59C3, 0x61E4, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x6203, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E4, 0x61E4,
+  0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E3, 0x61E3, 0x61E4, 0x61E4,
+  0x6A04, 0x59A2, 0x59C3, 0x61C3, 0x61C3, 0x61C3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x6A03,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61C3, 0x61C3, 0x61C3, 0x59C3, 0x61E3, 0x6203, 0x59C3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E4, 0x6204, 0x6204,
+  0x6A04, 0x6A04, 0x6A04, 0x6204, 0x6204, 0x6A24, 0x61E3, 0x61E3,
+  0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61E3,
+  0x61E3, 0x61C3, 0x61C3, 0x61E3, 0x61E3, 0x6A23, 0x6A24, 0x6A24,
+  0x6A24, 0x6A44, 0x6A24, 0x7244, 0x6A44, 0x6A44, 0x7244, 0x7244,
+  0x7244, 0x7245, 0x7244, 0x7A85, 0x9B89, 0xA3A9, 0xAC0A, 0xAC0A,
+  0xA3C9, 0xABEA, 0xABEA, 0xA3C9, 0xA3A9, 0xB42B, 0x9B69, 0xA3A9,
+  0x9B68, 0xABCA, 0xA3CA, 0x9B48, 0xA389, 0xAC0A, 0xABEA, 0xA3CA,
+  0xA3CA, 0xABEA, 0xA3CA, 0xA3A9, 0xB42B, 0x9B68, 0xA3A9, 0x9B68,
+  0xA3AA, 0xABEA, 0x9348, 0xA3A9, 0xABEA, 0xABEA, 0xA3CA, 0xA3A9,
+  0xABCA, 0xA3C9, 0xA3C9, 0xB44B, 0x9B68, 0xA3A9, 0x9B48, 0xA3CA,
+  0xA3EA, 0x9348, 0xA3A9, 0xABEA, 0xA3CA, 0xABEA, 0xA3A9, 0xA3CA,
+  0xABEA, 0xA3A9, 0xB44B, 0x9B88, 0xA3A9, 0x9B68, 0xA3CA, 0xABEA,
+  0x9348, 0xA3CA, 0xABEA, 0xA3CA, 0xAC0A, 0xA3A9, 0xA3C9, 0xABEA,
+  0xA3C9, 0xB44B, 0x9B88, 0xA3A9, 0x9B68, 0xA3A9, 0xABEA, 0x9348,
+  0xA3C9, 0xABCA, 0xA3A9, 0xAC0B, 0x9B89, 0xA3C9, 0xABEA, 0xA3C9,
+  0xB44B, 0x9B68, 0xA3C9, 0x9348, 0xA3C9, 0xABEA, 0x9B68, 0xA3C9,
+  0xA3CA, 0xA3A9, 0xB40B, 0x9B89, 0xA3CA, 0xABEA, 0xA3CA, 0xB42B,
+  0x9B68, 0xA3CA, 0x9348, 0xA3A9, 0xABEA, 0x9B69, 0xA3C9, 0xA3C9,
+  0xA3A9, 0xB42B, 0x9B88, 0xABCA, 0xABEA, 0xA3CA, 0xAC0A, 0x9B88,
+  0xA3CA, 0x9B68, 0xA3A9, 0xABEA, 0x9B89, 0xA3A9, 0xA3C9, 0xA389,
+  0xB44B, 0x9B89, 0xABEA, 0xABEA, 0xABCA, 0xAC0A, 0x9B68, 0xA3CA,
+  0x9B48, 0xA3AA, 0xAC0B, 0x9BA9, 0xA3CA, 0xA3A9, 0x9B88, 0xB42B,
+  0x9B89, 0xABCA, 0xABCA, 0xABCA, 0xABEA, 0x9B68, 0xABEA, 0x9B68,
+  0xA3A9, 0xABEA, 0x9BA9, 0xA3CA, 0xA3A9, 0x9B68, 0xB42B, 0xA3A9,
+  0xABCA, 0xABCA, 0xABEA, 0xABEA, 0x9B68, 0xABEA, 0x9B68, 0xA3A9,
+  0xABEA, 0xA3A9, 0xA3A9, 0xA3A9, 0x9B68, 0xB42B, 0xA3A9, 0xABCA,
+  0xA3C9, 0xABCA, 0xA3CA, 0x9B89, 0xABEA, 0x9B68, 0xA3A9, 0xAC0A,
+  0xA3CA, 0xA3A9, 0xA3A9, 0x9B88, 0xB42B, 0xA3A9, 0xABCA, 0xA3A9,
+  0xABEA, 0xA3A9, 0xA389, 0xABEA, 0x9B68, 0xA3A9, 0xABEA, 0xA3CA,
+  0xA389, 0xA3CA, 0x9B88, 0xAC0B, 0xA3CA, 0xABCA, 0xA3C9, 0xABEA,
+  0xA3A9, 0xA3A9, 0xABEA, 0x9B68, 0xA3A9, 0xABEA, 0x9B89, 0x9348,
+  0x9B68, 0x9327, 0xA3A9, 0x9B69, 0x9B89, 0x9348, 0x9B69, 0x9348,
+  0x9B48, 0x9B69, 0x9328, 0x9348, 0x9B89, 0x7A85, 0x6A04, 0x6A24,
+  0x7224, 0x7245, 0x7245, 0x6A25, 0x7225, 0x6A24, 0x6A04, 0x6A04,
+  0x6A04, 0x69E4, 0x61E3, 0x61E3, 0x7A85, 0x6204, 0x61E3, 0x69E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61C3, 0x61C3, 0x61E3, 0x61E3, 0x61E4,
+  0x61E4, 0x6204, 0x6204, 0x7A85, 0x6204, 0x6204, 0x6A04, 0x6A04,
+  0x6A24, 0x6A24, 0x6A44, 0x6A44, 0x6A44, 0x6A44, 0x6A45, 0x6A25,
+  0x6A24, 0x6A24, 0x7265, 0x59A2, 0x59C3, 0x59A2, 0x59A2, 0x59A3,
+  0x59A3, 0x59A3, 0x59A3, 0x59A3, 0x59A3, 0x59A3, 0x59A2, 0x59A2,
+  0x59A3, 0x7A65, 0x59C3, 0x59C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3,
+  0x61E3, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E4,
+  0x7A85, 0x61E3, 0x6203, 0x6A03, 0x6A03, 0x6204, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x59E3, 0x59C3, 0x7AA5,
+  0x6A04, 0x6A24, 0x6A24, 0x6A24, 0x6A04, 0x6A04, 0x6A04, 0x6A04,
+  0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6203, 0x61E3, 0x7A85, 0x6A04,
+  0x6A04, 0x6A24, 0x6A24, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A04,
+  0x6A24, 0x7225, 0x7245, 0x6A24, 0x6A24, 0x7A85, 0x61E3, 0x6203,
+  0x6A03, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x69E3, 0x69E3, 0x61E3,
+  0x61E4, 0x6A04, 0x6A24, 0x6A04, 0x7A85, 0x6A04, 0x6A24, 0x6A24,
+  0x6A24, 0x6A04, 0x6A04, 0x6A04, 0x6A24, 0x6A04, 0x69E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61C3, 0x82A6, 0x7245, 0x7245, 0x7265, 0x7245,
+  0x7245, 0x7245, 0x7265, 0x7245, 0x7245, 0x7245, 0x7245, 0x7245,
+  0x7265, 0x7265, 0x7264, 0x59A3, 0x59C3, 0x61C2, 0x61C3, 0x61C3,
+  0x61C3, 0x61E3, 0x61E3, 0x61E3, 0x6A04, 0x6A04, 0x6A04, 0x6A04,
+  0x6A04, 0x7A85, 0x61E4, 0x6204, 0x6223, 0x6204, 0x6204, 0x6204,
+  0x6204, 0x6204, 0x6204, 0x6204, 0x6A24, 0x6A24, 0x6204, 0x6203,
+  0x7A85, 0x59A3, 0x61E3, 0x61E2, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x82A6,
+  0x7AA5, 0x7A85, 0x7A85, 0x7A65, 0x7265, 0x7A85, 0x7265, 0x7A65,
+  0x7A85, 0x7AA6, 0x7264, 0x7A65, 0x7A85, 0x7A85, 0x6A24, 0xB40B,
+  0xABEA, 0x9B68, 0xB42B, 0xA3C9, 0xA3C9, 0xA3CA, 0xABCA, 0x9B68,
+  0xA3A9, 0xABEA, 0x9B89, 0x9B89, 0xABEA, 0x6A24, 0xB42B, 0xABEA,
+  0x9B68, 0xB42B, 0xA3A9, 0xA3CA, 0xA3C9, 0xABCA, 0x9B68, 0xA3C9,
+  0xABEA, 0x9B88, 0xA3A9, 0xA3C9, 0x7245, 0xB42B, 0xABEA, 0x9B68,
+  0xB42B, 0xA3A9, 0xA3C9, 0xA3CA, 0xABCA, 0x9B68, 0xA3CA, 0xA3CA,
+  0x9B89, 0xA3A9, 0xA3A9, 0x61E3, 0xB42B, 0xABEA, 0x9B68, 0xB42B,
+  0xA3A9, 0xABCA, 0xA3C9, 0xABEA, 0x9B68, 0xABCA, 0xA3C9, 0xA389,
+  0xA3A9, 0xA3A9, 0x6A24, 0xB42B, 0xABEA, 0x9B88, 0xB40B, 0xA3A9,
+  0xABCA, 0xA3C9, 0xABCA, 0x9B68, 0xA3CA, 0xA3C9, 0xA3A9, 0xA3A9,
+  0xA389, 0x6204, 0xB44C, 0xABEA, 0x9B88, 0xB40B, 0xA3A9, 0xABCA,
+  0xA3C9, 0xABCA, 0x9B68, 0xA3CA, 0xA3A9, 0xA3A9, 0xA3A9, 0x9B88,
+  0x6A24, 0xB44C, 0xA3CA, 0x9B89, 0xAC0B, 0xA3A9, 0xABCA, 0xA3C9,
+  0xABEA, 0x9B48, 0xA3CA, 0xA3A9, 0xA3A9, 0xA3A9, 0x9B68, 0x7244,
+  0xB44B, 0xA3CA, 0xA389, 0xAC0B, 0xA3A9, 0xABCA, 0xA3CA, 0xABCA,
+  0x9B68, 0xA3CA, 0xA389, 0xA389, 0xA3CA, 0x9B68, 0x7244, 0xB44B,
+  0xA3C9, 0xA3A9, 0xAC0A, 0xA3A9, 0xABCA, 0xA3CA, 0xA3CA, 0x9B68,
+  0xA3CA, 0x9B88, 0xA3A9, 0xA3CA, 0x9B48, 0x6A24, 0xB44B, 0xA3A9,
+  0xA3A9, 0xAC0A, 0xA3A9, 0xABEA, 0xA3CA, 0xA3CA, 0x9B68, 0xA3CA,
+  0x9B68, 0xA3A9, 0xABCA, 0x9B48, 0x7A85, 0xB44B, 0xA3A9, 0xA3A9,
+  0xABEA, 0xA3A9, 0xABEA, 0xA3C9, 0xA3CA, 0x9B48, 0xA3CA, 0x9B68,
+  0xA3A9, 0xA3CA, 0x9B48, 0x7265, 0xB44B, 0xA3A9, 0xA3A9, 0xABEA,
+  0xA3A9, 0xABCA, 0xA3C9, 0xA3CA, 0x9B48, 0xABCA, 0x9B48, 0xA3C9,
+  0xA3A9, 0x9B27, 0x7244, 0xB42B, 0xA3A9, 0xA3C9, 0xABEA, 0xA3A9,
+  0xABCA, 0xA3A9, 0xABCA, 0x9347, 0xABCA, 0x9B48, 0xABCA, 0xA3A9,
+  0x9B47, 0x7265, 0xB42C, 0x9B89, 0xA3CA, 0xA3EA, 0xA3A9, 0xABEA,
+  0xA3C9, 0xA3C9, 0x9B68, 0xA3EA, 0x9B68, 0xA3C9, 0xA3A9, 0x9347,
+  0x7AA6, 0x9BA9, 0x8B07, 0x9348, 0x9348, 0x8B28, 0x9348, 0x9348,
+  0x9368, 0x8B07, 0x9369, 0x8B27, 0x9348, 0x8B28, 0x82E7, 0x9348,
+  0x7A86, 0x61E3, 0x6204, 0x61E4, 0x6A04, 0x6A04, 0x6A04, 0x6A04,
+  0x6A04, 0x6A04, 0x69E3, 0x6A03, 0x6A04, 0x6A04, 0x9348, 0x82C6,
+  0x6A44, 0x6A25, 0x6A24, 0x6A04, 0x6A24, 0x6A24, 0x6A04, 0x6204,
+  0x6A04, 0x6A24, 0x6A45, 0x6A45, 0x6A45, 0x9B48, 0x7A65, 0x59A3,
+  0x59A3, 0x59A3, 0x59A3, 0x51A3, 0x5183, 0x5183, 0x5183, 0x51A3,
+  0x59A3, 0x59C3, 0x59A3, 0x59A3, 0x9348, 0x82A6, 0x6204, 0x6204,
+  0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x6205, 0x6205, 0x6205,
+  0x61E4, 0x59C4, 0x59C3, 0x9B48, 0x82C7, 0x6204, 0x6204, 0x6204,
+  0x6204, 0x61E4, 0x61E3, 0x59C3, 0x59C3, 0x59C3, 0x59C4, 0x59E4,
+  0x59E4, 0x61E4, 0x9B68, 0x7A85, 0x59E3, 0x59C3, 0x59C3, 0x59C3,
+  0x59C4, 0x59E4, 0x59C4, 0x59E4, 0x61E4, 0x6A25, 0x7266, 0x7266,
+  0x6A45, 0x9B68, 0x7AA6, 0x61E4, 0x6204, 0x6204, 0x6204, 0x6204,
+  0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x6A24,
+  0x9B68, 0x7265, 0x59A3, 0x59A3, 0x59A3, 0x59A3, 0x59A3, 0x59A3,
+  0x59A3, 0x59A3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x9B88,
+  0x82C6, 0x6A25, 0x6A24, 0x6A04, 0x6204, 0x6204, 0x6204, 0x61E4,
+  0x59E4, 0x59C4, 0x61C4, 0x61C4, 0x59C3, 0x59C4, 0x9B89, 0x7A65,
+  0x61E4, 0x61E3, 0x61E3, 0x69E4, 0x6A04, 0x6A04, 0x6A05, 0x6A25,
+  0x6A25, 0x6A25, 0x6A25, 0x6A25, 0x6A05, 0x9B89, 0x82C6, 0x6A45,
+  0x6A25, 0x6A04, 0x61E4, 0x61C4, 0x61C4, 0x61C4, 0x61C4, 0x59C3,
+  0x59A3, 0x59A3, 0x59A3, 0x59A3, 0xA3A9, 0x6A44, 0x5183, 0x5183,
+  0x5182, 0x51A3, 0x59C3, 0x59C3, 0x59C3, 0x59A3, 0x59A3, 0x59A3,
+  0x59C3, 0x61E4, 0x6204, 0x9B89, 0x7265, 0x59C3, 0x61E4, 0x6204,
+  0x6204, 0x6224, 0x6A25, 0x6A25, 0x6A45, 0x6A45, 0x7266, 0x6A46,
+  0x6A25, 0x6205, 0xA3CA, 0x82E7, 0x7286, 0x7245, 0x6A45, 0x6A25,
+  0x6204, 0x59C3, 0x51A2, 0x5182, 0x4962, 0x4941, 0x4941, 0x5182,
+  0x59A3, 0x8B48, 0x7285, 0x6A24, 0x7224, 0x7224, 0x6A24, 0x7265,
+  0x7285, 0x7286, 0x7AC6, 0x7A86, 0x7A86, 0x7A86, 0x7265, 0x7266,
+  0x69E3, 0x61C2, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3,
+  0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x8B07, 0xA3A9, 0x6A03,
+  0x6A03, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x6A04, 0x6A03, 0x8B07, 0xA3A9, 0x69E3, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3,
+  0x61E3, 0x61E3, 0x61E3, 0x8AE7, 0xA389, 0x6A04, 0x6A04, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03,
+  0x69E3, 0x69E3, 0x8B07, 0xA389, 0x69E3, 0x6A03, 0x6A03, 0x6A03,
+  0x6A04, 0x6A24, 0x6A04, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03,
+  0x6A03, 0x8B07, 0x9B89, 0x69E3, 0x6A03, 0x69E3, 0x69E3, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03,
+  0x8B07, 0x9B89, 0x7224, 0x7224, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A04, 0x6A04, 0x6A03, 0x8B07,
+  0x9B88, 0x69E3, 0x61E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3,
+  0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x8AE7, 0x9B88,
+  0x6A04, 0x6A04, 0x6A04, 0x6A24, 0x6A24, 0x7224, 0x6A24, 0x6A24,
+  0x6A04, 0x6A04, 0x6A03, 0x6A03, 0x6A03, 0x8B07, 0x9B68, 0x6A03,
+  0x6A24, 0x6A24, 0x6A24, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03,
+  0x6A03, 0x69E3, 0x69E3, 0x69E3, 0x8AE7, 0x9B68, 0x69E3, 0x69E3,
+  0x69E3, 0x69E3, 0x69E3, 0x6A03, 0x69E3, 0x69E3, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x8AE7, 0x9B68, 0x7224, 0x7224, 0x7224,
+  0x7224, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224,
+  0x7224, 0x7224, 0x8AE7, 0x9B68, 0x69E3, 0x69E3, 0x69E3, 0x69E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x69E3, 0x69E3, 0x61E3, 0x61E3,
+  0x69E3, 0x82C6, 0x9B89, 0x69E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x69E3, 0x69E3, 0x69E3, 0x6A03, 0x6A03, 0x6A03,
+  0x82C6, 0x9B89, 0x61C2, 0x61E2, 0x69E3, 0x69E3, 0x69E3, 0x61C3,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61A2, 0x61A2, 0x61A2, 0x82A5,
+  0xA3A9, 0xA389, 0xABEA, 0xB44C, 0xABEA, 0xA3AA, 0xA3CA, 0xA3A9,
+  0xABEA, 0xB42B, 0xA3C9, 0xABEA, 0xAC0B, 0xA3CA, 0xA3AA, 0x61C2,
+  0xA3A9, 0xABEA, 0xB42B, 0xABEA, 0xA3A9, 0xA3C9, 0xA3A9, 0xABEA,
+  0xAC0B, 0xA3C9, 0xA3EA, 0xAC0B, 0xA3C9, 0xA3AA, 0x61E2, 0xA3A9,
+  0xABEA, 0xAC0B, 0xABEA, 0xA3A9, 0xA3A9, 0xA3A9, 0xA3EA, 0xAC0B,
+  0xA3C9, 0xA3EA, 0xAC0B, 0xA3A9, 0xA3A9, 0x61E2, 0xA3C9, 0xABCA,
+  0xABEA, 0xABEA, 0xA3A9, 0xA3C9, 0xA3A9, 0xABEA, 0xAC0B, 0xA3C9,
+  0xA3EA, 0xAC0A, 0xA3A9, 0xA3A9, 0x61E2, 0xA3CA, 0xABEA, 0xABEA,
+  0xABEA, 0xA3A9, 0xA3C9, 0xA3A9, 0xABEA, 0xAC0A, 0xA3CA, 0xA3EA,
+  0xAC0A, 0xA3A9, 0xA3A9, 0x69E3, 0xA3CA, 0xABEA, 0xABEA, 0xABEA,
+  0xA3A9, 0xA3A9, 0xA3A9, 0xABEA, 0xABEA, 0xA3CA, 0xA3CA, 0xAC0A,
+  0xA3A9, 0xA3A9, 0x69E3, 0xABEA, 0xABEA, 0xABEA, 0xA3CA, 0xA3A9,
+  0xA3A9, 0xA3A9, 0xABCA, 0xABEA, 0xA3CA, 0xABCA, 0xAC0A, 0xA3A9,
+  0xA3A9, 0x6A03, 0xABEA, 0xABCA, 0xABEA, 0xA3CA, 0xA3C9, 0xA3A9,
+  0xA3A9, 0xABCA, 0xABEA, 0xA3CA, 0xABCA, 0xABEA, 0xA3A9, 0xA3A9,
+  0x61E2, 0xAC0A, 0xA3CA, 0xABCA, 0xA3C9, 0xA3CA, 0xA3A9, 0xA3A9,
+  0xABEA, 0xABEA, 0xA3CA, 0xABEA, 0xABEA, 0xA3A9, 0xA3A9, 0x69E3,
+  0xABEA, 0xABEA, 0xA3CA, 0xA3A9, 0xA3CA, 0xA3A9, 0xA3A9, 0xABCA,
+  0xABEA, 0xA3CA, 0xABCA, 0xABEA, 0xA3A9, 0xA3A9, 0x6A03, 0xABEA,
+  0xABEA, 0xA3CA, 0xA389, 0xA3CA, 0xA3A9, 0xA3A9, 0xA3CA, 0xABEA,
+  0xA3CA, 0xABEA, 0xABEA, 0xA3A9, 0xA3A9, 0x6A03, 0xABEA, 0xABEA,
+  0xA3CA, 0x9B89, 0xA3CA, 0xA3A9, 0xA3A9, 0xA3A9, 0xABEA, 0xA3CA,
+  0xABEA, 0xABCA, 0xA3A9, 0xA3A9, 0x61C2, 0xABEA, 0xABEA, 0xA3CA,
+  0x9B89, 0xA3CA, 0xA3A9, 0xA389, 0xA3A9, 0xABEA, 0xA3CA, 0xABEA,
+  0xABEA, 0xA3A9, 0xA3CA, 0x6A03, 0xA3A9, 0xABCA, 0xABCA, 0x9B68,
+  0xA3C9, 0xA3A9, 0x9B89, 0xA3A9, 0xABEA, 0xA3CA, 0xABEA, 0xABCA,
+  0xA3A9, 0xA3CA, 0x61E2, 0xA3A9, 0xABEA, 0xABEA, 0x9B68, 0xA3CA,
+  0xA3CA, 0xA3A9, 0xA3A9, 0xAC0B, 0xABEA, 0xAC0B, 0xABEA, 0xA3A9,
+  0xABEA, 0x61C2, 0x61C2, 0x61C2, 0x61E2, 0x61E2, 0x61E3, 0x69E3,
+  0x69E3, 0x6A03, 0x6A03, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x61E3,
+  0x7AA5, 0x61E3, 0x6203, 0x6203, 0x6A03, 0x6203, 0x6203, 0x61E3,
+  0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6203, 0x6203, 0x8AE6,
+  0x6203, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61C2,
+  0x61C2, 0x61C2, 0x61C3, 0x61C2, 0x59C2, 0x59C2, 0x82C6, 0x61E3,
+  0x61E3, 0x61C3, 0x61C2, 0x61C2, 0x61C3, 0x61C3, 0x61C3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61C3, 0x82A6, 0x6A03, 0x6A03,
+  0x6A03, 0x69E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61C2, 0x61C2,
+  0x59C2, 0x59C2, 0x59C2, 0x61C2, 0x7AA6, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61C3, 0x61C2, 0x7AA5, 0x6A03, 0x6A24, 0x6A04, 0x6A04,
+  0x6A04, 0x6A04, 0x6A04, 0x6A24, 0x6A04, 0x6A04, 0x6A24, 0x6A24,
+  0x6A03, 0x6A03, 0x7AC6, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x69E3,
+  0x61C3, 0x7A85, 0x61E3, 0x6203, 0x69E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x69E3, 0x69E3, 0x69E3, 0x61E3,
+  0x7AA6, 0x6A03, 0x6203, 0x6A03, 0x6A03, 0x6A04, 0x6A03, 0x6A04,
+  0x6A24, 0x6A24, 0x7244, 0x7244, 0x7224, 0x6A44, 0x6A24, 0x82E6,
+  0x6A03, 0x6A03, 0x6A03, 0x61E3, 0x61E3, 0x61E3, 0x61C2, 0x61C3,
+  0x61C3, 0x61C2, 0x61C2, 0x61C3, 0x61C2, 0x61C2, 0x7A85, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x6A03, 0x6A04, 0x6A03, 0x6203, 0x7AA6, 0x6203, 0x6203,
+  0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E2, 0x82C6, 0x61E3, 0x6203, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E2, 0x7A85, 0x61E2, 0x61E3, 0x61C2, 0x61C2,
+  0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C2, 0x59A2, 0x7A64, 0xAC0A, 0xA3EA, 0xABEB, 0x9B89, 0xA3C9,
+  0x9B89, 0xA3CA, 0xA3A9, 0x9B68, 0xA3A9, 0x9B88, 0x9BA9, 0x9B89,
+  0x9B69, 0x9B89, 0xAC0A, 0xAC0A, 0xAC0A, 0xA3A9, 0xABC9, 0xA3A9,
+  0xABEA, 0xA3C9, 0xA3A9, 0xA3C9, 0xA3A9, 0xA3C9, 0xA3A9, 0x9B89,
+  0x9BA9, 0xB42B, 0xAC0A, 0xB42B, 0xA3A9, 0xABEA, 0xA3A9, 0xABEA,
+  0xA3C9, 0xA3A9, 0xA3C9, 0x9BA9, 0xA3C9, 0xA3A9, 0xA389, 0x9BA9,
+  0xB42B, 0xAC0A, 0xAC0B, 0xA3A9, 0xABEA, 0xA3A9, 0xABEA, 0xA3A9,
+  0xA3CA, 0xA3A9, 0xA3A9, 0xA3CA, 0xA3A9, 0xA389, 0x9BA9, 0xB44B,
+  0xAC2A, 0xAC0A, 0xA3A9, 0xABEA, 0xA3A9, 0xABEA, 0xA389, 0xABEA,
+  0xA389, 0xA3A9, 0xA3CA, 0xA3A9, 0xA389, 0xA389, 0xB44B, 0xAC2A,
+  0xAC0A, 0xA3A9, 0xABEA, 0xA3A9, 0xABCA, 0xA3A9, 0xABEA, 0xA3A9,
+  0xA3A9, 0xA3A9, 0xA3A9, 0xA389, 0x9B89, 0xB44B, 0xAC0A, 0xAC0A,
+  0xA3C9, 0xABEA, 0xA3A9, 0xABCA, 0xA3A9, 0xABCA, 0xA3A9, 0xA3A9,
+  0xA3A9, 0xA3A9, 0xA389, 0xA389, 0xBC6C, 0xAC0A, 0xABEA, 0xA3CA,
+  0xABEA, 0xA3A9, 0xABCA, 0xA3A9, 0xABCA, 0xA389, 0xA3A9, 0xA3A9,
+  0xA3A9, 0x9B88, 0xA389, 0xBC4B, 0xB40A, 0xABEA, 0xA3CA, 0xABEA,
+  0xA3A9, 0xA3C9, 0xA3A9, 0xA3CA, 0xA389, 0xA3C9, 0xA3A9, 0xA3A9,
+  0x9B68, 0xA389, 0xBC4B, 0xB40A, 0xABEA, 0xA3CA, 0xABEA, 0xA389,
+  0xA3A9, 0xA3A9, 0xA3CA, 0xA3A9, 0xA3C9, 0xA3A9, 0xA3A9, 0x9B68,
+  0xA389, 0xBC6C, 0xB40A, 0xABEA, 0xA3C9, 0xABEA, 0xA3A9, 0xA3A9,
+  0xA3A9, 0xA3A9, 0xA3A9, 0xA3CA, 0xA3A9, 0xA3A9, 0x9B68, 0xA3A9,
+  0xB44C, 0xB40B, 0xABCA, 0xA3CA, 0xABEA, 0xA3A9, 0xA3A9, 0xA3CA,
+  0xA3C9, 0xA3A9, 0xA3CA, 0x9B89, 0xA3A9, 0x9B68, 0xA389, 0xBC6C,
+  0xB42B, 0xABCA, 0xABCA, 0xABCA, 0xA3A9, 0xA3A9, 0xABCA, 0xA3C9,
+  0xA389, 0xA3CA, 0x9B88, 0xA3A9, 0x9B48, 0xA389, 0xBC6C, 0xB42B,
+  0xA3A9, 0xA3CA, 0xA3C9, 0xA3A9, 0xA3A9, 0xABEA, 0xA3A9, 0xA389,
+  0xA3C9, 0x9B88, 0xA3A9, 0x9B68, 0xA3A9, 0xBC8C, 0xB44B, 0xA3CA,
+  0xAC0B, 0xA3EA, 0xA3A9, 0xA3CA, 0xAC0B, 0xA3CA, 0xA3A9, 0xABCA,
+  0x9B89, 0xA3CA, 0x9348, 0xA3AA, 0x7224, 0x61E3, 0x6204, 0x6204,
+  0x6A24, 0x6A24, 0x7245, 0x7265, 0x7245, 0x7245, 0x6A45, 0x6A24,
+  0x6A24, 0x6A05, 0x6A25, 0x61E3, 0x5183, 0x5183, 0x59A3, 0x59A3,
+  0x59C3, 0x61E3, 0x6A04, 0x6A25, 0x6204, 0x61E4, 0x61E4, 0x61E3,
+  0x61E4, 0x61C3, 0x6A24, 0x59C3, 0x61C3, 0x61E3, 0x61E3, 0x61E3,
+  0x69E4, 0x61E3, 0x61E3, 0x6A03, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x6A24, 0x6A24, 0x6204, 0x61E3, 0x61C3, 0x59A2, 0x59A2, 0x59A3,
+  0x61C3, 0x6204, 0x6A04, 0x6A04, 0x6A24, 0x6A24, 0x6A24, 0x6A04,
+  0x7265, 0x6204, 0x6204, 0x61E4, 0x61E4, 0x61E4, 0x6204, 0x6204,
+  0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x61E4, 0x61C3, 0x6204,
+  0x51A3, 0x59A3, 0x59C3, 0x59C3, 0x59C3, 0x61C3, 0x61E3, 0x59C3,
+  0x59C3, 0x59A3, 0x51A3, 0x5183, 0x51A2, 0x5182, 0x7245, 0x59E4,
+  0x59E4, 0x59C3, 0x59C3, 0x59E4, 0x59E4, 0x61C3, 0x61C3, 0x61E4,
+  0x61E4, 0x61E4, 0x61E4, 0x59C3, 0x59A3, 0x6A24, 0x59C3, 0x59C3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61C3,
+  0x61E3, 0x61E3, 0x6204, 0x6204, 0x7285, 0x6A24, 0x6A04, 0x6A04,
+  0x6A04, 0x6A24, 0x6A04, 0x6A04, 0x6204, 0x61E4, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61C3, 0x7285, 0x6204, 0x6A04, 0x6A04, 0x6A04,
+  0x6A04, 0x6A24, 0x6225, 0x6224, 0x6A24, 0x6A04, 0x6A24, 0x6A24,
+  0x6A44, 0x6A25, 0x7244, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3,
+  0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x61C3, 0x61E3, 0x61E3,
+  0x61C3, 0x7A65, 0x6A04, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A25, 0x6A24, 0x6A24, 0x6A24,
+  0x7265, 0x6A03, 0x6A03, 0x6A04, 0x6A04, 0x6A24, 0x6A24, 0x6A24,
+  0x6A04, 0x6A04, 0x69E3, 0x61E3, 0x61E3, 0x61E3, 0x59A3, 0x7A85,
+  0x6203, 0x6A24, 0x6A24, 0x6A04, 0x6204, 0x6203, 0x61E3, 0x61E3,
+  0x61E3, 0x61E4, 0x61E4, 0x6A04, 0x6204, 0x6204, 0x7A85, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x6A04, 0x6A24, 0x6A04, 0x6204, 0x6A24,
+  0x6A04, 0x6A04, 0x61E4, 0x6204, 0x61E3, 0x8B07, 0xB44C, 0xAC0A,
+  0xA3CA, 0xA3A9, 0x9B48, 0xABEA, 0x9B89, 0x9B89, 0xA3CA, 0xABEA,
+  0x9B68, 0x9B89, 0xA3A9, 0x9368, 0x8B07, 0xB44B, 0xABEA, 0xA3CA,
+  0xA3A9, 0x9B68, 0xABEA, 0x9B68, 0x9B88, 0xA3CA, 0xA3CA, 0x9B68,
+  0x9B89, 0xA3A9, 0x9B48, 0x8B27, 0xB44B, 0xABEA, 0xA3CA, 0xA3A9,
+  0x9B68, 0xABEA, 0x9B68, 0x9B88, 0xA3CA, 0xA3A9, 0x9B88, 0x9B89,
+  0xA389, 0x9B48, 0x8B28, 0xB42B, 0xABEA, 0xA3C9, 0xA3A9, 0x9B68,
+  0xABEA, 0x9B68, 0x9B68, 0xA3CA, 0xA3A9, 0xA389, 0x9B89, 0xA389,
+  0x9B48, 0x8B07, 0xB42B, 0xABC9, 0xA3C9, 0xA3A9, 0x9B68, 0xA3CA,
+  0x9B68, 0x9B68, 0xA3CA, 0xA389, 0xA3A9, 0x9B89, 0x9BA9, 0x9B68,
+  0x82C7, 0xB42B, 0xABC9, 0xA3CA, 0xA3A9, 0x9B48, 0xA3CA, 0x9B89,
+  0x9B68, 0xA3CA, 0x9B89, 0xA3A9, 0x9B89, 0x9B89, 0x9B68, 0x82E7,
+  0xB42B, 0xABC9, 0xA3C9, 0xA3A9, 0x9348, 0xA3C9, 0xA389, 0x9B68,
+  0xA3C9, 0x9B89, 0xABC9, 0x9B89, 0x9B89, 0x9B68, 0x8B07, 0xB42B,
+  0xABC9, 0xA3C9, 0xA3A9, 0x9348, 0xA3A9, 0xA3CA, 0x9B68, 0xA3A9,
+  0x9B89, 0xABCA, 0x9B88, 0x9B89, 0x9B68, 0x8B07, 0xB42B, 0xABC9,
+  0xA3A9, 0xA3A9, 0x9348, 0xA3A9, 0xABEA, 0x9B68, 0xA3A9, 0x9B89,
+  0xABEA, 0x9B89, 0x9B89, 0x9B68, 0x8B28, 0xB42B, 0xA3C9, 0x9BA9,
+  0xA3C9, 0x9348, 0x9B89, 0xABEA, 0x9B68, 0xA3A9, 0x9B89, 0xABEA,
+  0x9B89, 0xA389, 0x9B68, 0x8B07, 0xB42B, 0xABC9, 0x9B89, 0xA3CA,
+  0x9348, 0x9B89, 0xAC0B, 0x9348, 0xA3A9, 0x9B89, 0xA3CA, 0x9B89,
+  0xA389, 0x9B68, 0x8B07, 0xB42B, 0xABCA, 0x9B89, 0xABEA, 0x9348,
+  0x9B89, 0xB42B, 0x9347, 0xA3C9, 0xA389, 0xA3CA, 0x9BA9, 0xA389,
+  0x9B88, 0x82E7, 0xB42B, 0xABEA, 0x9B68, 0xABEA, 0x9348, 0x9B68,
+  0xB42B, 0x9B48, 0xA3C9, 0xA3A9, 0xA3CA, 0xA3A9, 0xA389, 0x9B88,
+  0x8B07, 0xB42B, 0xABEA, 0x9B68, 0xAC0B, 0x9B48, 0x9B68, 0xB42B,
+  0x9B88, 0xA3A9, 0xA3A9, 0xA3C9, 0xA3A9, 0xA3A9, 0x9B88, 0x8B28,
+  0xB44C, 0xAC0B, 0x9B89, 0xB42B, 0x9B89, 0x9B89, 0xB44B, 0xA3A9,
+  0xA3CA, 0xABEA, 0xA3EA, 0xA3A9, 0xA3CA, 0x9B89, 0x9348, 0x59A2,
+  0x59A2, 0x59A2, 0x59A2, 0x59C2, 0x59C3, 0x59C3, 0x61C3, 0x61E3,
+  0x61E3, 0x61E4, 0x6204, 0x6204, 0x6204, 0x9B69, 0x6A24, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6204, 0x6204, 0x6204, 0x61E4,
+  0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x9B48, 0x6A03, 0x6204, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x6204, 0x6204, 0x61E4, 0x9B69, 0x6204, 0x6204, 0x6A04, 0x6A24,
+  0x6224, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A25, 0x6204, 0x6205,
+  0x6204, 0x6204, 0x9B68, 0x59A2, 0x59A3, 0x59A3, 0x59A3, 0x5983,
+  0x5182, 0x5182, 0x5162, 0x5162, 0x5162, 0x5162, 0x5162, 0x5182,
+  0x5182, 0x9B69, 0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x61E4,
+  0x61E4, 0x61E4, 0x61E4, 0x61C4, 0x61E4, 0x59C4, 0x59C3, 0x59C4,
+  0x9B68, 0x5182, 0x5182, 0x51A2, 0x59A3, 0x59C3, 0x59C3, 0x61E3,
+  0x61E4, 0x6204, 0x6A05, 0x6A25, 0x6A25, 0x6A25, 0x6A25, 0x9B69,
+  0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x61E4, 0x61E4,
+  0x61E4, 0x61E4, 0x61E4, 0x59C3, 0x59C3, 0x59C3, 0x9B69, 0x59A2,
+  0x59A3, 0x59A3, 0x59A3, 0x59A3, 0x59A3, 0x59A3, 0x59A3, 0x59A3,
+  0x59A3, 0x59A3, 0x59C3, 0x59C3, 0x61E4, 0x9B89, 0x61E3, 0x61E4,
+  0x6204, 0x6A04, 0x6204, 0x6204, 0x6204, 0x6A04, 0x6A24, 0x6A25,
+  0x6A45, 0x7245, 0x7245, 0x6A45, 0x9B89, 0x6204, 0x6204, 0x6204,
+  0x61E4, 0x61E4, 0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x6204,
+  0x6A04, 0x6A24, 0x6224, 0x9B89, 0x6204, 0x6204, 0x6204, 0x6204,
+  0x6204, 0x61E4, 0x61E3, 0x61E3, 0x59C3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x6204, 0x9B89, 0x59C3, 0x59C3, 0x61C3, 0x61E4, 0x61E4,
+  0x6204, 0x6A24, 0x6A25, 0x6A45, 0x7265, 0x6A45, 0x6A45, 0x7265,
+  0x6A45, 0x9B89, 0x6204, 0x6204, 0x6204, 0x6204, 0x6204, 0x6204,
+  0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x6204,
+  0x9BA9, 0x61C3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x59C3, 0x61E3, 0x61C3, 0x6A24,
+  0x8B28, 0xA3CA, 0x9B68, 0xA3A9, 0x9348, 0xA3A9, 0xA3A9, 0x9B89,
+  0xA3A9, 0x9B89, 0x9B89, 0x9B89, 0x9B69, 0xA3AA, 0x61C3, 0x9328,
+  0xA3CA, 0x9B48, 0xA3A9, 0x9327, 0xA389, 0xA3A9, 0x9B68, 0xA3A9,
+  0xA389, 0x9B88, 0x9B68, 0x9B68, 0xA3A9, 0x6204, 0x9328, 0xA3C9,
+  0x9348, 0xA3A9, 0x9328, 0xA389, 0xA3A9, 0x9B89, 0xA389, 0xA3A9,
+  0x9B89, 0x9B69, 0x9B68, 0xA3CA, 0x6204, 0x9348, 0xA3A9, 0x9347,
+  0xA3A9, 0x9328, 0x9B89, 0xA3A9, 0x9B89, 0xA3A9, 0x9B89, 0x9B89,
+  0x9B69, 0x9B68, 0xA3A9, 0x5182, 0x8B07, 0xABC9, 0x9327, 0xA3A9,
+  0x9327, 0x9B89, 0xA389, 0x9B89, 0xA389, 0xA389, 0x9B88, 0x9B68,
+  0x9B68, 0xA3C9, 0x59C3, 0x8B07, 0xABCA, 0x9307, 0xA3AA, 0x9327,
+  0x9B89, 0x9B89, 0xA389, 0xA3A9, 0xA389, 0x9B88, 0x9B68, 0x9B68,
+  0xA3CA, 0x6225, 0x9348, 0xABC9, 0x9307, 0xA3A9, 0x9327, 0x9B69,
+  0x9B89, 0xA389, 0xA3A9, 0xA3A9, 0x9B88, 0x9B48, 0x9B68, 0xA3CA,
+  0x59C3, 0x8B07, 0xABC9, 0x9307, 0xA3A9, 0x9327, 0x9B89, 0x9B89,
+  0xA3A9, 0xA389, 0xA3A9, 0x9B88, 0x9B48, 0x9B68, 0xA3CA, 0x61E4,
+  0x8B07, 0xABCA, 0x9307, 0xA3A9, 0x9327, 0x9B69, 0x9B89, 0xA3A9,
+  0x9B89, 0xA3A9, 0x9B88, 0x9B48, 0x9B68, 0xA3C9, 0x6A24, 0x9328,
+  0xA3CA, 0x9327, 0xA3A9, 0x9327, 0x9B68, 0x9B89, 0xA3A9, 0x9B89,
+  0xA389, 0x9B89, 0x9B48, 0x9348, 0xA3C9, 0x6A03, 0x8B07, 0xA3CA,
+  0x9327, 0xA3A9, 0x9327, 0x9B68, 0x9B89, 0xA3A9, 0x9B88, 0x9B89,
+  0x9B89, 0x9B48, 0x9348, 0xA3C9, 0x61E3, 0x8B07, 0xA3A9, 0x9327,
+  0xA3A9, 0x9328, 0x9B68, 0x9B89, 0xA3A9, 0x9B88, 0x9B89, 0x9B89,
+  0x9348, 0x9348, 0xA3A9, 0x7265, 0x8B07, 0xA3A9, 0x9327, 0xA3A9,
+  0x9348, 0x9B48, 0xA389, 0xA3A9, 0x9B88, 0x9B89, 0x9B89, 0x9348,
+  0x9348, 0xA3A9, 0x61E4, 0x8AE7, 0xA389, 0x9327, 0xA3A9, 0x9348,
+  0x9B48, 0xA389, 0xA3A9, 0x9B88, 0x9B88, 0x9B69, 0x9348, 0x9348,
+  0xA3A9, 0x61E3, 0x82E7, 0xA38A, 0x9328, 0xA3AA, 0x9348, 0x9B69,
+  0xA3AA, 0xA3AA, 0x9B89, 0x9B89, 0x9B89, 0x9B49, 0x9B69, 0xA3AA,
+  0x9B89, 0xA3CA, 0x9B68, 0xA3AA, 0x9B89, 0x9B89, 0xA3CA, 0x9368,
+  0x9B89, 0x9B69, 0x9B69, 0xA3A9, 0xA3A9, 0x8B06, 0x6A23, 0xA3CA,
+  0xB42B, 0x9B89, 0xAC0B, 0xA3A9, 0xABEA, 0xAC0B, 0x9B88, 0xA3CA,
+  0xA3A9, 0x9B89, 0xABEA, 0xA3A9, 0x8B07, 0x69E3, 0xA3C9, 0xAC0A,
+  0xA3A9, 0xAC0A, 0xA3A9, 0xABEA, 0xAC0A, 0x9B88, 0xA3C9, 0xA3A9,
+  0x9B88, 0xABEA, 0xA3A9, 0x8B27, 0x61C3, 0xABEA, 0xAC0A, 0x9B88,
+  0xAC0A, 0xA3A9, 0xABEA, 0xAC0A, 0x9B88, 0xA3C9, 0xA3A9, 0x9B89,
+  0xABEA, 0xA3A9, 0x9327, 0x6A03, 0xABCA, 0xAC0A, 0xA389, 0xB42B,
+  0x9B89, 0xABEA, 0xAC0A, 0x9B88, 0xA3C9, 0xA3A9, 0x9B89, 0xABEA,
+  0xA3A9, 0x9348, 0x6A03, 0xABEA, 0xABEA, 0xA389, 0xB40B, 0x9B68,
+  0xABEA, 0xAC0A, 0x9B88, 0xA3C9, 0xA3A9, 0x9B89, 0xABEA, 0xA3A9,
+  0x9327, 0x69E3, 0xABEA, 0xABEA, 0xA3A9, 0xAC0B, 0x9B68, 0xABEA,
+  0xAC0B, 0x9B68, 0xA3A9, 0xA3A9, 0x9B89, 0xABEA, 0xA3A9, 0x9328,
+  0x6A03, 0xABEA, 0xABEA, 0xA3A9, 0xB40B, 0x9B68, 0xABEA, 0xAC0B,
+  0x9B68, 0xA3A9, 0xA3A9, 0x9B89, 0xABEA, 0xA3A9, 0x9328, 0x6A04,
+  0xABEA, 0xABCA, 0xA3A9, 0xB42B, 0x9348, 0xABEA, 0xB42B, 0x9B68,
+  0xA3A9, 0xA3A9, 0x9B89, 0xABEA, 0xA3A9, 0x8B07, 0x61E3, 0xABEA,
+  0xABCA, 0xA3A9, 0xAC0B, 0x9348, 0xABEA, 0xB42B, 0x9B68, 0xA3C9,
+  0xA3A9, 0x9B69, 0xABEA, 0xA3A9, 0x8B27, 0x6A04, 0xABEA, 0xA3CA,
+  0xA3A9, 0xAC0B, 0x9B48, 0xABEA, 0xB42B, 0x9B68, 0xA3C9, 0xA3A9,
+  0x9B69, 0xABEA, 0xA3A9, 0x8B27, 0x6A03, 0xAC0A, 0xA3C9, 0xA3A9,
+  0xAC0B, 0x9B68, 0xA3CA, 0xB42B, 0x9B68, 0xA3A9, 0xA3A9, 0x9B89,
+  0xA3CA, 0xA3A9, 0x8B27, 0x7224, 0xAC0A, 0xA3C9, 0xA3A9, 0xAC0A,
+  0x9B68, 0xA3C9, 0xB42B, 0x9B68, 0xA3A9, 0xA3A9, 0x9B68, 0xA3CA,
+  0xA3A9, 0x8B07, 0x6A03, 0xABEA, 0xA3A9, 0xA3A9, 0xABEA, 0xA389,
+  0xA3C9, 0xB42B, 0x9B68, 0xA3A9, 0xA3A9, 0x9B68, 0xA3CA, 0xA3A9,
+  0x8B07, 0x6A03, 0xAC0B, 0xA3A9, 0xA3C9, 0xABEA, 0xA3A9, 0xA3CA,
+  0xB42B, 0x9B68, 0xA3A9, 0xA3C9, 0x9B89, 0xABEA, 0xA3AA, 0x8AE7,
+  0x6A03, 0x6A23, 0x6A23, 0x6A23, 0x6A03, 0x6A23, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x7223, 0x7223, 0x6A03, 0x6A23, 0x6A03, 0xA3A9,
+  0x61E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3,
+  0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x61E3, 0x69E3, 0xABEA, 0x69E3,
+  0x69E3, 0x69E3, 0x6A03, 0x6A03, 0x6A04, 0x6A04, 0x6A04, 0x6A04,
+  0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A03, 0xABEA, 0x6A04, 0x6A04,
+  0x6A24, 0x6A04, 0x7224, 0x6A24, 0x6A04, 0x6A24, 0x6A24, 0x6A04,
+  0x6A04, 0x6A04, 0x6A03, 0x69E3, 0xABEA, 0x6A24, 0x6A04, 0x6A03,
+  0x6A03, 0x6A03, 0x69E3, 0x69E3, 0x6A03, 0x6A03, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x69E2, 0xABEA, 0x6A03, 0x6A03, 0x6A04, 0x6A04,
+  0x6A03, 0x6A04, 0x6A03, 0x6A03, 0x69E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x69E3, 0xABEA, 0x6A04, 0x6A04, 0x6A03, 0x6A03, 0x6A03,
+  0x6A03, 0x6A04, 0x6A24, 0x7224, 0x7224, 0x7224, 0x7224, 0x7244,
+  0x7224, 0xABEA, 0x6A04, 0x6A03, 0x6A03, 0x6A03, 0x6A04, 0x6A04,
+  0x6A03, 0x6A04, 0x6A04, 0x6A03, 0x6A03, 0x6A03, 0x69E3, 0x69E3,
+  0xABEA, 0x61C3, 0x61E3, 0x69E3, 0x69E3, 0x6A03, 0x6A03, 0x6A04,
+  0x6A04, 0x6A24, 0x6A24, 0x7224, 0x7224, 0x7224, 0x7224, 0xABEA,
+  0x7224, 0x7224, 0x7224, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244,
+  0x7244, 0x7244, 0x7244, 0x7244, 0x7244, 0x7224, 0xABEA, 0x6A03,
+  0x6A03, 0x69E3, 0x69E3, 0x69E3, 0x6A03, 0x69E3, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x6A04, 0x6A03, 0xABEA, 0x7224, 0x7224,
+  0x7224, 0x7244, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224,
+  0x7224, 0x7224, 0x6A04, 0x6A03, 0xABEB, 0x6A03, 0x6A04, 0x6A03,
+  0x6A03, 0x6A03, 0x6A04, 0x6A24, 0x6A24, 0x6A04, 0x6A03, 0x6A03,
+  0x6A24, 0x7224, 0x6A24, 0xABEB, 0x6A03, 0x6A04, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x6A04, 0x6A03, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x6A03, 0x6A03, 0xABEA, 0x6A03, 0x69E3, 0x69E3, 0x69E3, 0x61E3,
+  0x69E3, 0x69E3, 0x61E3, 0x69E3, 0x69E3, 0x69E3, 0x69E3, 0x6A03,
+  0x69E2, 0xAC0B, 0x9B88, 0x9348, 0x9B89, 0xABEA, 0x9B69, 0x9B89,
+  0x9B89, 0x9B89, 0x9B68, 0x9348, 0x9BA9, 0x9B68, 0x9B68, 0x9B89,
+  0x7A85, 0xA3A9, 0x9B89, 0x9BA9, 0xB44B, 0x9B89, 0xA3CA, 0xABEA,
+  0xA3C9, 0xA3A9, 0xA3A9, 0xABEA, 0xA3A9, 0xA3C9, 0xA3CA, 0x7AA5,
+  0x9B88, 0x9B89, 0x9B89, 0xB42B, 0xA3A9, 0xA3C9, 0xA3CA, 0xA3A9,
+  0xA3A9, 0xA3A9, 0xABEA, 0xA3C9, 0xA3A9, 0xA3C9, 0x7A85, 0x9B88,
+  0xA389, 0x9B89, 0xB42B, 0xA3A9, 0xA3A9, 0xABEA, 0x9B89, 0xA3A9,
+  0x9B89, 0xABEA, 0xA3A9, 0xA3A9, 0xA3A9, 0x7A85, 0x9B88, 0xA389,
+  0xA3A9, 0xAC0B, 0xA3CA, 0xA3A9, 0xABEA, 0x9B88, 0xA3A9, 0x9B89,
+  0xABEA, 0xA3A9, 0xABCA, 0xA3A9, 0x82A6, 0x9B68, 0xA3A9, 0xA3A9,
+  0xAC0A, 0xA3C9, 0x9B89, 0xAC0B, 0x9B68, 0xA389, 0x9B89, 0xABEA,
+  0xA3A9, 0xA3A9, 0xA3AA, 0x7A85, 0x9B68, 0xA3A9, 0xA3A9, 0xAC0A,
+  0xA3C9, 0xA389, 0xABEB, 0x9B89, 0xA389, 0x9B89, 0xABEA, 0xA3A9,
+  0xA3A9, 0xA3CA, 0x82C6, 0x9B68, 0xA3A9, 0x9B89, 0xAC0A, 0xA3C9,
+  0xA389, 0xABEA, 0x9B89, 0x9B89, 0x9B89, 0xABEA, 0xA3A9, 0xA3A9,
+  0xA3CA, 0x82A6, 0x9B68, 0xA3CA, 0x9B89, 0xABEA, 0xA3C9, 0xA3A9,
+  0xABEA, 0x9B89, 0x9B89, 0x9B88, 0xA3CA, 0xA3C9, 0xA389, 0xA3CA,
+  0x82A5, 0x9B68, 0xA3CA, 0x9B89, 0xABEA, 0xA3C9, 0xA389, 0xABCA,
+  0x9B89, 0x9B89, 0x9B88, 0xA3CA, 0xA3C9, 0xA389, 0xA3AA, 0x82A6,
+  0x9B68, 0xA3CA, 0x9B89, 0xA3C9, 0xABEA, 0x9B89, 0xA3CA, 0x9B89,
+  0x9B89, 0x9B88, 0xA3CA, 0xA3C9, 0xA3A9, 0xA3CA, 0x82C6, 0x9B68,
+  0xA3CA, 0x9B89, 0xABCA, 0xABEA, 0xA389, 0xA3A9, 0x9B89, 0xA389,
+  0x9B89, 0xA3CA, 0xA3C9, 0xA3A9, 0xA3AA, 0x7A85, 0x9B68, 0xA3CA,
+  0x9B89, 0xABCA, 0xABEA, 0xA389, 0xA3A9, 0xA389, 0xA3A9, 0x9B68,
+  0xA3A9, 0xA3C9, 0xA3A9, 0xA3A9, 0x82A6, 0x9B68, 0xA3C9, 0x9B68,
+  0xA3CA, 0xABEA, 0xA389, 0xA389, 0xA389, 0xA3A9, 0x9B68, 0xA3A9,
+  0xA3A9, 0xA3C9, 0x9B89, 0x7A85, 0x9B68, 0xA3CA, 0x9B89, 0xABCA,
+  0xABEA, 0xA389, 0xA389, 0xA3A9, 0xA3AA, 0x9B88, 0xA3A9, 0xA3A9,
+  0xA3CA, 0xA3A9, 0x82C6, 0x59C3, 0x6204, 0x59C3, 0x59C3, 0x59C3,
+  0x51A3, 0x59C3, 0x6204, 0x59C3, 0x59C3, 0x59C3, 0x6204, 0x6204,
+  0x7265, 0x7265, 0x61E3, 0x6204, 0x61E3, 0x6203, 0x61E3, 0x6204,
+  0x61E3, 0x6204, 0x6204, 0x6204, 0x6204, 0x61E3, 0x6204, 0x6204,
+  0x7244, 0x61C2, 0x61C2, 0x61C2, 0x59A2, 0x59A2, 0x5982, 0x5982,
+  0x59A2, 0x5182, 0x5182, 0x5182, 0x59A2, 0x59A2, 0x59A1, 0x6A23,
+  0x61C2, 0x61E3, 0x61E3, 0x61E3, 0x6A03, 0x69E3, 0x61E3, 0x6203,
+  0x6203, 0x6203, 0x6203, 0x6A24, 0x6A24, 0x6A24, 0x7264, 0x6A03,
+  0x6A23, 0x6A24, 0x6A03, 0x6A03, 0x6A03, 0x6203, 0x6203, 0x6A03,
+  0x6A03, 0x6A24, 0x6A24, 0x6A04, 0x6A24, 0x7244, 0x61C2, 0x61E2,
+  0x61E2, 0x61E2, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61C3, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A03, 0x6A03, 0x6203,
+  0x6203, 0x61E3, 0x61E3, 0x7224, 0x6A03, 0x6A24, 0x6A04, 0x6A04,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x6A24, 0x6A04, 0x7244, 0x61C3, 0x61E3, 0x61C2, 0x61C2, 0x61C2,
+  0x59A2, 0x59A2, 0x59A2, 0x61C2, 0x59A2, 0x61C2, 0x61C2, 0x61C2,
+  0x61C3, 0x6A04, 0x6A24, 0x7224, 0x6A24, 0x7224, 0x7224, 0x6A24,
+  0x7224, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x7245, 0x7A65, 0x7265, 0x7265, 0x7265, 0x7265, 0x7265, 0x7265,
+  0x7265, 0x7A65, 0x7265, 0x7265, 0x7265, 0x7265, 0x7265, 0x7A65,
+  0x6A03, 0x6A04, 0x6A04, 0x6A04, 0x6A03, 0x6A03, 0x6A04, 0x6A03,
+  0x69E3, 0x69E3, 0x61E3, 0x61C3, 0x61E3, 0x69E3, 0x7224, 0x7224,
+  0x7224, 0x6A24, 0x6A24, 0x6A24, 0x6A04, 0x6A24, 0x6A24, 0x7244,
+  0x7244, 0x7244, 0x7244, 0x6A24, 0x6A24, 0x7244, 0x6A03, 0x6A24,
+  0x6A04, 0x6A24, 0x6A04, 0x6A03, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61C3, 0x61C3, 0x61E3, 0x6A04, 0x7224, 0x7244, 0x6A24, 0x6A24,
+  0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x69E3,
+  0x6A03, 0x6A03, 0x69E3, 0x6A03, 0x82E7, 0xA3EA, 0x9BAA, 0x9369,
+  0x7AC7, 0x8B28, 0x8B28, 0x82E7, 0x9349, 0x9327, 0x9B89, 0x9327,
+  0x9B68, 0x9348, 0xA3CA, 0x9B89, 0xB42B, 0xABEA, 0x9B88, 0x9368,
+  0xA3C9, 0x9B88, 0x9B89, 0xA3CA, 0x9B68, 0xABEB, 0x9B68, 0xA3A9,
+  0x9B89, 0xABEB, 0x9B68, 0xB42B, 0xABCA, 0x9B68, 0x9B68, 0xA389,
+  0x9B68, 0x9B89, 0xA3A9, 0x9B48, 0xABEA, 0x9B68, 0xA3A9, 0x9B88,
+  0xAC0B, 0x9B68, 0xB42B, 0xABCA, 0x9B69, 0x9B48, 0xA389, 0x9B68,
+  0xA389, 0xA3A9, 0x9B68, 0xABEA, 0x9B68, 0xA3A9, 0x9B68, 0xAC0A,
+  0x9B69, 0xB42B, 0xABCA, 0x9B89, 0x9348, 0xA3A9, 0x9B68, 0xA3A9,
+  0xA3A9, 0x9B68, 0xABEA, 0x9B68, 0xA3A9, 0x9B88, 0xABEA, 0x9B68,
+  0xB42B, 0xA3CA, 0x9B88, 0x9348, 0x9B89, 0x9B68, 0xA3A9, 0xA3A9,
+  0x9B89, 0xA3CA, 0x9B89, 0xA3A9, 0x9B89, 0xABEA, 0x9B68, 0xB40B,
+  0xABCA, 0x9B88, 0x9B48, 0xA389, 0x9B88, 0xA3A9, 0xA389, 0xA389,
+  0xA3CA, 0x9B89, 0x9B89, 0x9B89, 0xABEA, 0x9B68, 0xAC0A, 0xABCA,
+  0x9B89, 0x9B48, 0xA389, 0x9B88, 0xA3A9, 0x9B89, 0xA3A9, 0xA3C9,
+  0x9B89, 0x9B89, 0x9B89, 0xABCA, 0x9B68, 0xAC0A, 0xABCA, 0x9B89,
+  0x9348, 0xA389, 0x9B88, 0xA3A9, 0x9B89, 0xA3A9, 0xA3A9, 0x9B88,
+  0x9B89, 0x9B89, 0xABEA, 0x9B88, 0xAC0A, 0xABCA, 0x9B89, 0x9348,
+  0xA389, 0x9B89, 0xA3A9, 0x9B88, 0xA3A9, 0xA3A9, 0x9B88, 0x9B89,
+  0xA389, 0xABEA, 0x9B89, 0xABEA, 0xABEA, 0x9B89, 0x9348, 0xA389,
+  0xA389, 0xA3A9, 0x9B88, 0xA3A9, 0xA3A9, 0x9B88, 0xA389, 0xA3A9,
+  0xABEA, 0x9B89, 0xABEA, 0xABEA, 0x9B89, 0x9348, 0xA389, 0xA389,
+  0xA389, 0x9B89, 0xA3A9, 0xA3A9, 0x9B89, 0x9B89, 0xA3A9, 0xABEA,
+  0x9B89, 0xABCA, 0xABEA, 0xA389, 0x9348, 0xA389, 0xA389, 0xA389,
+  0x9B89, 0xA389, 0xA389, 0x9B89, 0x9B89, 0xA3A9, 0xABCA, 0x9B89,
+  0xA3C9, 0xABEA, 0xA389, 0x9B48, 0xA389, 0xA3A9, 0xA3A9, 0xA389,
+  0xA389, 0xA388, 0xA389, 0x9B68, 0xA3A9, 0xA3C9, 0x9B89, 0xA3CA,
+  0xAC0A, 0xA3A9, 0x9B48, 0xA3A9, 0xA3A9, 0xA3A9, 0x9B89, 0xA389,
+  0x9B89, 0x9B89, 0x9B89, 0xA3A9, 0xA3CA, 0x7264, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x6A03, 0x6203, 0x6A03, 0x6A03,
+  0x6A04, 0x6A03, 0x6A44, 0x6A24, 0x7A65, 0x59C3, 0x61E4, 0x61C3,
+  0x61C3, 0x59C3, 0x59C3, 0x59C3, 0x59A3, 0x59C3, 0x59C3, 0x61C3,
+  0x61E3, 0x6203, 0x6A04, 0x7244, 0x51A2, 0x59C3, 0x59C3, 0x59C3,
+  0x59E3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x59E3,
+  0x61E3, 0x61E4, 0x7A85, 0x6203, 0x6203, 0x6203, 0x61E3, 0x59C3,
+  0x59C3, 0x61E3, 0x6203, 0x6204, 0x6224, 0x6204, 0x6204, 0x6204,
+  0x61E3, 0x7A85, 0x6204, 0x6A24, 0x6A24, 0x6A24, 0x6A25, 0x6A24,
+  0x6A04, 0x6A04, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E4,
+  0x7AA6, 0x6A24, 0x6A24, 0x6A24, 0x6A25, 0x6A25, 0x6A25, 0x7245,
+  0x7245, 0x7245, 0x6A25, 0x6A24, 0x6A04, 0x6A03, 0x61E3, 0x7265,
+  0x59C2, 0x59C3, 0x61C3, 0x61C3, 0x61C3, 0x61C3, 0x61E3, 0x61E3,
+  0x6204, 0x6A04, 0x6A04, 0x6A04, 0x6A44, 0x6A24, 0x7AA6, 0x6A24,
+  0x6A24, 0x6A24, 0x6A25, 0x6A45, 0x6A45, 0x6A25, 0x6A24, 0x6A24,
+  0x6A25, 0x7225, 0x6A24, 0x6A24, 0x6A04, 0x7A85, 0x61E3, 0x61E3,
+  0x61C3, 0x61E3, 0x61E4, 0x61E4, 0x6A04, 0x6A24, 0x6A24, 0x6A45,
+  0x7245, 0x7245, 0x7265, 0x7245, 0x7A85, 0x61E3, 0x61E4, 0x69E3,
+  0x61E4, 0x61E4, 0x61E3, 0x61E3, 0x61C3, 0x61E3, 0x61E3, 0x61E4,
+  0x6A04, 0x6A24, 0x6A04, 0x82A6, 0x6A24, 0x6A24, 0x7224, 0x7245,
+  0x7245, 0x7245, 0x7245, 0x7245, 0x7245, 0x7245, 0x7265, 0x7265,
+  0x7265, 0x7245, 0x82A6, 0x6A24, 0x6A25, 0x6A24, 0x6A04, 0x6A04,
+  0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A24, 0x6A24, 0x6A24,
+  0x6A04, 0x82C6, 0x6A24, 0x6A25, 0x6A24, 0x7224, 0x7224, 0x6A24,
+  0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A03, 0x6204, 0x6204, 0x6204,
+  0x8AE7, 0x7A85, 0x7285, 0x7A86, 0x7A86, 0x7A85, 0x7A85, 0x7A86,
+  0x7A86, 0x7A86, 0x7A86, 0x7A86, 0x7A86, 0x7286, 0x7265, 0x7AA6,
+  0x59C2, 0x61E3, 0x59C3, 0x59C3, 0x61C3, 0x61E3, 0x61E3, 0x6204,
+  0x6204, 0x6224, 0x6A04, 0x6A24, 0x6A24, 0x7244, 0x7A65, 0x9B69,
+  0x9B89, 0xA3CA, 0x9348, 0xA3A9, 0x9B89, 0x9B69, 0x9B89, 0x9328,
+  0x9B69, 0xA3A9, 0x9B69, 0x9348, 0x9B69, 0x7A65, 0x9B89, 0xA3A9,
+  0xABEA, 0x9B68, 0xA3C9, 0xA3A9, 0xA389, 0xA389, 0x9328, 0x9B89,
+  0xA3CA, 0x9B68, 0x9B49, 0xA389, 0x7245, 0x9B89, 0xA3A9, 0xABEA,
+  0x9B68, 0xA3A9, 0xA3A9, 0xA389, 0xA3A9, 0x9328, 0x9B89, 0xA3A9,
+  0x9B88, 0x9B48, 0xA369, 0x7224, 0x9B88, 0xA3A9, 0xABCA, 0x9B68,
+  0xA3A9, 0xA3A9, 0x9B89, 0xA389, 0x9348, 0x9B69, 0xA3C9, 0x9B88,
+  0x9B48, 0x9B68, 0x7265, 0x9B88, 0xA3A9, 0xA3CA, 0x9B88, 0xA3C9,
+  0xA3A9, 0x9B89, 0xA3A9, 0x9328, 0x9B69, 0xA3A9, 0xA3A9, 0x9B48,
+  0x9B48, 0x7245, 0x9B88, 0xA3A9, 0xA3A9, 0x9B88, 0xA3A9, 0xA3A9,
+  0x9B89, 0xA3A9, 0x9348, 0x9B69, 0xA3A9, 0xA3A9, 0x9B68, 0x9B48,
+  0x7A86, 0x9B68, 0xA3A9, 0xA3A9, 0x9B89, 0xA3A9, 0xA389, 0x9B89,
+  0xA3A9, 0x9348, 0x9B69, 0xA3A9, 0xA3A9, 0x9B68, 0x9B48, 0x7A65,
+  0x9B68, 0xA3A9, 0xA3A9, 0xA3A9, 0xA3A9, 0x9B89, 0x9B89, 0xA3A9,
+  0x9348, 0x9B69, 0xA3A9, 0xA3A9, 0x9B48, 0x9327, 0x82A6, 0x9B68,
+  0xA3A9, 0xA389, 0xA3A9, 0xA3A9, 0x9B88, 0x9B89, 0xA3A9, 0x9348,
+  0x9B69, 0xA389, 0xA3C9, 0x9B48, 0x9327, 0x7A85, 0x9B88, 0xA3A9,
+  0x9B89, 0xA3A9, 0xA3A9, 0x9B88, 0x9B89, 0xA3A9, 0x9348, 0x9B89,
+  0x9B89, 0xA3CA, 0x9B48, 0x9328, 0x82A6, 0x9B89, 0xA3A9, 0x9B88,
+  0xA3A9, 0xA3A9, 0x9B88, 0xA389, 0xA3A9, 0x9348, 0x9B89, 0x9B88,
+  0xA3C9, 0x9B48, 0x9327, 0x7A65, 0x9B68, 0xA3A9, 0x9B68, 0xA3C9,
+  0xA3A9, 0x9B68, 0xA3A9, 0xA3A9, 0x9348, 0x9B69, 0x9B89, 0xA3CA,
+  0x9348, 0x9327, 0x7265, 0x9B89, 0xA3A9, 0x9B68, 0xA3CA, 0xA3CA,
+  0x9B68, 0xA3A9, 0xA3A9, 0x9348, 0x9B68, 0x9B69, 0xA3CA, 0x9348,
+  0x9B47, 0x82A6, 0x9B69, 0xA3A9, 0x9B48, 0xABCA, 0xABCA, 0x9B69,
+  0xA389, 0xA389, 0x9347, 0x9B88, 0x9B68, 0xA3C9, 0x9347, 0x9B48,
+  0x7AA6, 0x9B69, 0xA3A9, 0x9B48, 0xABCA, 0xABCA, 0x9B68, 0xA3A9,
+  0xA3A9, 0x9348, 0x9B89, 0x9B69, 0xA3CA, 0x9348, 0x9369, 0x9368,
+  0x82C6, 0x7A86, 0x7265, 0x7245, 0x7245, 0x7245, 0x7265, 0x7245,
+  0x7245, 0x7244, 0x7A65, 0x7245, 0x7265, 0x7265, 0x9B89, 0x7A85,
+  0x6A04, 0x6A25, 0x6A24, 0x6A45, 0x6A45, 0x7245, 0x7245, 0x7245,
+  0x6A45, 0x6A25, 0x6A25, 0x6A25, 0x6A25, 0xA3A9, 0x7A85, 0x61E4,
+  0x61E4, 0x61E4, 0x6204, 0x6A24, 0x6A25, 0x6A25, 0x6204, 0x6204,
+  0x6205, 0x6205, 0x6204, 0x61E4, 0x9B89, 0x7A86, 0x61E4, 0x61E4,
+  0x6204, 0x6204, 0x59C3, 0x59C3, 0x59C3, 0x61E4, 0x6204, 0x6A25,
+  0x6A45, 0x6205, 0x6A25, 0x9B89, 0x7AA6, 0x6205, 0x61E4, 0x61E3,
+  0x61E4, 0x61E3, 0x61E4, 0x61E4, 0x61E3, 0x61E4, 0x61E4, 0x61E4,
+  0x6A25, 0x6A25, 0x9BA9, 0x7AA7, 0x6A45, 0x6A66, 0x7266, 0x7286,
+  0x72A7, 0x7287, 0x6A66, 0x6A45, 0x6225, 0x6204, 0x59C3, 0x5182,
+  0x59C4, 0x9B89, 0x6A24, 0x4941, 0x4941, 0x4121, 0x4121, 0x4121,
+  0x4121, 0x4942, 0x4962, 0x5183, 0x51A4, 0x59E4, 0x6205, 0x6205,
+  0x9B89, 0x7AA6, 0x6A25, 0x6204, 0x61E4, 0x59E4, 0x59E4, 0x61E4,
+  0x61E4, 0x61E4, 0x61E4, 0x6204, 0x61E4, 0x61C3, 0x59A3, 0x9B89,
+  0x7285, 0x6204, 0x6A25, 0x6A45, 0x6A25, 0x6A25, 0x6A25, 0x6A25,
+  0x6A25, 0x6A25, 0x6A24, 0x6A24, 0x6A45, 0x7266, 0x9B89, 0x82C6,
+  0x6A45, 0x6204, 0x6204, 0x6204, 0x6A25, 0x6A25, 0x6A25, 0x6A04,
+  0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A25, 0x9B69, 0x7265, 0x61C3,
+  0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x61E4, 0x61E4, 0x61E4, 0x6204,
+  0x6A25, 0x6A25, 0x6A45, 0x6A25, 0x9B69, 0x82C7, 0x7266, 0x7265,
+  0x7286, 0x7266, 0x7266, 0x7246, 0x7246, 0x6A45, 0x6A25, 0x6A25,
+  0x6A25, 0x6205, 0x6A25, 0x9B48, 0x8286, 0x7245, 0x7286, 0x7286,
+  0x7245, 0x7A65, 0x7265, 0x7265, 0x7266, 0x7286, 0x7265, 0x7265,
+  0x6A44, 0x6A24, 0x9B48, 0x8AE8, 0x6A24, 0x59A2, 0x59C3, 0x7265,
+  0x7AA6, 0x6A04, 0x59A2, 0x59C3, 0x61E3, 0x6A04, 0x6A24, 0x6A25,
+  0x7A86, 0x9349, 0x7266, 0x61E4, 0x6204, 0x6A45, 0x6A24, 0x6204,
+  0x6A24, 0x6A65, 0x6A65, 0x6204, 0x61C4, 0x59C4, 0x61C4, 0x5983,
+  0x8B07, 0x82E6, 0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x8B07, 0x82A6,
+  0x82C6, 0x82C6, 0x82A6, 0x8AE7, 0x82C6, 0x82E6, 0x82C6, 0x6A24,
+  0x6A24, 0x6A24, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A04, 0x7224,
+  0x7224, 0x7244, 0x7244, 0x7244, 0x8AE6, 0x9B88, 0x69E3, 0x6A03,
+  0x6A04, 0x6A24, 0x6A24, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A04,
+  0x6A03, 0x6A03, 0x6A03, 0x82A5, 0xA389, 0x7244, 0x7224, 0x7224,
+  0x7224, 0x7224, 0x6A24, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224,
+  0x7244, 0x7245, 0x8AE6, 0x9B88, 0x7244, 0x7244, 0x7244, 0x7224,
+  0x7224, 0x7244, 0x7244, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224,
+  0x7224, 0x82C6, 0x9B88, 0x7245, 0x7244, 0x7244, 0x7244, 0x7244,
+  0x7224, 0x7224, 0x6A24, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224,
+  0x82C6, 0x9B88, 0x7224, 0x7224, 0x7244, 0x7244, 0x7244, 0x7244,
+  0x7244, 0x7244, 0x7224, 0x7224, 0x7224, 0x6A24, 0x6A04, 0x82C6,
+  0x9B88, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224, 0x6A24,
+  0x7224, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224, 0x82C6, 0xA388,
+  0x6A24, 0x6A04, 0x6A04, 0x6A04, 0x6A03, 0x6A03, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x6A24, 0x7224, 0x82C6, 0xA3A9, 0x7265,
+  0x7A65, 0x7A65, 0x7A65, 0x7A85, 0x7A85, 0x7A65, 0x7A65, 0x7A65,
+  0x7A65, 0x7A65, 0x7A65, 0x7A65, 0x8AE6, 0x9B88, 0x6A03, 0x6A03,
+  0x69E3, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A04, 0x6A04, 0x6A04,
+  0x6A24, 0x6A24, 0x7224, 0x82C6, 0x9B88, 0x7A85, 0x7A85, 0x7A65,
+  0x7A65, 0x7245, 0x7245, 0x7245, 0x7245, 0x7245, 0x7244, 0x7244,
+  0x7245, 0x7244, 0x82C6, 0xA3A9, 0x6A04, 0x6A04, 0x6A04, 0x6A04,
+  0x6A04, 0x6A24, 0x6A04, 0x6A04, 0x6A04, 0x6A24, 0x6A24, 0x7224,
+  0x7224, 0x82C6, 0x9B88, 0x6A04, 0x6A24, 0x6A24, 0x6A24, 0x7224,
+  0x7224, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244, 0x7245, 0x7244,
+  0x82C6, 0xA3A9, 0x6A03, 0x6A04, 0x6A03, 0x6A03, 0x6A24, 0x6A24,
+  0x6A03, 0x6A04, 0x7224, 0x7244, 0x7245, 0x7A45, 0x7245, 0x8AC6,
+  0xA3A9, 0x8AE6, 0x82C6, 0x8AE7, 0x82A6, 0x82A6, 0x82C6, 0x8AE6,
+  0x82A6, 0x82C6, 0x82C6, 0x8AE6, 0x82C6, 0x82C6, 0x82C6, 0x9327,
+  0xA3C9, 0x9B68, 0xABEA, 0x9327, 0x9B68, 0xA3A9, 0xA3C9, 0x9B68,
+  0x9B88, 0xA3A9, 0xA3A9, 0xA3C9, 0x9B89, 0xABEA, 0x61E3, 0xA3A9,
+  0x9B68, 0xABEA, 0x9327, 0x9B68, 0xA389, 0xA3A9, 0x9B88, 0x9B68,
+  0xA3A9, 0x9B89, 0xA3CA, 0xA389, 0xA3EA, 0x6A03, 0xA3A9, 0x9B68,
+  0xABEA, 0x9327, 0x9B68, 0xA3A9, 0xA3A9, 0x9B88, 0x9B68, 0xA3A9,
+  0x9B89, 0xA3CA, 0xA389, 0xABEA, 0x6A23, 0xA3A9, 0x9B68, 0xABEA,
+  0x9348, 0x9348, 0xA3A9, 0xA3A9, 0x9B89, 0x9348, 0xA3C9, 0x9B89,
+  0xA3A9, 0x9B89, 0xABEA, 0x7224, 0xA3A9, 0x9B88, 0xABEA, 0x9328,
+  0x9348, 0xA3C9, 0xA3A9, 0x9B89, 0x9348, 0xA3C9, 0x9B68, 0xA3C9,
+  0x9B89, 0xABEA, 0x6A23, 0xA3A9, 0x9B68, 0xABEA, 0x9327, 0x9328,
+  0xA3CA, 0x9B89, 0x9B89, 0x9348, 0xA3C9, 0x9B68, 0xA3A9, 0x9B88,
+  0xABEA, 0x7244, 0xA3A9, 0x9B68, 0xABEA, 0x9327, 0x9327, 0xABCA,
+  0x9B88, 0xA389, 0x9348, 0xA3C9, 0x9B68, 0xA3A9, 0x9B88, 0xABEA,
+  0x6A03, 0xA3A9, 0x9B88, 0xABEA, 0x9327, 0x9327, 0xABCA, 0x9B68,
+  0xA389, 0x9347, 0xA3C9, 0x9B68, 0xA3A9, 0x9B89, 0xABEA, 0x6A03,
+  0xA3A9, 0x9B88, 0xABEA, 0x9327, 0x9327, 0xA3CA, 0x9B68, 0xA389,
+  0x9347, 0xA3A9, 0x9B68, 0xA3A9, 0x9B89, 0xABEA, 0x7A65, 0x9B89,
+  0x9B88, 0xABEA, 0x9327, 0x9327, 0xA3CA, 0x9B68, 0xA389, 0x9347,
+  0xA3A9, 0x9B68, 0xA3A9, 0x9B89, 0xABCA, 0x6A23, 0x9B89, 0x9B88,
+  0xABEA, 0x9328, 0x9327, 0xA3CA, 0x9B68, 0x9B89, 0x9327, 0xA3A9,
+  0x9348, 0xA3A9, 0xA389, 0xA3CA, 0x69E3, 0x9B89, 0x9B89, 0xA3CA,
+  0x9348, 0x9327, 0xA3C9, 0x9B68, 0x9B88, 0x9327, 0xA3A9, 0x9348,
+  0xA3A9, 0xA3A9, 0xABEA, 0x7244, 0x9B89, 0x9B89, 0xA3CA, 0x9B48,
+  0x9327, 0xA3C9, 0x9B68, 0x9B88, 0x9327, 0xA389, 0x9348, 0xA389,
+  0xA3A9, 0xA3CA, 0x7224, 0x9B88, 0xA389, 0xA3C9, 0x9B48, 0x9327,
+  0xA3A9, 0x9B68, 0x9B68, 0x9327, 0xA389, 0x9348, 0xA389, 0xA3A9,
+  0xA3EA, 0x6A03, 0x82C6, 0x8AE7, 0x82C6, 0x8AE7, 0x8B07, 0x82E6,
+  0x82C6, 0x82C6, 0x82C6, 0x82A6, 0x82E6, 0x82C6, 0x82E7, 0x82A6,
+  0x82C6, 0x69E3, 0x69E3, 0x6A03, 0x6A03, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61C3, 0x61E3, 0x61E3, 0x61E3, 0x61C3, 0x61C2, 0x9348,
+  0x6A03, 0x6A24, 0x6A03, 0x6A03, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x6A24, 0x6A03, 0x6A04, 0x6203, 0x6A04, 0x61E3, 0x9348, 0x6A24,
+  0x6A24, 0x6A24, 0x7224, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x6A24, 0x6A24, 0x6A44, 0x7244, 0x6A24, 0x9348, 0x7244, 0x7244,
+  0x7224, 0x6A24, 0x6A24, 0x6A24, 0x6A03, 0x6A03, 0x6A03, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x9327, 0x6A24, 0x6A24, 0x7224,
+  0x7224, 0x6A24, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244,
+  0x7244, 0x7244, 0x6A24, 0x9327, 0x7265, 0x7265, 0x7244, 0x7244,
+  0x6A24, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x61E3,
+  0x61E3, 0x61C2, 0x8AE7, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A24, 0x6A24,
+  0x6A24, 0x8B07, 0x6A24, 0x6A24, 0x7224, 0x7224, 0x7224, 0x7224,
+  0x7244, 0x7224, 0x7244, 0x7224, 0x7224, 0x7224, 0x7244, 0x7224,
+  0x8AE7, 0x7A65, 0x7A65, 0x7A65, 0x7A65, 0x7A65, 0x7265, 0x7245,
+  0x7245, 0x7244, 0x7244, 0x7224, 0x6A24, 0x6A24, 0x6A04, 0x82C6,
+  0x7224, 0x6A24, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224, 0x7224,
+  0x6A24, 0x6A04, 0x6A04, 0x6A03, 0x6A03, 0x6A03, 0x82C6, 0x6A03,
+  0x6A04, 0x6A03, 0x6A03, 0x6A04, 0x6A04, 0x6A24, 0x6A24, 0x6A04,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A03, 0x82C6, 0x7A65, 0x7A65,
+  0x7A65, 0x7A85, 0x7A85, 0x7A65, 0x7A65, 0x7A65, 0x7A65, 0x7A65,
+  0x7A65, 0x7A65, 0x7265, 0x7265, 0x8AE7, 0x7244, 0x7244, 0x7244,
+  0x7244, 0x7244, 0x7244, 0x7244, 0x7224, 0x7224, 0x7224, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x8AE6, 0x6A24, 0x6A23, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x61E3, 0x69E3, 0x61E3, 0x69E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E2, 0x82C6, 0x82C6, 0x82C6, 0x82A6, 0x8B07, 0x82C6,
+  0x82A6, 0x8AE7, 0x82C6, 0x8AE6, 0x82C6, 0x82E6, 0x82A6, 0x8AE7,
+  0x82A6, 0x82C6, 0xA3A9, 0xA3A9, 0x9348, 0xB42B, 0x9B89, 0x9347,
+  0xABEA, 0x9B68, 0xABEA, 0xA3A9, 0xA3CA, 0x9B68, 0xAC0B, 0x9B89,
+  0x9B69, 0xA389, 0xA3A9, 0x9B68, 0xAC0A, 0x9B89, 0x9B48, 0xABEA,
+  0x9B68, 0xABEA, 0xA3A9, 0xA3CA, 0x9B68, 0xABEA, 0xA3A9, 0x9348,
+  0xA3A9, 0xA3A9, 0x9B48, 0xABEA, 0x9B89, 0x9B48, 0xABCA, 0x9B48,
+  0xAC0A, 0xA3A9, 0xA3A9, 0x9B88, 0xABCA, 0xA3A9, 0x9348, 0xA3A9,
+  0xA389, 0x9B48, 0xABEA, 0xA389, 0x9B48, 0xA3CA, 0x9348, 0xAC0B,
+  0xA3A9, 0xA3A9, 0x9B88, 0xA3CA, 0xA3A9, 0x9328, 0xA3A9, 0x9B89,
+  0x9B48, 0xABCA, 0xA3A9, 0x9B48, 0xA3C9, 0x9B48, 0xAC0B, 0xA3A9,
+  0xA3A9, 0x9B88, 0xA3C9, 0xA3A9, 0x9328, 0xA3A9, 0x9B89, 0x9348,
+  0xABEA, 0xA389, 0x9B68, 0xA3A9, 0x9B48, 0xAC0A, 0xA3A9, 0xA3A9,
+  0xA389, 0xA3A9, 0xABCA, 0x9327, 0xA3A9, 0x9B89, 0x9348, 0xABEA,
+  0xA389, 0x9B68, 0xA3A9, 0x9B68, 0xAC0A, 0xA3A9, 0xA3A9, 0xA3A9,
+  0xA389, 0xABCA, 0x8B07, 0xA3A9, 0xA389, 0x9348, 0xABEA, 0xA389,
+  0x9B68, 0xA3A9, 0x9B68, 0xAC0A, 0xA3A9, 0xA3A9, 0xA3A9, 0x9B88,
+  0xABEA, 0x9327, 0xA3A9, 0x9B89, 0x9348, 0xABEA, 0xA389, 0x9B68,
+  0xA3A9, 0x9B88, 0xABEA, 0xA3A9, 0xA3A9, 0xA3A9, 0x9B88, 0xABEA,
+  0x8B07, 0xA3A9, 0x9B89, 0x9348, 0xABCA, 0x9B89, 0x9B89, 0x9B89,
+  0x9B89, 0xABEA, 0xA3A9, 0xA3A9, 0xA3A9, 0x9B68, 0xAC0B, 0x8B07,
+  0xA3A9, 0x9B89, 0x9348, 0xA3CA, 0x9B89, 0x9B89, 0x9B89, 0x9B89,
+  0xABEA, 0xA3A9, 0xA3A9, 0xA3A9, 0x9B68, 0xAC0B, 0x9327, 0xA3A9,
+  0x9B89, 0x9328, 0xA3CA, 0x9B89, 0x9B68, 0x9B69, 0x9B89, 0xABEA,
+  0xA3A9, 0xA3A9, 0xA3A9, 0x9B48, 0xAC0A, 0x9348, 0xA3A9, 0x9B89,
+  0x9327, 0xA3CA, 0xA389, 0x9B68, 0x9B68, 0x9B89, 0xABEA, 0x9B89,
+  0xA3A9, 0xA389, 0x9B48, 0xABEA, 0x9348, 0xA3A9, 0xA389, 0x9327,
+  0xABCA, 0xA389, 0x9B68, 0x9B68, 0x9B68, 0xABEA, 0x9B88, 0xA3A9,
+  0xA389, 0x9B48, 0xABCA, 0x9348, 0x82C6, 0x82C6, 0x8AE6, 0x82A6,
+  0x7A85, 0x82A6, 0x82A6, 0x82A6, 0x82A6, 0x82A6, 0x82A6, 0x82C6,
+  0x82C6, 0x8AE7, 0x8AE7, 0x7265, 0x7244, 0x6A24, 0x7224, 0x7245,
+  0x7224, 0x7245, 0x7225, 0x7245, 0x7245, 0x7265, 0x7245, 0x7245,
+  0x7245, 0x7245, 0x7244, 0x6A24, 0x6A44, 0x7224, 0x6A24, 0x7244,
+  0x7245, 0x7265, 0x7265, 0x7245, 0x7265, 0x7245, 0x7245, 0x7245,
+  0x7224, 0x7245, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x6A03, 0x61E3, 0x61E3, 0x61E3, 0x6A03, 0x6A03, 0x6A03, 0x69E3,
+  0x7265, 0x6A24, 0x7244, 0x7245, 0x7265, 0x7245, 0x7245, 0x7265,
+  0x7265, 0x7265, 0x7244, 0x7244, 0x7244, 0x6A24, 0x6A24, 0x7245,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A44, 0x7244, 0x7265, 0x7265,
+  0x7265, 0x7265, 0x7265, 0x7244, 0x7244, 0x7244, 0x6A24, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61C2, 0x61C2, 0x61C2,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61C2, 0x7244, 0x6A24, 0x7244,
+  0x6A44, 0x6A44, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x7A85, 0x7265, 0x7265, 0x7265,
+  0x7265, 0x7265, 0x7265, 0x7245, 0x7245, 0x7265, 0x7245, 0x7245,
+  0x7245, 0x6A45, 0x6A44, 0x6A24, 0x6A03, 0x6203, 0x6203, 0x6204,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61C3, 0x6A03, 0x61E3, 0x61E3, 0x6A04, 0x6A04, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x7244, 0x7244,
+  0x7245, 0x7265, 0x7244, 0x6A24, 0x6A04, 0x6A03, 0x6A03, 0x6A04,
+  0x7224, 0x7224, 0x7245, 0x7265, 0x7244, 0x6A24, 0x6A24, 0x6A03,
+  0x7244, 0x7244, 0x7A65, 0x7A85, 0x7A85, 0x7A86, 0x7A85, 0x7A65,
+  0x7245, 0x6A24, 0x6A04, 0x6A44, 0x6A45, 0x7245, 0x7245, 0x6A24,
+  0x6A03, 0x61E3, 0x6203, 0x6203, 0x61E3, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x59C3, 0x61E3, 0x61C3, 0x7244, 0x7265,
+  0x7265, 0x7244, 0x7244, 0x6A24, 0x6A25, 0x6A04, 0x6A04, 0x6A04,
+  0x6A04, 0x6A03, 0x6203, 0x61E3, 0x61C3, 0x7AA6, 0x7AA6, 0x7AA6,
+  0x7245, 0x7AA6, 0x7AA6, 0x7265, 0x7265, 0x7AC6, 0x7AA6, 0x7AA6,
+  0x7AA5, 0x7AA5, 0x7A65, 0x7A85, 0x8AC6, 0xABEA, 0xAC0B, 0x9B47,
+  0xAC0A, 0xAC0B, 0x9B89, 0x9B89, 0xAC0B, 0xA3A9, 0xABEA, 0xABEA,
+  0xA3C9, 0x9B68, 0xA3A9, 0x8AE6, 0xABEA, 0xABCA, 0x9327, 0xAC0A,
+  0xB42B, 0x9B68, 0x9B89, 0xAC0A, 0xA3A9, 0xABC9, 0xABEA, 0xA3C9,
+  0x9B68, 0xA3A9, 0x82C6, 0xABEA, 0xABEA, 0x9328, 0xAC0A, 0xAC0B,
+  0x9B68, 0x9B89, 0xAC0A, 0xA389, 0xA3CA, 0xABEA, 0xA3CA, 0x9B68,
+  0xA389, 0x82C6, 0xABEA, 0xABEA, 0x9328, 0xAC0A, 0xAC0B, 0x9B68,
+  0xA389, 0xAC0A, 0x9B89, 0xA3CA, 0xABEA, 0xA3CA, 0x9B68, 0xA389,
+  0x82C6, 0xABCA, 0xABCA, 0x9348, 0xAC0A, 0xAC0A, 0x9B68, 0xA3A9,
+  0xABEA, 0x9B88, 0xA3C9, 0xAC0A, 0xA3CA, 0x9B68, 0xA389, 0x82A6,
+  0xABEA, 0xABCA, 0x9348, 0xAC0A, 0xAC0A, 0x9B68, 0xA3A9, 0xABEA,
+  0x9B68, 0xA3CA, 0xABEA, 0xA3C9, 0x9B68, 0xA389, 0x82C6, 0xABCA,
+  0xA3CA, 0x9348, 0xAC0A, 0xAC0A, 0x9B48, 0xA3A9, 0xABEA, 0x9B68,
+  0xABCA, 0xABEA, 0xA3C9, 0x9B68, 0xA389, 0x82C6, 0xABCA, 0xABC9,
+  0x9347, 0xAC0A, 0xAC0A, 0x9348, 0xA3C9, 0xABEA, 0x9B68, 0xA3CA,
+  0xA3CA, 0xA3CA, 0x9B68, 0xA3A9, 0x7AA6, 0xABCA, 0xA3C9, 0x9347,
+  0xAC0A, 0xAC0A, 0x9327, 0xA3CA, 0xA3CA, 0x9B68, 0xA3CA, 0xA3CA,
+  0xA3A9, 0x9B68, 0x9B89, 0x82C7, 0xABCA, 0xABC9, 0x9347, 0xAC0A,
+  0xB40A, 0x9327, 0xABEA, 0xA3A9, 0x9B68, 0xABCA, 0xA3CA, 0xA3A9,
+  0x9B89, 0xA389, 0x82A6, 0xABCA, 0xA3A9, 0x9347, 0xAC0A, 0xAC0A,
+  0x8B07, 0xABEA, 0xA3A9, 0x9B68, 0xABCA, 0xA3C9, 0xA3A9, 0xA389,
+  0x9B88, 0x82C6, 0xABCA, 0xA3C9, 0x9347, 0xAC0A, 0xABEA, 0x9307,
+  0xABCA, 0xA389, 0x9B48, 0xABCA, 0xA3A9, 0xA389, 0xA3A9, 0x9B88,
+  0x7AA6, 0xA3C9, 0xA3A9, 0x9348, 0xAC0A, 0xA3CA, 0x9307, 0xABEA,
+  0x9B68, 0x9B48, 0xABEA, 0xA3A9, 0x9B89, 0xA3A9, 0x9B68, 0x7A85,
+  0xA3C9, 0xA3A9, 0x9348, 0xAC0B, 0xA3C9, 0x9308, 0xABCA, 0x9B48,
+  0x9B48, 0xABEA, 0xA389, 0x9B89, 0xA389, 0x9B69, 0x82E7, 0x8B07,
+  0x8B28, 0x8AE7, 0x9328, 0x9348, 0x8AE7, 0x8B27, 0x8B28, 0x82E7,
+  0x82C7, 0x82A6, 0x82A6, 0x7245, 0x7265, 0x9B89, 0x59C2, 0x59C3,
+  0x61C3, 0x59C3, 0x59C3, 0x61C3, 0x61C3, 0x61C3, 0x61E4, 0x61E4,
+  0x6204, 0x6A04, 0x6A25, 0x7225, 0x9B89, 0x6A24, 0x6A24, 0x6A24,
+  0x6A24, 0x6A04, 0x6A24, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A04,
+  0x6A24, 0x6A24, 0x7265, 0x9B89, 0x6204, 0x6A24, 0x6A24, 0x6A25,
+  0x6A45, 0x7245, 0x7245, 0x7266, 0x7266, 0x7286, 0x7AA6, 0x7AA6,
+  0x7AA6, 0x7AA6, 0x9B89, 0x6204, 0x61E4, 0x61E3, 0x59A3, 0x59A3,
+  0x5182, 0x5162, 0x4962, 0x4962, 0x4962, 0x5162, 0x5182, 0x51A3,
+  0x59C3, 0x9B89, 0x6A24, 0x6A25, 0x6A25, 0x6A45, 0x6A45, 0x6A45,
+  0x6A45, 0x6A45, 0x6A25, 0x6204, 0x61E4, 0x59C4, 0x59C3, 0x61E4,
+  0x9B89, 0x61E3, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E3, 0x59C3,
+  0x59C3, 0x59A3, 0x59A3, 0x59C3, 0x59C3, 0x59C3, 0x59C3, 0x9B89,
+  0x6204, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E4, 0x61E4,
+  0x61E4, 0x59E4, 0x59E4, 0x59C4, 0x59C4, 0x59C3, 0x9B89, 0x6A24,
+  0x6A25, 0x6A25, 0x6A25, 0x6A25, 0x6A25, 0x6204, 0x6204, 0x6225,
+  0x6A25, 0x6204, 0x6204, 0x6204, 0x6A25, 0x9B89, 0x6A04, 0x6A24,
+  0x6A04, 0x6204, 0x6A04, 0x6A04, 0x6A04, 0x6204, 0x6204, 0x6204,
+  0x6204, 0x6204, 0x6204, 0x6204, 0x9B69, 0x6A24, 0x6A24, 0x6A24,
+  0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A25, 0x6A25, 0x6A24, 0x6A25,
+  0x6A24, 0x6A24, 0x6A44, 0x9B68, 0x7225, 0x7245, 0x7245, 0x7245,
+  0x7245, 0x7265, 0x7265, 0x7A65, 0x7A65, 0x7A85, 0x7A86, 0x7AA6,
+  0x7AA6, 0x7AA6, 0x9B68, 0x69E4, 0x61E4, 0x61E3, 0x61E3, 0x61C3,
+  0x61C3, 0x61C3, 0x59C2, 0x61C3, 0x61C3, 0x61C3, 0x61E3, 0x6203,
+  0x6204, 0x9B89, 0x7265, 0x7265, 0x7265, 0x7245, 0x7245, 0x7245,
+  0x6A24, 0x6A25, 0x61E4, 0x6204, 0x6204, 0x6225, 0x6A25, 0x6A25,
+  0x9369, 0x61E3, 0x6A04, 0x6A04, 0x7225, 0x7245, 0x7A86, 0x7AA6,
+  0x7AC7, 0x7AA6, 0x7A86, 0x7265, 0x6A45, 0x6A45, 0x7245, 0x7245,
+  0x7245, 0x7245, 0x7245, 0x7A86, 0x7A86, 0x7285, 0x7285, 0x82C7,
+  0x7AA6, 0x8307, 0x82E7, 0x82E6, 0x82E7, 0x82E7, 0x7265, 0x9328,
+  0x9328, 0x8B07, 0x9B69, 0x9B49, 0x9B48, 0x8AE7, 0xA3CA, 0x9327,
+  0xA389, 0xA389, 0x9348, 0xA3A9, 0x9B89, 0x7245, 0x8B08, 0x9328,
+  0x8AE7, 0x9B69, 0x9B48, 0x9B48, 0x8B07, 0xA3AA, 0x8B07, 0x9B69,
+  0x9B89, 0x9B48, 0xA389, 0x9B69, 0x7245, 0x8B28, 0x9328, 0x8AE7,
+  0x9B69, 0x9348, 0x9B68, 0x8B07, 0xA389, 0x8B07, 0x9B69, 0x9B89,
+  0x9348, 0xA3A9, 0x9B68, 0x61E4, 0x8AE8, 0x9348, 0x8AE7, 0x9B69,
+  0x8B07, 0x9B89, 0x8B07, 0xA389, 0x9307, 0x9B69, 0x9B68, 0x9348,
+  0xA3A9, 0x9B68, 0x61E4, 0x82E7, 0x9348, 0x8AE7, 0x9B69, 0x8B07,
+  0xA389, 0x8B07, 0x9B89, 0x9307, 0x9B69, 0x9B68, 0x9B48, 0xA3A9,
+  0x9B68, 0x59C3, 0x82E7, 0x9348, 0x8AE7, 0x9B69, 0x8B07, 0x9B89,
+  0x8B07, 0x9B69, 0x9328, 0x9B68, 0x9B68, 0x9B68, 0xA3A9, 0x9B68,
+  0x59C3, 0x82C7, 0x9348, 0x8AE7, 0x9B69, 0x8B07, 0x9B89, 0x8B07,
+  0x9B69, 0x9328, 0x9B48, 0x9B68, 0x9B68, 0xA3A9, 0x9B68, 0x61E4,
+  0x8AE7, 0x9B48, 0x8AE7, 0x9B69, 0x9307, 0x9B89, 0x9307, 0x9B48,
+  0x9328, 0x9B48, 0x9B68, 0x9B68, 0xA3A9, 0x9348, 0x6A04, 0x82C7,
+  0x9B68, 0x8AE7, 0x9B49, 0x9327, 0x9B68, 0x9327, 0x9348, 0x9348,
+  0x9348, 0x9B68, 0x9B68, 0xA3A9, 0x9348, 0x6A24, 0x8AE7, 0x9B68,
+  0x8AE7, 0x9328, 0x9348, 0x9348, 0x9327, 0x9328, 0x9348, 0x9348,
+  0x9B68, 0x9B68, 0xA3A9, 0x9328, 0x7AA6, 0x8B07, 0x9B68, 0x8AE7,
+  0x9328, 0x9348, 0x9348, 0x9328, 0x9328, 0x9B48, 0x9328, 0x9B68,
+  0x9B68, 0xA3A9, 0x9348, 0x6A04, 0x82C6, 0x9B68, 0x8AE7, 0x9308,
+  0x9B68, 0x9348, 0x9327, 0x9307, 0x9B48, 0x9328, 0x9B68, 0x9B68,
+  0xA3A9, 0x9328, 0x7245, 0x82C7, 0x9B89, 0x8AE7, 0x8B07, 0x9B68,
+  0x9348, 0x9327, 0x9307, 0x9B48, 0x9307, 0x9B69, 0x9B68, 0xA3A9,
+  0x9328, 0x7245, 0x82C6, 0x9B89, 0x8AE7, 0x8B07, 0x9B69, 0x9348,
+  0x9327, 0x8B07, 0x9B48, 0x8B07, 0x9B69, 0x9B89, 0xA389, 0x9328,
+  0x6A24, 0x7203, 0x7224, 0x7244, 0x7244, 0x7A65, 0x7A65, 0x7A65,
+  0x7264, 0x7244, 0x7224, 0x6A03, 0x6A03, 0x82A6, 0x9B69, 0x9B68,
+  0x9B48, 0xA389, 0x9B68, 0x9B68, 0xA3A9, 0x9B68, 0x9348, 0x9348,
+  0x9B88, 0x9327, 0x9327, 0x9B68, 0x82A6, 0x7224, 0xA3A9, 0xA389,
+  0xA3A9, 0xA3A9, 0xA3A9, 0xAC0B, 0xA3C9, 0xA3A9, 0xA3A9, 0xABEA,
+  0x9B88, 0x9B89, 0xA3AA, 0x8AE7, 0x7245, 0xA3A9, 0x9B88, 0xA3A9,
+  0xA3A9, 0xA3A9, 0xAC0B, 0xA3A9, 0xA3A9, 0xA3A9, 0xABEA, 0x9B88,
+  0x9B89, 0xA3CA, 0x82E6, 0x7245, 0xA3A9, 0x9B88, 0xA3A9, 0xA3A9,
+  0xA3A9, 0xAC0A, 0xA3A9, 0xA3A9, 0xA3A9, 0xABCA, 0x9B89, 0x9B68,
+  0xA3CA, 0x8AE7, 0x7A65, 0xA3A9, 0x9B88, 0xA3A9, 0xA3A9, 0xA3A9,
+  0xAC0B, 0xA389, 0xA3A9, 0xA3A9, 0xABCA, 0x9B69, 0x9B68, 0xA3C9,
+  0x82C6, 0x7224, 0xA3A9, 0x9B89, 0xA3A9, 0xA389, 0xA3A9, 0xAC0A,
+  0x9B89, 0xA3A9, 0xA3A9, 0xABCA, 0x9B69, 0x9B68, 0xA3C9, 0x8AE6,
+  0x7224, 0xA3A9, 0xA389, 0xA3A9, 0xA3A9, 0xA3A9, 0xAC0A, 0x9B89,
+  0xA3A9, 0xA3A9, 0xABCA, 0x9B69, 0x9B88, 0xA3C9, 0x8AE6, 0x7244,
+  0xA3A9, 0xA3A9, 0xA3A9, 0xA3A9, 0xA3A9, 0xAC0A, 0x9B89, 0xA3C9,
+  0xA3A9, 0xABEA, 0x9B69, 0x9B88, 0xA3C9, 0x82E6, 0x7224, 0xA389,
+  0xA3A9, 0xA389, 0x9B89, 0xA3A9, 0xABEA, 0x9B68, 0xA3CA, 0xA3A9,
+  0xABEA, 0x9B69, 0x9B89, 0xA3C9, 0x8AE7, 0x7265, 0xA389, 0xA3A9,
+  0xA389, 0x9B89, 0xA3A9, 0xABEA, 0x9B68, 0xA3CA, 0xA3A9, 0xABEA,
+  0x9B68, 0x9B89, 0xA3A9, 0x8AE6, 0x7224, 0x9B89, 0xA3AA, 0x9B89,
+  0x9B89, 0xA3A9, 0xABEA, 0x9B68, 0xA3CA, 0xA3A9, 0xABCA, 0x9B48,
+  0x9B89, 0xA3A9, 0x8AE6, 0x7244, 0x9B69, 0xA3AA, 0x9B89, 0x9B89,
+  0xA389, 0xABEA, 0x9B48, 0xABCA, 0xA3A9, 0xABEA, 0x9B48, 0x9B89,
+  0x9B89, 0x82E6, 0x6A23, 0x9B69, 0xA3AA, 0x9B89, 0x9B89, 0xA389,
+  0xABEA, 0x9348, 0xABCA, 0xA3A9, 0xA3CA, 0x9B48, 0x9B89, 0x9B89,
+  0x8AE6, 0x6A03, 0x9B68, 0xA3CA, 0x9B89, 0x9B89, 0xA389, 0xABEA,
+  0x9347, 0xABEA, 0xA3A9, 0xA3CA, 0x9B48, 0x9B69, 0x9B69, 0x8AE7,
+  0x7224, 0x9B89, 0x9B69, 0x9B89, 0x9328, 0x9327, 0x9B89, 0x9B48,
+  0x9348, 0x9328, 0x9B69, 0x9327, 0x9B68, 0x9B89, 0xA3A9, 0x6A03,
+  0x7224, 0x7224, 0x7224, 0x7224, 0x7224, 0x7245, 0x7245, 0x7245,
+  0x7244, 0x7224, 0x6A24, 0x7244, 0x7244, 0x7244, 0x9B69, 0x7A65,
+  0x7265, 0x7265, 0x7265, 0x7265, 0x7265, 0x7244, 0x7244, 0x7244,
+  0x7265, 0x7A85, 0x7265, 0x7265, 0x7224, 0xA3AA, 0x7265, 0x7265,
+  0x7264, 0x7244, 0x7244, 0x7224, 0x7224, 0x6A24, 0x6A03, 0x61E3,
+  0x61E3, 0x69E3, 0x6A03, 0x6A03, 0xA3CA, 0x7A85, 0x7A65, 0x7A65,
+  0x7A65, 0x7244, 0x7244, 0x7224, 0x7224, 0x6A03, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x69E3, 0xA3AA, 0x7244, 0x7224, 0x7224, 0x7244,
+  0x7245, 0x7A65, 0x7A85, 0x7A65, 0x7244, 0x6A24, 0x69E3, 0x69E3,
+  0x61C3, 0x61C2, 0xA3A9, 0x7244, 0x7224, 0x7224, 0x7224, 0x7224,
+  0x7244, 0x7244, 0x7245, 0x7A65, 0x7A85, 0x7A85, 0x7A85, 0x7A65,
+  0x7244, 0xA3A9, 0x7224, 0x7224, 0x7224, 0x6A04, 0x6A04, 0x6A24,
+  0x7224, 0x7224, 0x6A04, 0x6A03, 0x6A04, 0x6A24, 0x6A24, 0x6A23,
+  0xA3A9, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244,
+  0x7244, 0x7244, 0x7245, 0x7245, 0x7245, 0x7245, 0x7244, 0xA3A9,
+  0x7A65, 0x7A65, 0x7A65, 0x7A65, 0x7A65, 0x7A65, 0x7A65, 0x7A65,
+  0x7A65, 0x7A65, 0x7A65, 0x7A65, 0x7A65, 0x7264, 0xA3C9, 0x7244,
+  0x7224, 0x7224, 0x6A24, 0x6A24, 0x6A03, 0x6A04, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x69E3, 0x69E3, 0x6A03, 0xA3A9, 0x6A24, 0x6A24,
+  0x7224, 0x7224, 0x6A24, 0x6A24, 0x6A24, 0x7224, 0x7224, 0x7224,
+  0x7224, 0x7224, 0x7224, 0x7244, 0xA3AA, 0x6A24, 0x6A24, 0x7224,
+  0x7224, 0x7224, 0x7224, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244,
+  0x7244, 0x7244, 0x7244, 0xA3CA, 0x6A03, 0x61E3, 0x61E3, 0x61E3,
+  0x69E3, 0x61C3, 0x69E3, 0x69E3, 0x6A03, 0x6A03, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0xA3AA, 0x7244, 0x7244, 0x7244, 0x7224, 0x7244,
+  0x7244, 0x7244, 0x7244, 0x7244, 0x7224, 0x7224, 0x7224, 0x7224,
+  0x6A23, 0xA3CA, 0x6203, 0x6A03, 0x6A03, 0x6A03, 0x6A03, 0x6A23,
+  0x7224, 0x6A24, 0x6A24, 0x7224, 0x7224, 0x7224, 0x6A24, 0x6A23,
+  0x8AE6, 0x9348, 0x8B07, 0x8B27, 0x9348, 0xA3A9, 0x9327, 0x8B07,
+  0x9348, 0x9328, 0x9328, 0x8AE7, 0x9348, 0x82C6, 0x9328, 0x7A65,
+  0xA3A9, 0x9B48, 0x9B68, 0xA3A9, 0xAC0A, 0x9B88, 0x9348, 0xA3A9,
+  0x9B89, 0x9B89, 0x9348, 0xA389, 0x9307, 0x9B89, 0x82A6, 0xA3A9,
+  0x9B48, 0x9B68, 0xA3A9, 0xAC0B, 0x9B88, 0x9348, 0xA3A9, 0x9B89,
+  0x9B89, 0x9348, 0x9B89, 0x9327, 0x9B89, 0x7AA6, 0xA3A9, 0x9B28,
+  0x9B68, 0xA3A9, 0xAC0A, 0x9B89, 0x9348, 0xA3A9, 0x9B89, 0x9B89,
+  0x9348, 0x9B68, 0x9327, 0x9B89, 0x82C6, 0xA3C9, 0x9328, 0x9B69,
+  0xA3A9, 0xAC0A, 0x9B89, 0x9348, 0xA3A9, 0x9B89, 0x9B68, 0x9348,
+  0x9B68, 0x9327, 0x9B89, 0x82A6, 0xA3AA, 0x9328, 0x9B69, 0xA3A9,
+  0xABEA, 0x9B89, 0x9348, 0xA3A9, 0x9B89, 0x9B68, 0x9B48, 0x9B68,
+  0x9327, 0x9B89, 0x7A65, 0xA3A9, 0x9328, 0x9B69, 0xA3A9, 0xABEA,
+  0x9B89, 0x9348, 0xA3A9, 0x9B89, 0x9B68, 0x9B68, 0x9B68, 0x9327,
+  0x9B89, 0x7A85, 0xA3AA, 0x9328, 0x9B69, 0xA3C9, 0xABEA, 0x9B89,
+  0x9348, 0xA389, 0xA389, 0x9B68, 0x9B68, 0x9B48, 0x9327, 0x9B89,
+  0x7A85, 0xA3A9, 0x9328, 0x9B69, 0xA3C9, 0xABEA, 0x9B89, 0x9328,
+  0x9B89, 0xA389, 0x9B68, 0x9B48, 0x9B68, 0x9348, 0x9B89, 0x82C6,
+  0xA3A9, 0x9328, 0x9B89, 0xA3C9, 0xA3CA, 0x9B89, 0x9348, 0x9B89,
+  0x9B89, 0x9B48, 0x9B68, 0x9B68, 0x9348, 0x9B69, 0x7A86, 0xA3A9,
+  0x9327, 0x9B88, 0xA3CA, 0xA3CA, 0x9B89, 0x9348, 0x9B89, 0xA389,
+  0x9348, 0x9B68, 0x9B68, 0x9B48, 0x9B69, 0x7A86, 0xA3A9, 0x9327,
+  0x9B89, 0xABEA, 0xA3C9, 0xA389, 0x9327, 0x9B89, 0xA389, 0x9348,
+  0x9B68, 0x9B68, 0x9348, 0x9B69, 0x82C6, 0xA3A9, 0x9327, 0x9B89,
+  0xA3EA, 0xA3C9, 0xA389, 0x9327, 0x9B89, 0xA389, 0x9328, 0x9348,
+  0x9B68, 0x9B48, 0x9B89, 0x7A85, 0x9B89, 0x9327, 0x9B89, 0xABEA,
+  0xA3A9, 0x9B89, 0x9327, 0x9B89, 0xA3A9, 0x9328, 0x9348, 0x9B68,
+  0x9B68, 0x9B89, 0x82C6, 0x9B68, 0x9B69, 0x8B07, 0xA3A9, 0x9B69,
+  0x9328, 0x9348, 0x9328, 0xA3CA, 0x9B68, 0x9B69, 0x9B89, 0x9348,
+  0xA3AA, 0x9328, 0x7224, 0x6A03, 0x6A24, 0x7224, 0x6A24, 0x6A04,
+  0x6A24, 0x6A24, 0x6A24, 0x6A04, 0x6A04, 0x6A03, 0x6A04, 0x6A04,
+  0x7244, 0x7A85, 0x7A85, 0x7A85, 0x7265, 0x7A85, 0x7244, 0x6A24,
+  0x6A24, 0x6A24, 0x7244, 0x7265, 0x7A86, 0x7AA6, 0x7A85, 0x7A86,
+  0x7224, 0x7244, 0x7244, 0x7244, 0x7245, 0x7265, 0x7A85, 0x7A85,
+  0x7A85, 0x7A65, 0x7A65, 0x7245, 0x7265, 0x7265, 0x7A65, 0x7A65,
+  0x7A65, 0x7265, 0x7265, 0x7245, 0x7245, 0x7245, 0x7244, 0x7245,
+  0x7245, 0x7245, 0x7265, 0x7244, 0x6A24, 0x7224, 0x7244, 0x7265,
+  0x7265, 0x7265, 0x7265, 0x7265, 0x7265, 0x7265, 0x7265, 0x7245,
+  0x7245, 0x7244, 0x7265, 0x7A65, 0x7A85, 0x69E3, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x6A03, 0x61E3, 0x61E3, 0x61E3, 0x6A03, 0x6A03,
+  0x6A03, 0x6A03, 0x69E3, 0x7224, 0x6A03, 0x6A04, 0x6A04, 0x6A24,
+  0x6A24, 0x7244, 0x7244, 0x7244, 0x7245, 0x7265, 0x7265, 0x7265,
+  0x7A85, 0x7A86, 0x82A6, 0x6A03, 0x6A24, 0x6A24, 0x7244, 0x7245,
+  0x7265, 0x7A85, 0x7A86, 0x7265, 0x7244, 0x6A24, 0x6A04, 0x6A03,
+  0x6A04, 0x7245, 0x7265, 0x7265, 0x7265, 0x7265, 0x7265, 0x7265,
+  0x7265, 0x7265, 0x7265, 0x7265, 0x7265, 0x7265, 0x7265, 0x7245,
+  0x7A85, 0x6A24, 0x6A24, 0x6A03, 0x6A04, 0x6A03, 0x61E3, 0x61E3,
+  0x61E3, 0x6A03, 0x6A03, 0x6A04, 0x6A24, 0x6A24, 0x6A24, 0x7A65,
+  0x6A24, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244,
+  0x7244, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x6A24, 0x7A65, 0x7265,
+  0x7265, 0x7265, 0x7265, 0x7265, 0x7265, 0x7245, 0x7244, 0x7244,
+  0x7244, 0x7244, 0x7244, 0x7224, 0x7224, 0x7A65, 0x6A03, 0x6A04,
+  0x6A24, 0x6A24, 0x6A04, 0x6A04, 0x6A03, 0x6A04, 0x6A24, 0x6A24,
+  0x6A24, 0x7244, 0x7244, 0x7245, 0x7A85, 0x7244, 0x7244, 0x7244,
+  0x7244, 0x7245, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244, 0x7244,
+  0x7244, 0x7224, 0x7224, 0x7265, 0x7A65, 0x7244, 0x7A65, 0x7A85,
+  0x7A85, 0x7A65, 0x7A65, 0x7A85, 0x7A85, 0x7A85, 0x7A85, 0x7AA6,
+  0x7AA6, 0x82A6, 0x82A6, 0x9B89, 0x9348, 0x9B68, 0x9B88, 0x8B07,
+  0x9328, 0x9328, 0x9348, 0x9328, 0x8B27, 0x9328, 0x9B68, 0x9B68,
+  0x9348, 0x9348, 0xA3CA, 0x9B48, 0xA3A9, 0xA3A9, 0x9B48, 0x9B68,
+  0x9B48, 0x9B69, 0x9B68, 0x9348, 0x9B48, 0x9B89, 0x9B89, 0x9B89,
+  0x9B68, 0xA3CA, 0x9B48, 0xA3A9, 0xA3A9, 0x9348, 0x9348, 0x9B68,
+  0x9B69, 0x9B68, 0x9348, 0x9B68, 0x9B89, 0x9B89, 0x9B89, 0x9B68,
+  0xA3CA, 0x9348, 0xA3A9, 0xA3A9, 0x9368, 0x9348, 0x9B69, 0x9B69,
+  0x9B68, 0x9348, 0x9348, 0x9B89, 0x9B89, 0x9B89, 0x9B68, 0xA3C9,
+  0x9B68, 0xA3A9, 0xA3A9, 0x9B48, 0x9B48, 0x9B69, 0x9B68, 0x9B68,
+  0x9348, 0x9348, 0x9B89, 0x9B89, 0x9B89, 0x9B68, 0x9BA9, 0x9B68,
+  0xA389, 0xA3C9, 0x9348, 0x9B48, 0x9328, 0x9B68, 0x9B68, 0x9348,
+  0x9348, 0x9B89, 0x9B89, 0x9B89, 0x9B68, 0xA3A9, 0x9B88, 0x9B89,
+  0xA3C9, 0x9348, 0x9B48, 0x9328, 0x9B68, 0x9B68, 0x9348, 0x9348,
+  0x9B89, 0x9B89, 0x9B69, 0x9B48, 0x9BA9, 0x9B68, 0x9B89, 0xA3C9,
+  0x9348, 0x9B48, 0x9328, 0x9B69, 0x9B68, 0x9348, 0x9348, 0x9B69,
+  0x9B89, 0x9B69, 0x9B48, 0x9BA9, 0x9B88, 0x9B89, 0xA3CA, 0x9348,
+  0x9B48, 0x9328, 0x9B69, 0x9B69, 0x9328, 0x9B68, 0x9B89, 0x9B89,
+  0x9B89, 0x9B68, 0x9B89, 0x9B89, 0x9B89, 0xA3CA, 0x9348, 0x9B48,
+  0x9328, 0x9B68, 0x9B69, 0x9328, 0x9B68, 0x9B69, 0xA389, 0x9B69,
+  0x9B48, 0x9B89, 0x9B89, 0x9B69, 0xA3C9, 0x9348, 0x9B49, 0x9327,
+  0x9B68, 0x9B89, 0x9327, 0x9B48, 0x9B68, 0x9B69, 0x9B69, 0x9B48,
+  0x9B89, 0xA3A9, 0x9B69, 0xA3C9, 0x9328, 0x9B69, 0x9327, 0x9B68,
+  0x9B89, 0x9328, 0x9B68, 0x9B68, 0x9B68, 0x9B69, 0x9348, 0x9B89,
+  0xA3A9, 0x9B69, 0xA3C9, 0x9348, 0x9B69, 0x9327, 0x9B68, 0x9B89,
+  0x9328, 0x9B48, 0x9B68, 0x9B68, 0x9B69, 0x9348, 0x9B88, 0xA3A9,
+  0x9B69, 0xA3C9, 0x9348, 0x9B69, 0x9327, 0x9B68, 0x9B89, 0x9328,
+  0x9368, 0x9B68, 0x9B68, 0x9B89, 0x9B69, 0x8AE7, 0x9B89, 0x9B89,
+  0x9328, 0xA3EA, 0x9B89, 0x8B07, 0xA3CA, 0x9328, 0x9348, 0xA3CA,
+  0x9368, 0x9369, 0x9B89, 0x9369, 0x8B28, 0x7A85, 0x7AA6, 0x7A85,
+  0x7A85, 0x7244, 0x7224, 0x6A04, 0x61E3, 0x61C3, 0x61C3, 0x61E3,
+  0x6204, 0x6A04, 0x61E3, 0x8B07, 0x6A24, 0x6A45, 0x6A44, 0x7265,
+  0x7A85, 0x7A86, 0x7A86, 0x7A66, 0x7A86, 0x7A86, 0x6A45, 0x6A25,
+  0x6204, 0x6A04, 0x82E6, 0x61E4, 0x61E4, 0x6203, 0x61E3, 0x61E3,
+  0x6203, 0x6A04, 0x6A04, 0x6204, 0x61E4, 0x6204, 0x6204, 0x6A25,
+  0x6A25, 0x82C6, 0x59A3, 0x59A3, 0x59C2, 0x59C3, 0x51A3, 0x51C2,
+  0x59A2, 0x59A2, 0x59A2, 0x59A2, 0x5182, 0x5182, 0x5182, 0x5182,
+  0x82E7, 0x6A25, 0x6A45, 0x7245, 0x6A45, 0x6A45, 0x6A45, 0x6A45,
+  0x6A45, 0x6A45, 0x6A45, 0x6A46, 0x6A65, 0x6A65, 0x6A45, 0x82C6,
+  0x59C3, 0x61E3, 0x61E3, 0x61E3, 0x61E4, 0x61E3, 0x61E3, 0x61E3,
+  0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E3, 0x61E4, 0x8B07, 0x7245,
+  0x7265, 0x7245, 0x7245, 0x7265, 0x7265, 0x7265, 0x7A65, 0x7A86,
+  0x7A86, 0x7A86, 0x7AA6, 0x7A86, 0x7A86, 0x9327, 0x7A86, 0x7A86,
+  0x7A85, 0x7A65, 0x7265, 0x7265, 0x7265, 0x7265, 0x7265, 0x7245,
+  0x7245, 0x7245, 0x7245, 0x7245, 0x7AA5, 0x59A2, 0x59C3, 0x61C3,
+  0x61E3, 0x6204, 0x6A04, 0x6A24, 0x6A24, 0x6A45, 0x6A45, 0x6A25,
+  0x6A45, 0x6A45, 0x6A25, 0x8AE7, 0x6A24, 0x6A44, 0x6A44, 0x7245,
+  0x7245, 0x7245, 0x7245, 0x7245, 0x7265, 0x7245, 0x7245, 0x7265,
+  0x7265, 0x7265, 0x9328, 0x7AA6, 0x7AA7, 0x7AC6, 0x7AA6, 0x7AA6,
+  0x7AA6, 0x7A86, 0x7A85, 0x7A85, 0x7A65, 0x7A65, 0x7265, 0x7265,
+  0x7245, 0x8B07, 0x7245, 0x6A45, 0x6A45, 0x6A25, 0x6A24, 0x6A24,
+  0x6A45, 0x7245, 0x7245, 0x6A24, 0x6A24, 0x6A24, 0x6A25, 0x7245,
+  0x82C6, 0x6A04, 0x6204, 0x6204, 0x6204, 0x6204, 0x61E4, 0x61E3,
+  0x61E3, 0x61E3, 0x6A04, 0x6A24, 0x7245, 0x7265, 0x7265, 0x82C6,
+  0x6204, 0x6A24, 0x6A24, 0x6A45, 0x7245, 0x7245, 0x7265, 0x7286,
+  0x7A86, 0x7286, 0x7265, 0x7266, 0x7A86, 0x7A86, 0x9349, 0x59A2,
+  0x61C3, 0x61E4, 0x61E4, 0x6A05, 0x6A05, 0x6A45, 0x7A65, 0x7A65,
+  0x7245, 0x7244, 0x7224, 0x7224, 0x6A24, 0x7244, 0x8B28, 0x8B27,
+  0x9BA9, 0x9368, 0x9BA9, 0x8B06, 0x9BA9, 0x9B68, 0x9307, 0x8B07,
+  0x9348, 0x9B69, 0x9328, 0x9348, 0x7A65, 0x9B69, 0x9B68, 0xABC9,
+  0xA388, 0xABEA, 0x9327, 0xA3C9, 0xA3A9, 0x9B68, 0x9348, 0x9B48,
+  0xA389, 0x9B48, 0x9348, 0x7A65, 0x9B69, 0x9B68, 0xA3AA, 0xA389,
+  0xABCA, 0x9327, 0xA3CA, 0xA3A9, 0x9B68, 0x9348, 0x9B68, 0xA389,
+  0x9348, 0x9B68, 0x61E3, 0x9B69, 0x9B68, 0xA3C9, 0xA3A9, 0xA3C9,
+  0x9327, 0xA3C9, 0xA3A9, 0x9B69, 0x9348, 0x9B48, 0xA389, 0x9348,
+  0x9B48, 0x7266, 0x9B89, 0x9B68, 0xA3A9, 0xA3C9, 0xA3CA, 0x9327,
+  0xA3C9, 0xA3A9, 0x9B68, 0x9348, 0x9B68, 0xA389, 0x9B48, 0x9348,
+  0x7225, 0x9B68, 0x9B68, 0xA3A9, 0xA3A9, 0xA3C9, 0x9327, 0xA3C9,
+  0xA3A9, 0x9B68, 0x9348, 0x9B68, 0xA389, 0x9B48, 0x9B48, 0x82A6,
+  0x9B69, 0x9B68, 0xA3A9, 0xA3A9, 0xA3C9, 0x9347, 0xA3A9, 0xA3A9,
+  0x9B68, 0x9348, 0x9B68, 0xA389, 0x9B48, 0x9B48, 0x7A86, 0x9B68,
+  0x9B68, 0xA3A9, 0xA3A9, 0xA3A9, 0x9347, 0xA3A9, 0xA3A9, 0x9B68,
+  0x9348, 0x9B48, 0xA389, 0x9348, 0x9B48, 0x7245, 0x9B68, 0x9B68,
+  0xA389, 0xA3A9, 0xA3A9, 0x9348, 0xA3A9, 0xA3A9, 0x9B68, 0x9328,
+  0x9348, 0xA389, 0x9348, 0x9B48, 0x82A6, 0x9B68, 0x9B48, 0xA389,
+  0xA3A9, 0xA3A9, 0x9B48, 0xA3A9, 0xA3A9, 0x9B68, 0x9348, 0x9348,
+  0xA3A9, 0x9348, 0x9B68, 0x7A85, 0x9B69, 0x9B48, 0xA389, 0xA389,
+  0xA3A9, 0x9B48, 0xA3A9, 0xA3A9, 0x9B68, 0x9328, 0x9327, 0xA3A9,
+  0x9B48, 0x9348, 0x7A85, 0x9B69, 0x9B48, 0x9B89, 0xA389, 0xA3A9,
+  0x9B48, 0xA3A9, 0xA3A9, 0x9B68, 0x9328, 0x9327, 0xA3A9, 0x9348,
+  0x9B68, 0x82C6, 0x9B69, 0x9B48, 0x9B89, 0x9B88, 0xA3A9, 0x9B68,
+  0xA3A9, 0xA3CA, 0x9B69, 0x9328, 0x9348, 0xA3A9, 0x9328, 0x9B68,
+  0x82C7, 0x9B69, 0x9348, 0x9B89, 0x9B68, 0xA3A9, 0x9B68, 0xA3A9,
+  0xA3CA, 0x9348, 0x9328, 0x9348, 0x9BA9, 0x9328, 0x9B68, 0x7244,
+  0x82C6, 0x9B89, 0x8AE7, 0x8AE7, 0x9B48, 0x9308, 0x8B07, 0x8AE7,
+  0x9348, 0x8B07, 0x9B48, 0x9B68, 0xA389, 0x9328, 0x9328, 0x8AE7,
+  0x82A6, 0x82A6, 0x82A6, 0x82A6, 0x82A6, 0x7A86, 0x7265, 0x7265,
+  0x7245, 0x7245, 0x7245, 0x7245, 0x6A24, 0x9348, 0x8AE7, 0x7265,
+  0x7265, 0x7245, 0x7245, 0x6A45, 0x6A24, 0x6A25, 0x6A24, 0x61C3,
+  0x6A25, 0x6A45, 0x6A46, 0x6225, 0x9348, 0x7AC6, 0x6A24, 0x6A45,
+  0x7286, 0x7266, 0x7286, 0x7287, 0x6A45, 0x6225, 0x6A46, 0x6A25,
+  0x6204, 0x61E4, 0x6204, 0x9368, 0x7285, 0x51A3, 0x51A3, 0x59A3,
+  0x59C3, 0x59C3, 0x59C4, 0x61E4, 0x61E4, 0x6204, 0x6A25, 0x6A46,
+  0x6A45, 0x6A45, 0x9348, 0x7AA6, 0x6204, 0x6204, 0x6204, 0x6204,
+  0x6204, 0x61E4, 0x61E4, 0x61E4, 0x6204, 0x61E4, 0x51A3, 0x4962,
+  0x4962, 0x9348, 0x82E7, 0x7245, 0x7246, 0x7265, 0x6A45, 0x6A25,
+  0x6A25, 0x6225, 0x6225, 0x6A05, 0x6A04, 0x6205, 0x6A25, 0x6A25,
+  0x9348, 0x82A6, 0x6A04, 0x6A04, 0x6A24, 0x6A24, 0x6A25, 0x6A45,
+  0x6A45, 0x6A45, 0x6A45, 0x6A25, 0x6225, 0x6205, 0x5A05, 0x9327,
+  0x9328, 0x82A7, 0x82C7, 0x82C6, 0x7AA6, 0x7A86, 0x7A86, 0x7265,
+  0x7265, 0x7245, 0x7224, 0x7224, 0x7224, 0x7225, 0x9328, 0x82C6,
+  0x6A04, 0x6A05, 0x6A04, 0x6A25, 0x6A25, 0x6A25, 0x6A25, 0x7245,
+  0x7245, 0x7265, 0x7A85, 0x7A85, 0x7A86, 0x8B27, 0x8B08, 0x7A86,
+  0x7286, 0x7266, 0x7266, 0x7246, 0x6A45, 0x6A25, 0x6A05, 0x6205,
+  0x5A04, 0x59E4, 0x59C3, 0x59C3, 0x9328, 0x82A6, 0x69E4, 0x6A04,
+  0x6A04, 0x6A24, 0x6A25, 0x6A45, 0x7245, 0x7266, 0x7286, 0x7A86,
+  0x7AA7, 0x7AA7, 0x7AC7, 0x8B07, 0x82E7, 0x7245, 0x7245, 0x7265,
+  0x7265, 0x7266, 0x7266, 0x7266, 0x7266, 0x7266, 0x7246, 0x7246,
+  0x7245, 0x7245, 0x8B07, 0x8B08, 0x7286, 0x7266, 0x7245, 0x7245,
+  0x6A45, 0x6A25, 0x6A25, 0x6A04, 0x6A04, 0x6A04, 0x6A04, 0x6A24,
+  0x6A24, 0x8B07, 0x7AA6, 0x6204, 0x6204, 0x6204, 0x61E4, 0x61E4,
+  0x61E4, 0x69E4, 0x6A04, 0x7245, 0x7265, 0x7265, 0x7A86, 0x7A86
+};
+
+#endif
@@ -0,0 +1,134 @@
+/*
+  The transposition table (see ttable.h).
+*/
+
+#include <stddef.h>
+#include <string.h>
+#include "ttable.h"
+
+// the check bits of a key, which the bucket index does not cover
+#define KEY_CHECK(key) ((uint16_t) ((key) >> 48))
+
+// entries are read and written whole, so that searches on other threads
+// sharing the table never see half of one entry and half of another; the
+// check bits travel with the result they vouch for, so a torn entry cannot
+// pass for a hit
+#ifdef __AVR__
+#define LOAD_ENTRY(from, to) (*(to) = *(from))
+#define STORE_ENTRY(to, from) (*(to) = *(from))
+#else
+#define LOAD_ENTRY(from, to) __atomic_load((from), (to), __ATOMIC_RELAXED)
+#define STORE_ENTRY(to, from) __atomic_store((to), (from), __ATOMIC_RELAXED)
+#endif
+
+uint32_t table_bytes(uint32_t bytes)
+{
+  /*
+    the bytes a table set up in memory of the given size would use, which
+    is the largest power of two buckets that fit, or 0 if none do
+   */
+  uint32_t count = 1;
+
+  if (bytes < sizeof(TableBucket)){
+    return 0;
+  }
+  while (2 * count * sizeof(TableBucket) <= bytes){
+    count *= 2;
+  }
+  return count * sizeof(TableBucket);
+}
+
+uint8_t init_table(TransTable* table, void* memory, uint32_t bytes)
+{
+  /*
+    sets up a table in the given memory, using as many buckets as fit (a
+    power of two), and clears it, where:
+
+    table: the table
+    memory: the memory for the buckets, which the table keeps using
+    bytes: the size of the memory
+   */
+  bytes = table_bytes(bytes);
+  if (!memory || !bytes){
+    table->buckets = NULL;
+    return 0;
+  }
+  table->buckets = (TableBucket*) memory;
+  table->mask = (bytes / sizeof(TableBucket)) - 1;
+  clear_table(table);
+  return 1;
+}
+
+void clear_table(TransTable* table)
+{
+  // empties a table, as before a new game
+  memset(table->buckets, 0, (table->mask + 1) * sizeof(TableBucket));
+  table->age = 0;
+}
+
+void age_table(TransTable* table)
+{
+  // ages a table before a new search, so that its results outrank old ones
+  table->age = (table->age + 1) & (0xFF >> AGE_SHIFT);
+}
+
+uint8_t probe_table(const TransTable* table, uint64_t key,
+		    TableEntry* entry)
+{
+  /*
+    looks up a position in a table, where:
+
+    table: the table
+    key: the position key (see position_key)
+    entry: set to a copy of the position's entry, if it is found
+   */
+  TableBucket* bucket = &table->buckets[(uint32_t) key & table->mask];
+  uint16_t check = KEY_CHECK(key);
+
+  for (uint8_t i = 0; i < BUCKET_ENTRIES; i++){
+    // an empty entry has no bound, so never matches
+    LOAD_ENTRY(&bucket->entries[i], entry);
+    if (entry->check == check && ENTRY_BOUND(entry)){
+      return 1;
+    }
+  }
+  return 0;
+}
+
+void store_table(TransTable* table, uint64_t key, uint8_t depth,
+		 uint8_t bound, int16_t score, uint16_t move)
+{
+  /*
+    stores a search result in a table, in the bucket of its key, where:
+
+    table: the table
+    key: the position key (see position_key)
+    depth: the depth searched
+    bound: BOUND_UPPER, BOUND_LOWER or BOUND_EXACT
+    score: the score found, with wins and losses relative to the position
+    move: the best move found, packed by PACK_MOVE, or NO_TABLE_MOVE
+   */
+  TableBucket* bucket = &table->buckets[(uint32_t) key & table->mask];
+  uint16_t check = KEY_CHECK(key);
+  TableEntry* slot = &bucket->entries[0];
+  TableEntry old;
+
+  // the first entry keeps the deepest result of this search, and gives way
+  // to anything once it is left over from an earlier one
+  LOAD_ENTRY(slot, &old);
+  if (old.check != check && depth < old.depth &&
+      (old.flags >> AGE_SHIFT) == table->age){
+    slot = &bucket->entries[1];
+    LOAD_ENTRY(slot, &old);
+  }
+
+  // keep the best move of a shallower result of the same position
+  TableEntry entry;
+  entry.check = check;
+  entry.score = score;
+  entry.move = (move == NO_TABLE_MOVE && old.check == check) ?
+    old.move : move;
+  entry.depth = depth;
+  entry.flags = bound | (table->age << AGE_SHIFT);
+  STORE_ENTRY(slot, &entry);
+}
@@ -0,0 +1,135 @@
+#ifndef _TTABLE_H
+#define _TTABLE_H
+
+/*
+  The transposition table: a cache of search results by position key, so
+  that a position reached again through another order of moves need not be
+  searched again.
+
+  The table lives in memory handed over by the caller; the sketch gives it
+  whatever SRAM is left after the game state and a reserve for the stack
+  (see setup), so its size is only known at run time.  Entries are kept in
+  buckets of two: the first keeps the deepest result seen (or the newest,
+  once it is from an earlier search), and the second always takes the
+  latest result.
+
+  On the host, several searches on their own threads may share one table
+  without locks (see host/engine.cpp): entries are aligned to 8 bytes and
+  read and written in one go, and a probe hands back a copy rather than
+  the entry itself.
+*/
+
+#include <stdint.h>
+#include "rules.h"
+
+// bounds: what a stored score says about the true score
+#define BOUND_UPPER 1 // the true score is at most the stored score
+#define BOUND_LOWER 2 // the true score is at least the stored score
+#define BOUND_EXACT 3 // the true score is the stored score
+
+#define NO_TABLE_MOVE 0xFFFF // the packed move of an entry with no move
+
+// the parts of an entry's flags
+#define BOUND_MASK 0x03
+#define AGE_SHIFT 2
+#define ENTRY_BOUND(entry) ((entry)->flags & BOUND_MASK)
+
+// packs the from and to squares of a move into 10 bits, which is enough to
+// find it again among the legal moves of the position
+#define PACK_MOVE(move) ((uint16_t) ((move).from | ((move).to << 5)))
+
+/*
+  Struct for one search result, packed into 8 bytes, where:
+
+  check: the top 16 bits of the position key, the bottom bits being
+         implied by the bucket
+  score: the score found, relative to the position for wins and losses
+  move:  the best move found, packed by PACK_MOVE, or NO_TABLE_MOVE
+  depth: the depth searched
+  flags: the bound (low 2 bits) and the age of the search that stored it
+         (high 6 bits)
+*/
+typedef struct alignas(8) {
+  uint16_t check;
+  int16_t score;
+  uint16_t move;
+  uint8_t depth;
+  uint8_t flags;
+} TableEntry;
+
+// the entries sharing a bucket: depth-preferred, then always-replace
+#define BUCKET_ENTRIES 2
+
+typedef struct {
+  TableEntry entries[BUCKET_ENTRIES];
+} TableBucket;
+
+/*
+  Struct for a transposition table, where:
+
+  buckets: the buckets, a power of two of them
+  mask:    the number of buckets less one, to index them by key
+  age:     counts the searches, so that old results give way to new ones
+*/
+typedef struct {
+  TableBucket* buckets;
+  uint32_t mask;
+  uint8_t age;
+} TransTable;
+
+
+/*
+  the bytes a table set up in memory of the given size would use, which
+  is the largest power of two buckets that fit, or 0 if none do
+*/
+uint32_t table_bytes(uint32_t bytes);
+
+
+/*
+  sets up a table in the given memory, using as many buckets as fit (a
+  power of two), and clears it, where:
+
+  table: the table
+  memory: the memory for the buckets, which the table keeps using
+  bytes: the size of the memory
+
+  returns 0 if the memory is too small for even one bucket
+*/
+uint8_t init_table(TransTable* table, void* memory, uint32_t bytes);
+
+
+// empties a table, as before a new game
+void clear_table(TransTable* table);
+
+
+// ages a table before a new search, so that its results outrank old ones
+void age_table(TransTable* table);
+
+
+/*
+  looks up a position in a table, where:
+
+  table: the table
+  key: the position key (see position_key)
+  entry: set to a copy of the position's entry, if it is found
+
+  returns 1 if the position is in the table, 0 if not
+*/
+uint8_t probe_table(const TransTable* table, uint64_t key,
+		    TableEntry* entry);
+
+
+/*
+  stores a search result in a table, in the bucket of its key, where:
+
+  table: the table
+  key: the position key (see position_key)
+  depth: the depth searched
+  bound: BOUND_UPPER, BOUND_LOWER or BOUND_EXACT
+  score: the score found, with wins and losses relative to the position
+  move: the best move found, packed by PACK_MOVE, or NO_TABLE_MOVE
+*/
+void store_table(TransTable* table, uint64_t key, uint8_t depth,
+		 uint8_t bound, int16_t score, uint16_t move);
+
+#endif